@@ -0,0 +1,51 @@
+#include "admission.h"
+
+#include <cctype>
+
+// Helper function to reduce a Content-Type value to its lowercase MIME type
+// ("Text/HTML; charset=utf-8" -> "text/html")
+static std::string mimeTypeOf(const std::string& contentType) {
+    size_t end = contentType.find(';');
+    if (end == std::string::npos) end = contentType.size();
+    size_t start = contentType.find_first_not_of(" \t");
+    if (start == std::string::npos || start >= end) {
+        return "";
+    }
+    size_t last = contentType.find_last_not_of(" \t", end - 1);
+
+    std::string type = contentType.substr(start, last - start + 1);
+    for (char& ch : type) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    return type;
+}
+
+AdmissionPolicy::AdmissionPolicy() {
+    allow("text/html", MAX_FILE_SIZE);
+    allow("application/xhtml+xml", MAX_FILE_SIZE);
+}
+
+void AdmissionPolicy::allow(const std::string& mimeType, size_t maxBytes) {
+    budgets_[mimeTypeOf(mimeType)] = maxBytes;
+}
+
+void AdmissionPolicy::disallow(const std::string& mimeType) {
+    budgets_.erase(mimeTypeOf(mimeType));
+}
+
+Rejection AdmissionPolicy::check(const ResponseHeader& header, size_t& budget) const {
+    budget = fallbackBudget_;
+    bool success = header.status >= 200 && header.status < 300;
+    std::string type = mimeTypeOf(header.contentType);
+
+    if (success && !type.empty()) {
+        auto it = budgets_.find(type);
+        if (it == budgets_.end()) {
+            return Rejection::ContentType;
+        }
+        budget = it->second;
+    }
+    bool bodiless = header.status < 200 || header.status == 204 || header.status == 304;
+    if (!bodiless && header.contentLength >= 0 && static_cast<unsigned long long>(header.contentLength) > budget) {
+        return Rejection::DeclaredLength;
+    }
+    return Rejection::None;
+}
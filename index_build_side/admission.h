@@ -0,0 +1,49 @@
+#ifndef ADMISSION_H
+#define ADMISSION_H
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+#include "downloader.h"
+
+// Most decoded body bytes kept from one page
+#define MAX_FILE_SIZE (256 * 1024)
+
+// Counts of what the admission check let through and turned away
+struct AdmissionStats {
+    size_t admitted = 0;       // 2xx responses whose type was accepted
+    size_t contentType = 0;    // Refused on Content-Type
+    size_t declaredLength = 0; // Refused on a Content-Length over the budget
+    size_t bodyLimit = 0;      // Cut off after the body outgrew the budget
+};
+
+// Decides from the response header whether a body is worth downloading,
+// and how many decoded bytes it may grow to. Only HTML is admitted by
+// default, so a link to a video or an archive costs one header instead of
+// the whole file.
+class AdmissionPolicy {
+public:
+    // Admits text/html and application/xhtml+xml up to MAX_FILE_SIZE
+    AdmissionPolicy();
+
+    // Admit 2xx bodies of mimeType (e.g. "text/plain") up to maxBytes decoded bytes
+    void allow(const std::string& mimeType, size_t maxBytes);
+    void disallow(const std::string& mimeType);
+
+    // Budget for 2xx responses without a Content-Type and for every non-2xx
+    // response (redirects, error pages), whose bodies are only drained
+    void setFallbackBudget(size_t maxBytes) { fallbackBudget_ = maxBytes; }
+
+    // Check a response header. When admitted, budget is set to the most
+    // decoded body bytes the response may deliver. Statuses that never have
+    // a body (1xx, 204, 304) are admitted whatever Content-Length they
+    // declare, since a 304 may repeat the length of the unchanged page.
+    Rejection check(const ResponseHeader& header, size_t& budget) const;
+
+private:
+    std::unordered_map<std::string, size_t> budgets_; // Keyed by lowercase MIME type
+    size_t fallbackBudget_ = MAX_FILE_SIZE;
+};
+
+#endif // ADMISSION_H
@@ -0,0 +1,370 @@
+#include "archive.h"
+#include "content_decoder.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+// Helper function to check that a value can be stored in the tab separated index
+static bool storable(const std::string& value) {
+    return !value.empty() && value.find_first_of("\t\r\n") == std::string::npos;
+}
+
+// Helper function to compare a header name case-insensitively
+static bool headerIs(const std::string& line, size_t nameLength, const char* name) {
+    size_t i = 0;
+    for (; i < nameLength && name[i]; ++i) {
+        if (std::tolower(static_cast<unsigned char>(line[i])) != name[i]) return false;
+    }
+    return i == nameLength && !name[i];
+}
+
+// Helper function to rewrite a received header for a decoded, unframed body:
+// the codings and length of the wire no longer apply
+static std::string storedHeader(const std::string& rawHeader, int status, size_t bodySize) {
+    std::string header;
+    header.reserve(rawHeader.size() + 32);
+    size_t start = 0;
+    bool statusLine = true;
+    while (start < rawHeader.size()) {
+        size_t end = rawHeader.find('\n', start);
+        if (end == std::string::npos) end = rawHeader.size();
+        std::string line = rawHeader.substr(start, end - start);
+        start = end + 1;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) break;
+
+        if (!statusLine) {
+            size_t colon = line.find(':');
+            if (colon == std::string::npos || headerIs(line, colon, "content-encoding") ||
+                headerIs(line, colon, "transfer-encoding") || headerIs(line, colon, "content-length")) {
+                continue;
+            }
+        }
+        statusLine = false;
+        header += line;
+        header += "\r\n";
+    }
+    if (header.empty()) {
+        header = "HTTP/1.1 " + std::to_string(status) + "\r\n";
+    }
+    header += "Content-Length: " + std::to_string(bodySize) + "\r\n\r\n";
+    return header;
+}
+
+// Helper function to format a time as a WARC-Date (ISO 8601, UTC)
+static std::string warcDate(std::time_t time) {
+    std::tm utc{};
+    gmtime_r(&time, &utc);
+    char text[32];
+    std::strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    return text;
+}
+
+// Helper function to make a random (version 4) UUID for WARC-Record-ID
+static std::string recordId() {
+    static thread_local std::mt19937_64 random{std::random_device{}()};
+    uint64_t high = random(), low = random();
+    high = (high & ~0xf000ULL) | 0x4000ULL;
+    low = (low & ~(3ULL << 62)) | (2ULL << 62);
+    char text[48];
+    std::snprintf(text, sizeof(text), "%08x-%04x-%04x-%04x-%012llx",
+                  static_cast<unsigned>(high >> 32), static_cast<unsigned>((high >> 16) & 0xffff),
+                  static_cast<unsigned>(high & 0xffff), static_cast<unsigned>(low >> 48),
+                  static_cast<unsigned long long>(low & 0xffffffffffffULL));
+    return text;
+}
+
+// Helper function to compress one block as a complete gzip member
+static bool gzipBlock(const std::string& in, int level, std::string& out) {
+    z_stream stream{};
+    if (deflateInit2(&stream, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return false;
+    }
+    out.resize(deflateBound(&stream, in.size()));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+    stream.avail_in = in.size();
+    stream.next_out = reinterpret_cast<Bytef*>(&out[0]);
+    stream.avail_out = out.size();
+    int status = deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return status == Z_STREAM_END;
+}
+
+// Helper function to name the n-th archive file with the given extension
+static std::string archiveName(const ArchiveOptions& options, int number, const char* extension) {
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), "-%05d", number);
+    return (fs::path(options.directory) / (options.prefix + suffix + extension)).string();
+}
+
+ArchiveWriter::ArchiveWriter(const ArchiveOptions& options) : options_(options) {}
+
+ArchiveWriter::~ArchiveWriter() {
+    close();
+}
+
+bool ArchiveWriter::open() {
+    if (running_) return true;
+
+    std::error_code error;
+    fs::create_directories(options_.directory, error);
+    if (error) {
+        std::cerr << "Failed to create archive directory " << options_.directory << ": " << error.message() << std::endl;
+        return false;
+    }
+
+    // Never overwrite an earlier crawl's files
+    for (const auto& file : fs::directory_iterator(options_.directory, error)) {
+        std::string name = file.path().filename().string();
+        int number = 0;
+        if (name.compare(0, options_.prefix.size() + 1, options_.prefix + "-") == 0 &&
+            std::sscanf(name.c_str() + options_.prefix.size() + 1, "%d.warc.gz", &number) == 1) {
+            fileNumber_ = std::max(fileNumber_, number + 1);
+        }
+    }
+
+    stopping_ = false;
+    running_ = true;
+    writer_ = std::thread(&ArchiveWriter::writerLoop, this);
+    return true;
+}
+
+bool ArchiveWriter::append(const std::string& url, const Response& response, std::string body, std::time_t fetchTime) {
+    size_t size = url.size() + response.rawHeader.size() + body.size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    // A record larger than the whole queue still goes in when nothing waits
+    if (!running_ || !storable(url) || (queuedBytes_ + size > options_.maxQueuedBytes && !queue_.empty())) {
+        ++stats_.dropped;
+        return false;
+    }
+    queue_.push_back(PendingRecord{url, fetchTime, response.header.status, response.rawHeader, std::move(body)});
+    queuedBytes_ += size;
+    wake_.notify_one();
+    return true;
+}
+
+void ArchiveWriter::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!running_) return;
+    unsigned long long ticket = ++flushRequests_;
+    wake_.notify_one();
+    drained_.wait(lock, [&] { return flushesDone_ >= ticket || !running_; });
+}
+
+void ArchiveWriter::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) return;
+        stopping_ = true;
+        wake_.notify_one();
+    }
+    writer_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+    drained_.notify_all();
+}
+
+ArchiveStats ArchiveWriter::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+// Take queued records in batches and write them out, so append() only ever
+// holds the lock for a push
+void ArchiveWriter::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this] { return !queue_.empty() || flushRequests_ > flushesDone_ || stopping_; });
+        std::vector<PendingRecord> batch;
+        batch.swap(queue_);
+        queuedBytes_ = 0;
+        unsigned long long ticket = flushRequests_;
+        bool stop = stopping_;
+        lock.unlock();
+
+        for (PendingRecord& record : batch) {
+            addRecord(record);
+        }
+        // A partial block only goes out when someone waits for it
+        if ((ticket > flushesDone_ || stop) && !block_.empty()) {
+            writeBlock();
+        }
+        if (stop || ticket > flushesDone_) {
+            data_.flush();
+            index_.flush();
+        }
+
+        lock.lock();
+        if (ticket > flushesDone_) {
+            flushesDone_ = ticket;
+            drained_.notify_all();
+        }
+        if (stop && queue_.empty()) break;
+    }
+    lock.unlock();
+
+    data_.close();
+    index_.close();
+}
+
+// Serialize one record into the current block, writing the block once full
+void ArchiveWriter::addRecord(PendingRecord& record) {
+    std::string http = storedHeader(record.rawHeader, record.status, record.body.size());
+    size_t contentLength = http.size() + record.body.size();
+
+    size_t offset = block_.size();
+    block_ += "WARC/1.1\r\nWARC-Type: response\r\nWARC-Record-ID: <urn:uuid:" + recordId() + ">\r\n";
+    block_ += "WARC-Date: " + warcDate(record.fetchTime) + "\r\n";
+    block_ += "WARC-Target-URI: " + record.url + "\r\n";
+    block_ += "Content-Type: application/http;msgtype=response\r\n";
+    block_ += "Content-Length: " + std::to_string(contentLength) + "\r\n\r\n";
+    block_ += http;
+    block_ += record.body;
+    block_ += "\r\n\r\n";
+    blockEntries_.push_back(BlockEntry{std::move(record.url), record.fetchTime, record.status, offset, block_.size() - offset});
+
+    if (block_.size() >= options_.blockSize) {
+        writeBlock();
+    }
+}
+
+// Compress the current block into the open file and index its records
+bool ArchiveWriter::writeBlock() {
+    std::string compressed;
+    bool ok = gzipBlock(block_, options_.compressionLevel, compressed);
+    if (ok && (!data_.is_open() || fileSize_ >= options_.maxFileSize)) {
+        ok = openFile();
+    }
+    if (ok) {
+        data_.write(compressed.data(), compressed.size());
+        for (const BlockEntry& entry : blockEntries_) {
+            index_ << entry.url << '\t' << static_cast<long long>(entry.fetchTime) << '\t' << entry.status << '\t'
+                   << fileSize_ << '\t' << compressed.size() << '\t' << entry.offset << '\t' << entry.length << '\n';
+        }
+        ok = data_.good() && index_.good();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ok) {
+        fileSize_ += compressed.size();
+        stats_.records += blockEntries_.size();
+        stats_.blocks += 1;
+        stats_.rawBytes += block_.size();
+        stats_.diskBytes += compressed.size();
+    } else {
+        std::cerr << "Failed to write archive block to " << dataName_ << std::endl;
+        stats_.dropped += blockEntries_.size();
+    }
+    block_.clear();
+    blockEntries_.clear();
+    return ok;
+}
+
+// Move on to the next numbered file and its index
+bool ArchiveWriter::openFile() {
+    data_.close();
+    index_.close();
+    dataName_ = archiveName(options_, fileNumber_, ".warc.gz");
+    data_.open(dataName_, std::ios::binary | std::ios::trunc);
+    index_.open(archiveName(options_, fileNumber_, ".idx"), std::ios::trunc);
+    ++fileNumber_;
+    fileSize_ = 0;
+    if (!data_ || !index_) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.files;
+    return true;
+}
+
+bool ArchiveReader::open(const std::string& directory) {
+    std::error_code error;
+    std::vector<fs::path> indexes;
+    for (const auto& file : fs::directory_iterator(directory, error)) {
+        if (file.path().extension() == ".idx") indexes.push_back(file.path());
+    }
+    if (error) {
+        std::cerr << "Failed to read archive directory " << directory << ": " << error.message() << std::endl;
+        return false;
+    }
+    std::sort(indexes.begin(), indexes.end());
+
+    entries_.clear();
+    for (const fs::path& path : indexes) {
+        std::ifstream index(path);
+        std::string data = fs::path(path).replace_extension(".warc.gz").string();
+        std::string line;
+        while (std::getline(index, line)) {
+            ArchiveEntry entry;
+            size_t urlEnd = line.find('\t');
+            long long fetchTime = 0;
+            unsigned long long blockOffset, blockLength, recordOffset, recordLength;
+            if (urlEnd == std::string::npos ||
+                std::sscanf(line.c_str() + urlEnd + 1, "%lld\t%d\t%llu\t%llu\t%llu\t%llu", &fetchTime, &entry.status,
+                            &blockOffset, &blockLength, &recordOffset, &recordLength) != 6) {
+                std::cerr << "Skipping malformed archive index line in " << path.string() << std::endl;
+                continue;
+            }
+            entry.url = line.substr(0, urlEnd);
+            entry.fetchTime = static_cast<std::time_t>(fetchTime);
+            entry.file = data;
+            entry.blockOffset = blockOffset;
+            entry.blockLength = blockLength;
+            entry.recordOffset = recordOffset;
+            entry.recordLength = recordLength;
+            entries_.push_back(std::move(entry));
+        }
+    }
+    return true;
+}
+
+bool ArchiveReader::read(const ArchiveEntry& entry, Response& response) {
+    if (entry.file != blockFile_ || entry.blockOffset != blockOffset_ || block_.empty()) {
+        blockFile_.clear();
+        block_.clear();
+
+        std::ifstream file(entry.file, std::ios::binary);
+        std::string compressed(entry.blockLength, '\0');
+        if (!file.seekg(entry.blockOffset) || !file.read(&compressed[0], compressed.size())) {
+            std::cerr << "Failed to read archive block from " << entry.file << std::endl;
+            return false;
+        }
+        ContentDecoder decoder;
+        decoder.reset(ContentCoding::Gzip);
+        if (!decoder.feed(compressed.data(), compressed.size(), block_) || !decoder.finished()) {
+            std::cerr << "Corrupt archive block in " << entry.file << std::endl;
+            block_.clear();
+            return false;
+        }
+        blockFile_ = entry.file;
+        blockOffset_ = entry.blockOffset;
+    }
+    if (entry.recordOffset + entry.recordLength > block_.size()) {
+        return false;
+    }
+
+    // Skip the WARC header; the HTTP message follows it
+    const char* record = block_.data() + entry.recordOffset;
+    std::string text(record, entry.recordLength);
+    size_t warcEnd = text.find("\r\n\r\n");
+    size_t httpEnd = warcEnd == std::string::npos ? std::string::npos : text.find("\r\n\r\n", warcEnd + 4);
+    if (httpEnd == std::string::npos || text.size() < httpEnd + 8) {
+        return false;
+    }
+
+    response = Response();
+    response.rawHeader = text.substr(warcEnd + 4, httpEnd + 4 - (warcEnd + 4));
+    response.header = handle_response(response.rawHeader);
+    response.body = text.substr(httpEnd + 4, text.size() - 4 - (httpEnd + 4));
+    response.finalUrl = entry.url;
+    return true;
+}
@@ -0,0 +1,164 @@
+#ifndef ARCHIVE_H
+#define ARCHIVE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "downloader.h"
+
+// Uncompressed bytes gathered into one gzip member before it is written
+#define ARCHIVE_BLOCK_SIZE (1024 * 1024)
+// Compressed size after which the writer moves on to the next file
+#define ARCHIVE_FILE_SIZE (1024LL * 1024 * 1024)
+// Records waiting for the writer thread before new ones are dropped
+#define ARCHIVE_QUEUE_LIMIT (64 * 1024 * 1024)
+
+// Where archive files go and how large they grow
+struct ArchiveOptions {
+    std::string directory;                    // Created if missing
+    std::string prefix = "crawl";             // Files are <prefix>-00000.warc.gz with a <prefix>-00000.idx index
+    size_t blockSize = ARCHIVE_BLOCK_SIZE;
+    long long maxFileSize = ARCHIVE_FILE_SIZE;
+    size_t maxQueuedBytes = ARCHIVE_QUEUE_LIMIT;
+    int compressionLevel = 6;                 // zlib level for each block
+};
+
+// Counters of an ArchiveWriter
+struct ArchiveStats {
+    unsigned long records = 0;       // Records written to disk
+    unsigned long dropped = 0;       // Records refused because the queue was full or the URL was unusable
+    unsigned long blocks = 0;        // gzip members written
+    unsigned long files = 0;         // Archive files opened
+    unsigned long long rawBytes = 0; // Record bytes before compression
+    unsigned long long diskBytes = 0; // Bytes written to archive files
+};
+
+// Append-only archive of fetched responses as WARC/1.1 "response" records.
+// Records are packed into gzip members of about blockSize bytes, so the
+// files stay readable with zcat while compressing far better than one
+// member per page. Each file gets a sidecar index with one tab separated
+// line per record:
+//
+//   url  fetch-time  status  block-offset  block-length  record-offset  record-length
+//
+// so a record is read back by inflating just its block (see ArchiveReader).
+//
+// Bodies are stored decoded, as the engine hands them over, so the stored
+// HTTP header drops Content-Encoding and Transfer-Encoding and carries the
+// decoded Content-Length. Compression and disk writes happen on a
+// background thread; append() only queues, and drops the record rather
+// than wait when the queue is full.
+class ArchiveWriter {
+public:
+    explicit ArchiveWriter(const ArchiveOptions& options);
+    ~ArchiveWriter();
+
+    ArchiveWriter(const ArchiveWriter&) = delete;
+    ArchiveWriter& operator=(const ArchiveWriter&) = delete;
+
+    // Create the directory and start the writer thread. Numbering continues
+    // after any archive files already there. Returns false on failure.
+    bool open();
+
+    // Queue a response for archiving; url is where it came from (its final
+    // URL) and body its decoded body. Returns false if the record was dropped.
+    bool append(const std::string& url, const Response& response, std::string body,
+                std::time_t fetchTime = std::time(nullptr));
+
+    // Block until everything queued so far is compressed and on disk
+    void flush();
+
+    // Write out what is queued and stop the writer thread
+    void close();
+
+    ArchiveStats stats() const;
+
+private:
+    struct PendingRecord {
+        std::string url;
+        std::time_t fetchTime;
+        int status;
+        std::string rawHeader;
+        std::string body;
+    };
+
+    // One record of the block being assembled, waiting for the block's offset
+    struct BlockEntry {
+        std::string url;
+        std::time_t fetchTime;
+        int status;
+        size_t offset;
+        size_t length;
+    };
+
+    void writerLoop();
+    void addRecord(PendingRecord& record);
+    bool writeBlock();
+    bool openFile();
+
+    ArchiveOptions options_;
+    std::thread writer_;
+    bool running_ = false;
+
+    // Shared with append(); guarded by mutex_
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;    // Records queued or stop requested
+    std::condition_variable drained_; // A flush finished
+    std::vector<PendingRecord> queue_;
+    size_t queuedBytes_ = 0;
+    unsigned long long flushRequests_ = 0; // Tickets handed out by flush()
+    unsigned long long flushesDone_ = 0;   // Highest ticket whose records are on disk
+    bool stopping_ = false;
+    ArchiveStats stats_;
+
+    // Writer thread only
+    std::string block_;               // Uncompressed records of the current block
+    std::vector<BlockEntry> blockEntries_;
+    std::ofstream data_;
+    std::ofstream index_;
+    std::string dataName_;
+    long long fileSize_ = 0;
+    int fileNumber_ = 0;
+};
+
+// One record read back from an archive
+struct ArchiveEntry {
+    std::string url;
+    std::time_t fetchTime = 0;
+    int status = 0;
+    std::string file;          // Path of the .warc.gz file
+    uint64_t blockOffset = 0;
+    uint64_t blockLength = 0;
+    uint64_t recordOffset = 0; // Within the inflated block
+    uint64_t recordLength = 0;
+};
+
+// Random access to archives written by ArchiveWriter, through their indexes
+class ArchiveReader {
+public:
+    // Load every index in directory, in file order. Returns false if the
+    // directory cannot be read.
+    bool open(const std::string& directory);
+
+    const std::vector<ArchiveEntry>& entries() const { return entries_; }
+
+    // Read one record back as the engine would have returned it: header,
+    // decoded body and finalUrl. The last inflated block is kept, so reading
+    // entries in order inflates each block once.
+    bool read(const ArchiveEntry& entry, Response& response);
+
+private:
+    std::vector<ArchiveEntry> entries_;
+    std::string blockFile_;
+    uint64_t blockOffset_ = 0;
+    std::string block_;
+};
+
+#endif // ARCHIVE_H
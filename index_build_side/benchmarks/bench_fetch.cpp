@@ -0,0 +1,74 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include "../fetch_engine.h"
+#include "../resolver.h"
+#include "../tests/local_server.h"
+
+#define HOSTS 8
+#define PAGES_PER_HOST 250
+#define PAGE_BYTES (16 * 1024)
+
+// Helper function to fetch every page of the synthetic web through one engine
+static void runBenchmark(const char* name, bool https, IoBackend backend, const LocalServer& server) {
+    Resolver resolver;
+    resolver.addOverride("*.test", "127.0.0.1");
+    FetchEngineOptions options;
+    options.ioBackend = backend;
+    FetchEngine engine(options, &resolver);
+    if (backend == IoBackend::IoUring && !engine.usingIoUring()) {
+        std::cout << name << ": skipped, io_uring unavailable\n";
+        return;
+    }
+
+    size_t pages = 0;
+    size_t failures = 0;
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t host = 0; host < HOSTS; ++host) {
+        for (size_t page = 0; page < PAGES_PER_HOST; ++page) {
+            std::string url = server.url(https, SyntheticWeb::hostName(host), "/page/" + std::to_string(page) + ".html");
+            engine.submit(url, [&](const std::string&, Response& response) {
+                if (response.error == FetchError::None && response.header.status == 200) {
+                    ++pages;
+                    bytes += response.body.size();
+                } else {
+                    ++failures;
+                }
+            });
+        }
+    }
+    engine.run();
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << name << ": " << pages / elapsed << " pages/s, " << bytes / elapsed / 1e6 << " MB/s ("
+              << pages << " pages, " << failures << " failures, " << elapsed << " s)\n";
+    if (engine.usingIoUring()) {
+        IoRingStats ring = engine.ioRingStats();
+        std::cout << "       " << ring.submissions << " submissions in " << ring.enters << " io_uring_enter calls\n";
+    }
+}
+
+// Crawl-shaped load against a server on this machine, so engine changes can
+// be compared without the network's noise
+int main() {
+    SyntheticWebOptions web;
+    web.hosts = HOSTS;
+    web.pagesPerHost = PAGES_PER_HOST;
+    web.pageBytes = PAGE_BYTES;
+    LocalServer server(web);
+    if (!server.start()) {
+        return 1;
+    }
+
+    std::cout << "Fetching " << server.web().pageCount() << " pages of " << PAGE_BYTES << " bytes from "
+              << HOSTS << " hosts\n";
+    runBenchmark("HTTP  epoll   ", false, IoBackend::Epoll, server);
+    runBenchmark("HTTP  io_uring", false, IoBackend::IoUring, server);
+    runBenchmark("HTTPS epoll   ", true, IoBackend::Epoll, server);
+    runBenchmark("HTTPS io_uring", true, IoBackend::IoUring, server);
+
+    LocalServerStats stats = server.stats();
+    std::cout << "Server: " << stats.requests << " requests on " << stats.connections << " connections\n";
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include "../downloader.h"
+#include "../http_header_parser.h"
+
+// Copy of the original istringstream based handle_response, kept as the baseline
+static ResponseHeader legacyHandleResponse(const std::string& response) {
+    ResponseHeader header;
+    std::istringstream response_stream(response);
+    std::string line;
+
+    while (std::getline(response_stream, line) && line != "\r") {
+        if (line.find("HTTP/") == 0) {
+            size_t status_start = line.find(" ") + 1;
+            if (status_start != std::string::npos) {
+                size_t status_end = line.find(" ", status_start);
+                if (status_end != std::string::npos) {
+                    try {
+                        header.status = std::stoi(line.substr(status_start, status_end - status_start));
+                    } catch (const std::exception& e) {
+                        header.status = 0;
+                    }
+                }
+            }
+        } else if (line.find("Content-Type:") == 0) {
+            header.contentType = line.substr(13);
+        } else if (line.find("Content-Length:") == 0) {
+            std::string length_str = line.substr(15);
+            try {
+                header.contentLength = std::stoi(length_str);
+            } catch (const std::exception& e) {
+                header.contentLength = -1;
+            }
+        }
+    }
+
+    auto trim = [](std::string& str) {
+        str.erase(0, str.find_first_not_of(" \t\r\n"));
+        str.erase(str.find_last_not_of(" \t\r\n") + 1);
+    };
+    trim(header.contentType);
+
+    return header;
+}
+
+// A typical header from a large site, around 700 bytes
+static const std::string SAMPLE_HEADER =
+    "HTTP/1.1 200 OK\r\n"
+    "Date: Sun, 18 Oct 2026 10:00:00 GMT\r\n"
+    "Content-Type: text/html; charset=UTF-8\r\n"
+    "Content-Length: 48213\r\n"
+    "Connection: keep-alive\r\n"
+    "Cache-Control: private, max-age=0\r\n"
+    "Expires: -1\r\n"
+    "ETag: \"5f3a9c2e-bc55\"\r\n"
+    "Last-Modified: Sat, 17 Oct 2026 22:14:03 GMT\r\n"
+    "Content-Encoding: gzip\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "Server: nginx\r\n"
+    "Strict-Transport-Security: max-age=31536000; includeSubDomains\r\n"
+    "X-Frame-Options: SAMEORIGIN\r\n"
+    "X-Content-Type-Options: nosniff\r\n"
+    "Set-Cookie: session=8f2c1d0e9b7a6f5e4d3c2b1a; Path=/; Secure; HttpOnly; SameSite=Lax\r\n"
+    "Set-Cookie: prefs=lang%3Den; Path=/; Max-Age=31536000\r\n"
+    "Accept-Ranges: bytes\r\n"
+    "Age: 12\r\n"
+    "Via: 1.1 varnish\r\n"
+    "X-Cache: HIT\r\n"
+    "\r\n";
+
+#define ITERATIONS 500000
+
+// Helper function to time a parse function over the sample header
+template <typename ParseFunction>
+static void runBenchmark(const char* name, ParseFunction parse) {
+    long long checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        checksum += parse();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double nsPerHeader = elapsed * 1e9 / ITERATIONS;
+    double megabytesPerSecond = SAMPLE_HEADER.size() * double(ITERATIONS) / elapsed / 1e6;
+    std::cout << name << ": " << nsPerHeader << " ns/header, " << megabytesPerSecond
+              << " MB/s (checksum " << checksum << ")\n";
+}
+
+int main() {
+    std::cout << "Parsing a " << SAMPLE_HEADER.size() << " byte header " << ITERATIONS << " times\n";
+
+    runBenchmark("legacy handle_response", [] {
+        return legacyHandleResponse(SAMPLE_HEADER).contentLength;
+    });
+    runBenchmark("handle_response       ", [] {
+        return handle_response(SAMPLE_HEADER).contentLength;
+    });
+    runBenchmark("HttpHeaderParser      ", [] {
+        HttpHeaderParser parser;
+        parser.parse(SAMPLE_HEADER.data(), SAMPLE_HEADER.size());
+        return parser.contentLength() + static_cast<long long>(parser.etag().size());
+    });
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <iostream>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../html_scanner.h"
+#include "../parser.h"
+
+#define CORPUS_PAGES 64
+#define PASSES 5
+
+// Helper function to build a page shaped like a typical news or blog page:
+// inline script and CSS, a navigation bar of links, and paragraphs of text
+// with the odd entity. About half the bytes are markup, script or style.
+static std::string makePage(int number) {
+    std::string page = "<!DOCTYPE html>\n<html lang=\"en\"><head><meta charset=\"utf-8\">\n"
+                       "<title>Story " + std::to_string(number) + " &ndash; Example News</title>\n"
+                       "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\n<style>\n";
+    for (int i = 0; i < 40; ++i) {
+        page += ".block-" + std::to_string(i) + " > .item:hover { color: #3a3a3a; margin: 0 4px; padding: 2px 8px; }\n";
+    }
+    page += "</style>\n<script>\n";
+    for (int i = 0; i < 60; ++i) {
+        page += "  if (window.data && data.items.length < " + std::to_string(i) +
+                ") { track('view', {id: " + std::to_string(i) + ", html: '<b>x</b>'}); }\n";
+    }
+    page += "</script>\n</head><body>\n<nav class=\"top-nav\" data-state='closed'>\n";
+    for (int i = 0; i < 40; ++i) {
+        page += "  <a class=\"nav-link\" href=\"/section/" + std::to_string(i) + "/\" title=\"Section " +
+                std::to_string(i) + "\">Section " + std::to_string(i) + "</a>\n";
+    }
+    page += "</nav>\n<!-- main content starts here -->\n<article>\n";
+    for (int i = 0; i < 30; ++i) {
+        page += "<p>The committee met on Tuesday to discuss the proposal &mdash; a plan that would "
+                "change how the city funds its parks, libraries &amp; schools over the next decade. "
+                "Officials said the vote, expected later this month, could still be delayed if "
+                "<a href=\"/related/" + std::to_string(number * 100 + i) + ".html\">new objections</a> "
+                "are raised by residents.</p>\n";
+    }
+    page += "</article>\n<footer><p>&copy; 2026 Example News</p></footer>\n</body></html>\n";
+    return page;
+}
+
+// Helper function to read the pages given on the command line
+static bool readCorpus(int argc, char* argv[], std::vector<std::string>& pages) {
+    for (int i = 1; i < argc; ++i) {
+        std::ifstream file(argv[i], std::ios::binary);
+        if (!file) {
+            std::cerr << "Cannot read " << argv[i] << std::endl;
+            return false;
+        }
+        std::ostringstream content;
+        content << file.rdbuf();
+        pages.push_back(content.str());
+    }
+    return true;
+}
+
+// Helper function to time parseHTML over the corpus with one scan level
+static void benchmarkParse(ScanLevel level, const std::vector<std::string>& pages, size_t totalBytes) {
+    setScanLevel(level);
+    size_t words = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < PASSES; ++pass) {
+        for (const std::string& page : pages) {
+            words += parseHTML("https://example.com/", page).words.size();
+        }
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "parseHTML  " << scanLevelName(level) << ": " << totalBytes * double(PASSES) / elapsed / 1e6
+              << " MB/s (" << words / PASSES << " words per pass)\n";
+}
+
+// Helper function to time the bare scan for '<', '>' and '&' with one scan level
+static void benchmarkScan(ScanLevel level, const std::vector<std::string>& pages, size_t totalBytes) {
+    setScanLevel(level);
+    size_t stops = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < PASSES * 20; ++pass) {
+        for (const std::string& page : pages) {
+            for (size_t i = 0; i < page.size(); ++i) {
+                i += scanForAny(page.data() + i, page.size() - i, '<', '>', '&');
+                ++stops;
+            }
+        }
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "scanForAny " << scanLevelName(level) << ": " << totalBytes * double(PASSES * 20) / elapsed / 1e6
+              << " MB/s (" << stops / (PASSES * 20) << " stops per pass)\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> pages;
+    if (!readCorpus(argc, argv, pages)) {
+        return 1;
+    }
+    if (pages.empty()) {
+        for (int i = 0; i < CORPUS_PAGES; ++i) pages.push_back(makePage(i));
+    }
+
+    size_t totalBytes = 0;
+    for (const std::string& page : pages) totalBytes += page.size();
+    std::cout << "Corpus: " << pages.size() << (argc > 1 ? " pages from the command line, " : " synthetic pages, ")
+              << totalBytes / 1024 << " KB; this CPU supports " << scanLevelName(supportedScanLevel()) << "\n";
+
+    std::vector<ScanLevel> levels;
+    for (ScanLevel level : {ScanLevel::Scalar, ScanLevel::Sse2, ScanLevel::Avx2}) {
+        if (static_cast<int>(level) <= static_cast<int>(supportedScanLevel())) levels.push_back(level);
+    }
+    for (ScanLevel level : levels) benchmarkScan(level, pages, totalBytes);
+    for (ScanLevel level : levels) benchmarkParse(level, pages, totalBytes);
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+#include <iostream>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <regex>
+#include <string>
+#include <vector>
+#include "../parser.h"
+#include "../token_arena.h"
+
+#define CORPUS_PAGES 64
+#define PASSES 5
+
+// Heap allocations, and the bytes asked for, made by whatever runs between two reads
+static size_t allocationCount = 0;
+static size_t allocatedBytes = 0;
+
+void* operator new(size_t size) {
+    ++allocationCount;
+    allocatedBytes += size;
+    void* block = std::malloc(size ? size : 1);
+    if (!block) throw std::bad_alloc();
+    return block;
+}
+
+// Kept out of line: inlined into std::regex, GCC takes the free() for a
+// mismatched delete
+__attribute__((noinline)) void operator delete(void* block) noexcept {
+    std::free(block);
+}
+
+__attribute__((noinline)) void operator delete(void* block, size_t) noexcept {
+    std::free(block);
+}
+
+// Copies of the original three pass pipeline from parser.cpp, link
+// extraction included, kept as the baseline
+static std::string legacyDecodeHTMLEntities(const std::string& text) {
+    std::string decoded;
+    decoded.reserve(text.size());
+    size_t i = 0;
+    while (i < text.size()) {
+        if (text.compare(i, 4, "&lt;") == 0) {
+            decoded += '<';
+            i += 4;
+        } else if (text.compare(i, 4, "&gt;") == 0) {
+            decoded += '>';
+            i += 4;
+        } else if (text.compare(i, 5, "&amp;") == 0) {
+            decoded += '&';
+            i += 5;
+        } else {
+            decoded += text[i];
+            i++;
+        }
+    }
+    return decoded;
+}
+
+static std::string legacyToLower(const std::string& str) {
+    std::string lowerStr;
+    lowerStr.reserve(str.size());
+    for (char ch : str) {
+        lowerStr += static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    }
+    return lowerStr;
+}
+
+static std::string legacyGetHostname(const std::string& url) {
+    std::regex urlRegex(R"(^(https?://)?([^/]+))");
+    std::smatch match;
+    if (std::regex_search(url, match, urlRegex)) {
+        return match[2].str();
+    }
+    return "";
+}
+
+static std::string legacyHandleAnchorTag(const std::string& baseUrl, const std::string& tagContent) {
+    std::regex hrefRegex(R"(href\s*=\s*["']([^"']+)["'])");
+    std::smatch match;
+    if (std::regex_search(tagContent, match, hrefRegex)) {
+        std::string href = match[1].str();
+        if (href.find("http://") == 0 || href.find("https://") == 0) {
+            return href;
+        }
+        std::string hostname = legacyGetHostname(baseUrl);
+        if (hostname.empty()) {
+            return "";
+        }
+        if (href.front() == '/') {
+            return "https://" + hostname + href;
+        } else {
+            return "https://" + hostname + '/' + href;
+        }
+    }
+    return "";
+}
+
+static std::string legacyStripHTMLTags(const std::string& url, const std::string& html, std::vector<std::string>& links) {
+    std::string result;
+    bool insideTag = false;
+    std::string tagBuffer;
+    result.reserve(html.size());
+    for (char ch : html) {
+        if (ch == '<') {
+            insideTag = true;
+            tagBuffer.clear();
+        } else if (ch == '>') {
+            insideTag = false;
+            if (tagBuffer.find("a ") == 0 || tagBuffer == "a") {
+                std::string absoluteUrl = legacyHandleAnchorTag(url, "<" + tagBuffer + ">");
+                if (!absoluteUrl.empty()) links.push_back(absoluteUrl);
+            }
+        } else if (insideTag) {
+            tagBuffer += ch;
+        } else {
+            result += ch;
+        }
+    }
+    return legacyDecodeHTMLEntities(result);
+}
+
+static std::vector<std::string> legacySplitIntoWords(const std::string& text) {
+    std::vector<std::string> words;
+    std::string currentWord;
+    currentWord.reserve(16);
+    for (char ch : text) {
+        if (std::isalnum(static_cast<unsigned char>(ch))) {
+            currentWord += ch;
+        } else if (!currentWord.empty()) {
+            words.push_back(legacyToLower(currentWord));
+            currentWord.clear();
+        }
+    }
+    if (!currentWord.empty()) {
+        words.push_back(legacyToLower(currentWord));
+    }
+    return words;
+}
+
+// Helper function to build a text heavy page: a short head, a navigation
+// bar and paragraphs with the odd entity, no script or style
+static std::string makePage(int number) {
+    std::string page = "<!DOCTYPE html>\n<html><head><title>Story " + std::to_string(number) +
+                       " &amp; More</title></head><body>\n<nav>";
+    for (int i = 0; i < 10; ++i) {
+        page += "<a href=\"/section/" + std::to_string(i) + "/\">Section " + std::to_string(i) + "</a> ";
+    }
+    page += "</nav>\n<article>\n";
+    for (int i = 0; i < 40; ++i) {
+        page += "<p>The Committee met on Tuesday to discuss the proposal, a plan that would "
+                "change how the City funds its parks, libraries &amp; schools over the next decade. "
+                "Officials said the vote &lt;expected later this month&gt; could still be delayed if "
+                "<a href=\"/related/" + std::to_string(number * 100 + i) + ".html\">new objections</a> "
+                "are raised by residents.</p>\n";
+    }
+    page += "</article>\n</body></html>\n";
+    return page;
+}
+
+struct Measurement {
+    double seconds = 0;
+    size_t words = 0;
+    size_t links = 0;
+    size_t allocations = 0; // In the last pass
+    size_t bytes = 0;       // Heap bytes allocated in the last pass
+};
+
+// Helper function to print one pipeline's figures per page
+static void report(const char* name, const Measurement& m, size_t totalBytes, size_t pages) {
+    std::cout << name << ": " << totalBytes * double(PASSES) / m.seconds / 1e6 << " MB/s, "
+              << m.bytes / pages << " bytes in " << m.allocations / pages << " allocations per page ("
+              << m.words << " words, " << m.links << " links)\n";
+}
+
+// Every pipeline extracts the words and the links of each page and is
+// measured the same way: time, and what operator new was asked for
+int main() {
+    std::vector<std::string> pages;
+    for (int i = 0; i < CORPUS_PAGES; ++i) pages.push_back(makePage(i));
+    size_t totalBytes = 0;
+    for (const std::string& page : pages) totalBytes += page.size();
+    std::cout << "Corpus: " << pages.size() << " synthetic pages, " << totalBytes / 1024 << " KB\n";
+
+    Measurement legacy;
+    for (int pass = 0; pass < PASSES; ++pass) {
+        legacy.words = legacy.links = 0;
+        allocationCount = allocatedBytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const std::string& page : pages) {
+            std::vector<std::string> links;
+            std::vector<std::string> words = legacySplitIntoWords(legacyStripHTMLTags("https://example.com/", page, links));
+            legacy.words += words.size();
+            legacy.links += links.size();
+        }
+        legacy.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        legacy.allocations = allocationCount;
+        legacy.bytes = allocatedBytes;
+    }
+
+    Measurement fused;
+    for (int pass = 0; pass < PASSES; ++pass) {
+        fused.words = fused.links = 0;
+        allocationCount = allocatedBytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const std::string& page : pages) {
+            ParsedData parsed = parseHTML("https://example.com/", page);
+            fused.words += parsed.words.size();
+            fused.links += parsed.links.size();
+        }
+        fused.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        fused.allocations = allocationCount;
+        fused.bytes = allocatedBytes;
+    }
+
+    // The same pass into an arena and a ParsedPage reused from page to page;
+    // once they have grown, only setting up the parser allocates
+    Measurement arena;
+    TokenArena tokens;
+    ParsedPage parsedPage;
+    for (int pass = 0; pass < PASSES; ++pass) {
+        arena.words = arena.links = 0;
+        allocationCount = allocatedBytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const std::string& page : pages) {
+            tokens.reset();
+            parseHTML("https://example.com/", page, tokens, parsedPage);
+            arena.words += parsedPage.words.size();
+            arena.links += parsedPage.links.size();
+        }
+        arena.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        arena.allocations = allocationCount;
+        arena.bytes = allocatedBytes;
+    }
+
+    report("legacy three pass", legacy, totalBytes, pages.size());
+    report("fused single pass", fused, totalBytes, pages.size());
+    report("fused into arena", arena, totalBytes, pages.size());
+    if (legacy.words != fused.words || legacy.links != fused.links) {
+        std::cerr << "Pipelines disagree on the words or links found\n";
+    }
+    std::cout << "Heap bytes allocated: " << double(legacy.bytes) / fused.bytes << "x fewer\n";
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <iostream>
+#include <chrono>
+#include <regex>
+#include <string>
+#include <vector>
+#include "../downloader.h"
+#include "../url.h"
+
+// Copy of the original regex based getHostname from parser.cpp, kept as the baseline
+static std::string legacyGetHostname(const std::string& url) {
+    std::regex urlRegex(R"(^(https?://)?([^/]+))");
+    std::smatch match;
+    if (std::regex_search(url, match, urlRegex)) {
+        return match[2].str();
+    }
+    return "";
+}
+
+// Copies of the original substring based helpers from downloader.cpp, as
+// in the baseline. They read no port (the scheme picked it), so a host
+// keeps its ":port" and this row does a little less work than the others.
+static std::string legacyGetHostnameFromUrl(const std::string& url)
+{
+    size_t offset = 0;
+    if (url.compare(0, 8, "https://") == 0)
+        offset = 8;
+    else if (url.compare(0, 7, "http://") == 0)
+        offset = 7;
+
+    size_t pos = url.find("/", offset);
+    std::string domain = url.substr(offset, (pos == std::string::npos ? url.length() : pos) - offset);
+
+    return domain;
+}
+
+static std::string legacyGetHostPathFromUrl(const std::string& url)
+{
+    size_t offset = 0;
+    if (url.compare(0, 8, "https://") == 0)
+        offset = 8;
+    else if (url.compare(0, 7, "http://") == 0)
+        offset = 7;
+
+    size_t pos = url.find("/", offset);
+    std::string path = pos == std::string::npos ? "/" : url.substr(pos);
+
+    // Remove extra slashes
+    pos = path.find_first_not_of('/');
+    if (pos == std::string::npos)
+        path = "/";
+    else
+        path.erase(0, pos - 1);
+    return path;
+}
+
+// A mix of the URL shapes a crawl sees
+static const std::vector<std::string> SAMPLE_URLS = {
+    "https://www.example.com/",
+    "https://en.wikipedia.org/wiki/Web_crawler",
+    "http://news.example.org/2026/10/18/story-about-something-long.html?utm_source=feed&utm_medium=rss",
+    "https://shop.example.net:8443/catalog/item?id=123456#reviews",
+    "http://blog.example.io/posts/2026/an-article-title-with-many-words/",
+    "https://cdn.example.com/static/js/app.3f2a1c.js",
+    "https://docs.example.dev/guide/getting-started#installation",
+    "http://[2001:db8::1]:8080/status",
+};
+
+#define ITERATIONS 200000
+
+// Helper function to time a parse function over the sample URLs
+template <typename ParseFunction>
+static void runBenchmark(const char* name, ParseFunction parse) {
+    long long checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        checksum += parse(SAMPLE_URLS[i % SAMPLE_URLS.size()]);
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double nsPerUrl = elapsed * 1e9 / ITERATIONS;
+    std::cout << name << ": " << nsPerUrl << " ns/url (checksum " << checksum << ")\n";
+}
+
+int main() {
+    std::cout << "Parsing " << ITERATIONS << " URLs\n";
+
+    runBenchmark("regex getHostname       ", [](const std::string& url) {
+        return static_cast<long long>(legacyGetHostname(url).size());
+    });
+    runBenchmark("baseline split, no port ", [](const std::string& url) {
+        return static_cast<long long>(legacyGetHostnameFromUrl(url).size() + legacyGetHostPathFromUrl(url).size());
+    });
+    runBenchmark("downloader helpers      ", [](const std::string& url) {
+        return static_cast<long long>(getHostnameFromUrl(url).size() + getHostPathFromUrl(url).size()) +
+               getPortFromUrl(url);
+    });
+    runBenchmark("parseUrl                ", [](const std::string& url) {
+        UrlParts parts;
+        parseUrl(url, parts);
+        return static_cast<long long>(parts.host.size() + parts.path.size() + parts.query.size()) + parts.portNumber;
+    });
+
+    return 0;
+}
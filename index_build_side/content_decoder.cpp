@@ -0,0 +1,178 @@
+#include "content_decoder.h"
+
+#include <algorithm>
+#include <cctype>
+#include <zlib.h>
+#include <brotli/decode.h>
+
+// Output produced per decompression step
+#define DECODE_CHUNK_SIZE 16384
+
+ContentCoding parseContentCoding(const std::string& value) {
+    std::string coding;
+    for (char ch : value) {
+        if (ch == ' ' || ch == '\t' || ch == '\r') continue;
+        coding += static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    }
+
+    if (coding.empty() || coding == "identity") return ContentCoding::Identity;
+    if (coding == "gzip" || coding == "x-gzip") return ContentCoding::Gzip;
+    if (coding == "deflate") return ContentCoding::Deflate;
+    if (coding == "br") return ContentCoding::Brotli;
+    return ContentCoding::Unsupported;
+}
+
+const char* acceptedContentCodings() {
+    return "gzip, deflate, br";
+}
+
+ContentDecoder::~ContentDecoder() {
+    release();
+}
+
+void ContentDecoder::release() {
+    if (zlib_) {
+        inflateEnd(zlib_);
+        delete zlib_;
+        zlib_ = nullptr;
+    }
+    if (brotli_) {
+        BrotliDecoderDestroyInstance(brotli_);
+        brotli_ = nullptr;
+    }
+}
+
+bool ContentDecoder::reset(ContentCoding coding) {
+    release();
+    coding_ = coding;
+    started_ = false;
+    ended_ = false;
+
+    switch (coding) {
+        case ContentCoding::Identity:
+            return true;
+        case ContentCoding::Gzip:
+        case ContentCoding::Deflate:
+            // Deflate streams are set up on the first byte, once we know if they are zlib-wrapped
+            zlib_ = new z_stream();
+            if (coding == ContentCoding::Gzip && inflateInit2(zlib_, 15 + 16) != Z_OK) {
+                delete zlib_;
+                zlib_ = nullptr;
+                return false;
+            }
+            return true;
+        case ContentCoding::Brotli:
+            brotli_ = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+            return brotli_ != nullptr;
+        case ContentCoding::Unsupported:
+            return false;
+    }
+    return false;
+}
+
+bool ContentDecoder::feed(const char* data, size_t size, std::string& out, size_t limit) {
+    if (size == 0) return true;
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+
+    switch (coding_) {
+        case ContentCoding::Identity:
+            out.append(data, std::min(size, limit));
+            return true;
+        case ContentCoding::Gzip:
+        case ContentCoding::Deflate:
+            return feedZlib(bytes, size, out, limit);
+        case ContentCoding::Brotli:
+            return feedBrotli(bytes, size, out, limit);
+        case ContentCoding::Unsupported:
+            return false;
+    }
+    return false;
+}
+
+bool ContentDecoder::finished() const {
+    return coding_ == ContentCoding::Identity || !started_ || ended_;
+}
+
+bool ContentDecoder::feedZlib(const unsigned char* data, size_t size, std::string& out, size_t limit) {
+    if (!zlib_) return false;
+
+    if (!started_) {
+        started_ = true;
+        if (coding_ == ContentCoding::Deflate) {
+            // "deflate" should be zlib-wrapped, but many servers send a raw stream
+            bool zlibHeader = (data[0] & 0x0f) == 8 && (data[0] >> 4) <= 7;
+            if (inflateInit2(zlib_, zlibHeader ? 15 : -15) != Z_OK) {
+                return false;
+            }
+        }
+    }
+
+    if (ended_) {
+        return true; // Ignore padding some servers send after the stream
+    }
+
+    zlib_->next_in = const_cast<unsigned char*>(data);
+    zlib_->avail_in = static_cast<uInt>(size);
+
+    size_t start = out.size();
+    while (true) {
+        // A small body can inflate to any size; never produce past the limit
+        size_t room = std::min<size_t>(DECODE_CHUNK_SIZE, limit - (out.size() - start));
+        if (room == 0) return true;
+        size_t before = out.size();
+        out.resize(before + room);
+        zlib_->next_out = reinterpret_cast<unsigned char*>(&out[before]);
+        zlib_->avail_out = static_cast<uInt>(room);
+
+        int rc = inflate(zlib_, Z_NO_FLUSH);
+        bool outputFull = zlib_->avail_out == 0;
+        out.resize(before + room - zlib_->avail_out);
+
+        if (rc == Z_STREAM_END) {
+            ended_ = true;
+            return true;
+        }
+        if (rc == Z_BUF_ERROR) {
+            return true; // No progress possible until more input arrives
+        }
+        if (rc != Z_OK) {
+            return false;
+        }
+        if (!outputFull && zlib_->avail_in == 0) {
+            return true;
+        }
+    }
+}
+
+bool ContentDecoder::feedBrotli(const unsigned char* data, size_t size, std::string& out, size_t limit) {
+    if (!brotli_) return false;
+    started_ = true;
+
+    size_t availableIn = size;
+    const uint8_t* nextIn = data;
+    size_t start = out.size();
+    while (true) {
+        size_t room = std::min<size_t>(DECODE_CHUNK_SIZE, limit - (out.size() - start));
+        if (room == 0) return true;
+        size_t before = out.size();
+        out.resize(before + room);
+        size_t availableOut = room;
+        uint8_t* nextOut = reinterpret_cast<uint8_t*>(&out[before]);
+
+        BrotliDecoderResult rc = BrotliDecoderDecompressStream(brotli_, &availableIn, &nextIn,
+                                                               &availableOut, &nextOut, nullptr);
+        out.resize(before + room - availableOut);
+
+        switch (rc) {
+            case BROTLI_DECODER_RESULT_SUCCESS:
+                ended_ = true;
+                return availableIn == 0; // Trailing garbage after the stream
+            case BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT:
+                return true;
+            case BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT:
+                continue;
+            default:
+                return false;
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef CONTENT_DECODER_H
+#define CONTENT_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+struct z_stream_s;
+struct BrotliDecoderStateStruct;
+
+// Content-Encoding values the downloader can undo
+enum class ContentCoding {
+    Identity,
+    Gzip,
+    Deflate,
+    Brotli,
+    Unsupported
+};
+
+// Map a Content-Encoding header value (e.g. "gzip") to a coding
+ContentCoding parseContentCoding(const std::string& value);
+
+// Value for the Accept-Encoding request header matching what we can decode
+const char* acceptedContentCodings();
+
+// Incremental decompressor for a response body. Compressed bytes are fed
+// as they come off the wire and plain bytes are appended to the output,
+// so the body never has to be held compressed in full.
+class ContentDecoder {
+public:
+    ContentDecoder() = default;
+    ~ContentDecoder();
+
+    ContentDecoder(const ContentDecoder&) = delete;
+    ContentDecoder& operator=(const ContentDecoder&) = delete;
+
+    // Prepare for a new body; false if the coding is unsupported
+    bool reset(ContentCoding coding);
+
+    // Decode size bytes and append the output to out, but no more than limit
+    // bytes of it; false on corrupt input. Decoding stops as soon as limit is
+    // reached, so a caller that gets limit bytes back must give up on the body.
+    bool feed(const char* data, size_t size, std::string& out, size_t limit = SIZE_MAX);
+
+    // True if the compressed stream was complete (or never started) when the body ended
+    bool finished() const;
+
+    ContentCoding coding() const { return coding_; }
+
+private:
+    void release();
+    bool feedZlib(const unsigned char* data, size_t size, std::string& out, size_t limit);
+    bool feedBrotli(const unsigned char* data, size_t size, std::string& out, size_t limit);
+
+    ContentCoding coding_ = ContentCoding::Identity;
+    z_stream_s* zlib_ = nullptr;
+    BrotliDecoderStateStruct* brotli_ = nullptr;
+    bool started_ = false;   // Seen the first byte (the deflate flavour is sniffed from it)
+    bool ended_ = false;     // Compressed stream reached its end marker
+};
+
+#endif // CONTENT_DECODER_H
@@ -1,67 +1,464 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
-#include <queue>
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 #include <regex>
+#include "archive.h"
 #include "downloader.h"
+#include "fetch_engine.h"
+#include "frontier.h"
 #include "parser.h"
+#include "redirect_map.h"
+#include "resolver.h"
+#include "robots.h"
+#include "tls_context.h"
+#include "validator_store.h"
 
-// Function to process a single URL: download, parse, and extract links
-void processUrl(std::string& url, std::queue<std::string>& urlQueue, std::unordered_set<std::string>& visitedUrls) {
-    std::cout << "Crawling: " << url << std::endl;
+// Maximum number of downloads kept in flight at once
+#define MAX_CONCURRENT_FETCHES 256
+// Longest robots.txt Crawl-delay honored, in seconds
+#define MAX_CRAWL_DELAY 60
+// Size of the pieces a replayed body is parsed in, like a socket read
+#define REPLAY_CHUNK_SIZE 65536
+// Seconds a host is held back after one of its fetches timed out
+#define TIMEOUT_BACKOFF 30
+
+// Parse state of one page while its body is still downloading
+struct PageStream {
+    std::unique_ptr<HtmlStreamParser> parser;
+    TokenArena arena;                     // Holds the words until the page is done
+    std::vector<std::string_view> words;
+    bool started = false;
+    bool duplicate = false;  // Redirected onto a page that was already crawled
+    std::string body;        // Streamed body, kept when archiving
+};
+
+// URL bookkeeping shared by the callbacks of one crawl
+struct CrawlState {
+    Frontier frontier;
+    std::unordered_set<std::string> visitedUrls;
+    RobotsCache robots;
+    std::unordered_set<std::string> robotsFetches; // robots.txt URLs queued in the frontier
+    Resolver& resolver;
+    const RedirectMap& redirects;
+    bool quiet;            // Skip printing the extracted words
+    ArchiveWriter* archive; // Where fetched responses are kept, if anywhere
+    bool replaying = false; // Pages come from an archive; links are collected but not fetched
+    size_t pagesParsed = 0;
+};
+
+// Helper function to queue a URL once robots.txt allows it, resolving its
+// host while it waits in the frontier
+static void admitUrl(const std::string& url, CrawlState& state) {
+    std::string robotsUrl;
+    switch (state.robots.check(url, robotsUrl)) {
+        case RobotsVerdict::Allowed:
+            state.frontier.push(url);
+            break;
+        case RobotsVerdict::Disallowed:
+            return;
+        case RobotsVerdict::Pending:
+            // Parked until its host's rules arrive; robots.txt itself waits
+            // for a token like any other request to the host
+            if (!robotsUrl.empty()) {
+                state.robotsFetches.insert(robotsUrl);
+                state.frontier.push(robotsUrl);
+            }
+            break;
+    }
+    state.resolver.prefetch(getHostnameFromUrl(url));
+}
+
+// Helper function to queue a link under the URL it is known to redirect to
+static void enqueueLink(const std::string& link, CrawlState& state) {
+    if (!state.visitedUrls.insert(link).second) return;
+    if (state.replaying) return;
+    std::string target = state.redirects.resolve(link);
+    if (target != link && !state.visitedUrls.insert(target).second) return;
+    admitUrl(target, state);
+}
 
-    // Download the page
-    Response response = downloadPage(url);
+// Helper function to set up parsing once the final URL of a page is known
+static void startPage(PageStream& page, const std::string& url, const Response& response, CrawlState& state) {
+    page.started = true;
+
+    // A redirect may land on a page that was already crawled under its own URL
+    const std::string& pageUrl = response.finalUrl.empty() ? url : response.finalUrl;
+    if (pageUrl != url && !state.visitedUrls.insert(pageUrl).second) {
+        page.duplicate = true;
+        return;
+    }
+
+    // Relative links resolve against the final URL; links are queued as soon
+    // as they are seen so their fetches can start before this page finishes
+    std::vector<std::string_view>& words = page.words;
+    TokenArena& arena = page.arena;
+    page.parser.reset(new HtmlStreamParser(pageUrl,
+        HtmlStreamParser::WordViewCallback(
+            [&words, &arena](std::string_view word) { words.push_back(arena.store(word)); }),
+        [&state](const std::string& link) { enqueueLink(link, state); }));
+}
+
+// Function to parse the next piece of a page while it downloads
+void parseChunk(PageStream& page, const std::string& url, const Response& response, const char* data, size_t size, CrawlState& state) {
+    if (state.archive) {
+        page.body.append(data, size);
+    }
+    if (response.header.status != 200) return;
+    if (!page.started) {
+        startPage(page, url, response, state);
+    }
+    if (page.parser) {
+        page.parser->feed(data, size);
+    }
+}
+
+// Function to finish a single downloaded URL once its fetch completes
+void processUrl(const std::string& url, Response& response, PageStream& page, CrawlState& state) {
+    std::cout << "Crawling: " << url << std::endl;
 
     // Check if the download was successful
+    if (response.error == FetchError::Rejected) {
+        std::cout << "Skipped: " << url << " (" << rejectionName(response.rejection) << ")" << std::endl;
+        return;
+    }
+    if (response.error == FetchError::Timeout) {
+        // A stalling host would tie up slots again at once; give it a rest
+        std::cerr << "Failed to fetch URL: " << url << " (timeout: " << timeoutPhaseName(response.timeout) << ")" << std::endl;
+        state.frontier.backOff(url, TIMEOUT_BACKOFF);
+        return;
+    }
+    if (response.error != FetchError::None) {
+        std::cerr << "Failed to fetch URL: " << url << " (" << fetchErrorName(response.error) << ")" << std::endl;
+        return;
+    }
+    if (response.notModified) {
+        // Unchanged since the last crawl; nothing new to parse
+        std::cout << "Not modified: " << url << std::endl;
+        return;
+    }
+    if (state.archive) {
+        // Streamed bodies were kept piece by piece; the rest arrive whole
+        std::string body = page.body.empty() ? response.body : std::move(page.body);
+        state.archive->append(response.finalUrl.empty() ? url : response.finalUrl, response, std::move(body));
+    }
     if (response.header.status != 200) {
         std::cerr << "Failed to fetch URL: " << url << " (HTTP " << response.header.status << ")" << std::endl;
         return;
     }
 
-    // Parse the HTML content
-    ParsedData parsedData = parseHTML(url, response.body);
+    // Pages with an empty body never streamed a piece
+    if (!page.started) {
+        startPage(page, url, response, state);
+    }
+    if (page.duplicate) {
+        std::cout << "Already crawled: " << response.finalUrl << " (redirected from " << url << ")" << std::endl;
+        return;
+    }
+    page.parser->finish();
+    ++state.pagesParsed;
+    if (state.quiet) return;
 
     // Output extracted words
     std::cout << "Extracted Words:" << std::endl;
-    for (const std::string& word : parsedData.words) {
+    for (std::string_view word : page.words) {
         std::cout << word << " ";
     }
     std::cout << std::endl;
+}
 
-    // Enqueue extracted links
-    for (const std::string& link : parsedData.links) {
-        if (visitedUrls.find(link) == visitedUrls.end()) {
-            urlQueue.push(link);
-            visitedUrls.insert(link);
-        }
+// Function to apply a fetched robots.txt: release the URLs that waited for it
+// and slow the host down to its Crawl-delay
+void processRobots(const std::string& robotsUrl, const Response& response, CrawlState& state) {
+    for (const std::string& url : state.robots.store(robotsUrl, response)) {
+        state.frontier.push(url);
+    }
+    const RobotsRules* rules = state.robots.rulesFor(robotsUrl);
+    if (rules && rules->crawlDelay() > 0) {
+        state.frontier.setCrawlDelay(robotsUrl, std::min(rules->crawlDelay(), static_cast<double>(MAX_CRAWL_DELAY)));
     }
 }
 
-// Function to crawl URLs starting from the initial URL
-void crawl(const std::string& startUrl) {
-    std::queue<std::string> urlQueue;
-    std::unordered_set<std::string> visitedUrls;
+// Settings for one crawl, taken from the command line
+struct CrawlOptions {
+    std::string validatorFile; // Conditional re-fetch state kept between crawls
+    std::string redirectFile;  // Permanent redirects kept between crawls
+    FrontierOptions frontier;  // Per-host request rate
+    std::vector<std::pair<std::string, std::string>> resolveOverrides; // Hostname pattern and addresses, as from --resolve
+    bool quiet = false;        // Print progress and statistics but not the extracted words
+    std::string archiveDir;    // Directory to archive fetched responses in
+    std::string replayDir;     // Archive to parse instead of fetching from the network
+    bool ioUring = false;      // Drive sockets through io_uring instead of epoll
+};
+
+// Function to crawl URLs starting from the initial URL.
+// With a validator file, every page remembered from earlier crawls is
+// revisited with a conditional request and unchanged pages are skipped.
+// With a redirect file, permanent redirects learned earlier are reused.
+void crawl(const std::string& startUrl, const CrawlOptions& crawlOptions) {
+    const std::string& validatorFile = crawlOptions.validatorFile;
+    const std::string& redirectFile = crawlOptions.redirectFile;
+
+    ValidatorStore validators;
+    bool validatorsLoaded = !validatorFile.empty() && validators.load(validatorFile);
+
+    Resolver resolver;
+    for (const auto& entry : crawlOptions.resolveOverrides) {
+        if (!resolver.addOverride(entry.first, entry.second)) {
+            std::cerr << "Ignoring --resolve " << entry.first << ":" << entry.second << std::endl;
+        }
+    }
+    FetchEngineOptions options;
+    options.maxConnections = MAX_CONCURRENT_FETCHES;
+    if (crawlOptions.ioUring) options.ioBackend = IoBackend::IoUring;
+    FetchEngine engine(options, &resolver);
+    if (!validatorFile.empty()) engine.setValidatorStore(&validators);
+    if (!redirectFile.empty()) engine.redirectMap().load(redirectFile);
+    // robots.txt is served as text/plain, which pages are not allowed to be
+    AdmissionPolicy robotsAdmission;
+    robotsAdmission.allow("text/plain", ROBOTS_MAX_SIZE);
+
+    std::unique_ptr<ArchiveWriter> archive;
+    if (!crawlOptions.archiveDir.empty()) {
+        ArchiveOptions archiveOptions;
+        archiveOptions.directory = crawlOptions.archiveDir;
+        archive.reset(new ArchiveWriter(archiveOptions));
+        if (!archive->open()) archive.reset();
+    }
+
+    CrawlState state{Frontier(crawlOptions.frontier), {}, RobotsCache(options.userAgent), {}, resolver, engine.redirectMap(), crawlOptions.quiet, archive.get()};
+    auto crawlStart = std::chrono::steady_clock::now();
 
     // Start with the initial URL
-    urlQueue.push(startUrl);
-    visitedUrls.insert(startUrl);
+    state.visitedUrls.insert(startUrl);
+    admitUrl(startUrl, state);
 
-    while (!urlQueue.empty()) {
-        std::string currentUrl = urlQueue.front();
-        urlQueue.pop();
-        processUrl(currentUrl, urlQueue, visitedUrls);
+    if (validatorsLoaded) {
+        for (const std::string& url : validators.urls()) {
+            if (state.visitedUrls.insert(url).second) admitUrl(url, state);
+        }
+    }
+
+    size_t notModified = 0;
+    // Keep the engine supplied from whichever hosts are allowed a request;
+    // completions add links to the frontier from poll()
+    while (!state.frontier.empty() || engine.inFlight() > 0) {
+        std::string url;
+        while (engine.hasCapacity() && state.frontier.pop(url)) {
+            if (state.robotsFetches.erase(url)) {
+                engine.submit(url, [&](const std::string& url, Response& response) {
+                    // Rules are re-read on every crawl rather than revalidated
+                    validators.forget(url);
+                    processRobots(url, response, state);
+                }, nullptr, &robotsAdmission);
+                continue;
+            }
+            // Bodies are parsed piece by piece as they arrive instead of
+            // being buffered whole until the fetch completes
+            auto page = std::make_shared<PageStream>();
+            engine.submit(url,
+                [&, page](const std::string& url, Response& response) {
+                    if (response.notModified) ++notModified;
+                    processUrl(url, response, *page, state);
+                },
+                [&, page, url](const Response& response, const char* data, size_t size) {
+                    parseChunk(*page, url, response, data, size, state);
+                });
+        }
+
+        // Sleep no longer than the next host's wait for a token
+        int wait = engine.hasCapacity() ? state.frontier.msUntilReady() : -1;
+        if (engine.inFlight() == 0 && wait > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(wait));
+        } else {
+            engine.poll(wait);
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - crawlStart).count();
+    std::cout << "Crawled " << state.pagesParsed << " pages in " << seconds << " s ("
+              << (seconds > 0 ? state.pagesParsed / seconds : 0) << " pages/s)" << std::endl;
+
+    TlsStats tls = tlsStats();
+    std::cout << "TLS handshakes: " << tls.fullHandshakes << " full, "
+              << tls.resumedHandshakes << " resumed" << std::endl;
+
+    ResolverStats dns = resolver.stats();
+    std::cout << "DNS: " << dns.lookups << " lookups, " << dns.cacheHits << " cache hits, "
+              << dns.prefetches << " prefetches, " << dns.failures << " failures" << std::endl;
+
+    std::cout << "Frontier: " << state.frontier.hosts() << " hosts" << std::endl;
+
+    if (engine.usingIoUring()) {
+        IoRingStats ring = engine.ioRingStats();
+        std::cout << "io_uring: " << ring.submissions << " submissions in " << ring.enters << " enters, "
+                  << ring.bufferShortages << " buffer shortages" << std::endl;
+    }
+
+    const RobotsStats& robots = state.robots.stats();
+    std::cout << "Robots: " << robots.fetched << " fetched, " << robots.allowed << " allowed, "
+              << robots.disallowed << " disallowed" << std::endl;
+
+    const AdmissionStats& admission = engine.admissionStats();
+    std::cout << "Admission: " << admission.admitted << " admitted, " << admission.contentType << " wrong type, "
+              << admission.declaredLength << " too large, " << admission.bodyLimit << " cut off" << std::endl;
+
+    const TimeoutStats& timeouts = engine.timeoutStats();
+    std::cout << "Timeouts: " << timeouts.resolve << " dns, " << timeouts.connect << " connect, " << timeouts.tls
+              << " tls, " << timeouts.firstByte << " first byte, " << timeouts.read << " read, " << timeouts.total
+              << " total" << std::endl;
+
+    const ConnectStats& connects = engine.connectStats();
+    std::cout << "Connects: " << connects.attempts << " attempts, " << connects.fallbacks
+              << " won by a later address, " << connects.ipv6 << " over IPv6" << std::endl;
+
+    if (archive) {
+        archive->close();
+        ArchiveStats stored = archive->stats();
+        std::cout << "Archive: " << stored.records << " records, " << stored.dropped << " dropped, "
+                  << stored.rawBytes / 1024 << " KB compressed to " << stored.diskBytes / 1024 << " KB in "
+                  << stored.files << " files" << std::endl;
+    }
+
+    if (!validatorFile.empty()) {
+        std::cout << "Conditional fetches: " << notModified << " not modified" << std::endl;
+        if (!validators.save(validatorFile)) {
+            std::cerr << "Failed to save validators to " << validatorFile << std::endl;
+        }
+    }
+    if (!redirectFile.empty()) {
+        std::cout << "Redirects known: " << engine.redirectMap().size() << std::endl;
+        if (!engine.redirectMap().save(redirectFile)) {
+            std::cerr << "Failed to save redirects to " << redirectFile << std::endl;
+        }
     }
 }
 
+// Function to run the page pipeline over an archive written with --archive,
+// without sockets or DNS. Every archived URL is parsed once, from its most
+// recent record, in archive order, so runs are repeatable and measure the
+// parsing side alone.
+void replay(const CrawlOptions& crawlOptions) {
+    ArchiveReader reader;
+    if (!reader.open(crawlOptions.replayDir)) {
+        return;
+    }
+
+    // Later crawls into the same directory supersede earlier records
+    std::unordered_map<std::string, size_t> latest;
+    const std::vector<ArchiveEntry>& entries = reader.entries();
+    for (size_t i = 0; i < entries.size(); ++i) {
+        latest[entries[i].url] = i;
+    }
+
+    Resolver resolver;    // Never queried while replaying
+    RedirectMap redirects;
+    CrawlState state{Frontier(crawlOptions.frontier), {}, RobotsCache(FetchEngineOptions().userAgent), {},
+                     resolver, redirects, crawlOptions.quiet, nullptr};
+    state.replaying = true;
+
+    size_t records = 0;
+    unsigned long long bytes = 0;
+    auto replayStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const ArchiveEntry& entry = entries[i];
+        if (latest[entry.url] != i) continue;
+
+        Response response;
+        if (!reader.read(entry, response)) {
+            std::cerr << "Failed to read archived URL: " << entry.url << std::endl;
+            continue;
+        }
+        ++records;
+        bytes += response.body.size();
+        state.visitedUrls.insert(entry.url);
+
+        // Hand the body over in read-sized pieces, the way the engine streams it
+        PageStream page;
+        if (response.header.status >= 200 && response.header.status < 300) {
+            std::string body = std::move(response.body);
+            response.body.clear();
+            for (size_t offset = 0; offset < body.size(); offset += REPLAY_CHUNK_SIZE) {
+                parseChunk(page, entry.url, response, body.data() + offset,
+                           std::min(static_cast<size_t>(REPLAY_CHUNK_SIZE), body.size() - offset), state);
+            }
+        }
+        processUrl(entry.url, response, page, state);
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - replayStart).count();
+    std::cout << "Replayed " << records << " records (" << bytes / 1024 << " KB) and parsed " << state.pagesParsed
+              << " pages in " << seconds << " s (" << (seconds > 0 ? state.pagesParsed / seconds : 0) << " pages/s, "
+              << (seconds > 0 ? bytes / seconds / 1e6 : 0) << " MB/s)" << std::endl;
+    std::cout << "Links seen: " << state.visitedUrls.size() << std::endl;
+}
+
 int main(int argc, char** argv) {
-    if (argc != 2) {
-        std::cerr << "Usage: " << argv[0] << " <URL>" << std::endl;
+    std::string startUrl;
+    CrawlOptions options;
+    bool usageError = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--validators" && i + 1 < argc) {
+            options.validatorFile = argv[++i];
+        } else if (arg == "--redirects" && i + 1 < argc) {
+            options.redirectFile = argv[++i];
+        } else if (arg == "--host-rate" && i + 1 < argc) {
+            options.frontier.requestsPerSecond = std::atof(argv[++i]);
+        } else if (arg == "--resolve" && i + 1 < argc) {
+            // HOST:ADDRESS[,ADDRESS...], where HOST may be a "*.suffix" wildcard and
+            // an ADDRESS an IPv6 literal (split at the first colon, so that still works)
+            std::string entry = argv[++i];
+            size_t colon = entry.find(':');
+            if (colon == std::string::npos) {
+                std::cerr << "--resolve expects HOST:ADDRESS" << std::endl;
+                return EXIT_FAILURE;
+            }
+            options.resolveOverrides.emplace_back(entry.substr(0, colon), entry.substr(colon + 1));
+        } else if (arg == "--replay" && i + 1 < argc) {
+            options.replayDir = argv[++i];
+        } else if (arg == "--archive" && i + 1 < argc) {
+            options.archiveDir = argv[++i];
+        } else if (arg == "--io-uring") {
+            options.ioUring = true;
+        } else if (arg == "--quiet") {
+            options.quiet = true;
+        } else if (startUrl.empty() && arg.compare(0, 2, "--") != 0) {
+            startUrl = arg;
+        } else {
+            usageError = true;
+            break;
+        }
+    }
+    // Either crawl from a URL or replay an archive
+    if (usageError || startUrl.empty() == options.replayDir.empty()) {
+        std::cerr << "Usage: " << argv[0] << " <URL> [--validators FILE] [--redirects FILE] [--host-rate REQUESTS_PER_SECOND]"
+                  << " [--resolve HOST:ADDRESS]... [--archive DIR] [--io-uring] [--quiet]" << std::endl;
+        std::cerr << "       " << argv[0] << " --replay DIR [--quiet]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (!options.replayDir.empty() && !options.archiveDir.empty()) {
+        std::cerr << "--archive cannot be combined with --replay" << std::endl;
         return EXIT_FAILURE;
     }
 
-    std::string startUrl = argv[1];
-    crawl(startUrl);
+    if (options.frontier.requestsPerSecond <= 0) {
+        std::cerr << "--host-rate must be positive" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (!options.replayDir.empty()) {
+        replay(options);
+    } else {
+        crawl(startUrl, options);
+    }
 
     return EXIT_SUCCESS;
 }
@@ -7,26 +7,89 @@
 struct ResponseHeader {
     int status = 0; // HTTP status code (e.g., 200, 404, 301)
     std::string contentType; // Content-Type of the response (e.g., text/html)
-    int contentLength = -1; // Content-Length of the response body (-1 if not provided)
+    long long contentLength = -1; // Content-Length of the response body (-1 if not provided)
+    std::string transferEncoding; // Transfer-Encoding of the response (e.g. chunked)
+    std::string contentEncoding; // Content-Encoding of the body (e.g. gzip); the body is stored decoded
+    std::string location; // Location (redirect target), as sent
+    std::string etag; // ETag validator
+    std::string lastModified; // Last-Modified validator
+    bool keepAlive = false; // Whether the server lets the connection be reused
+};
+
+// Reason a fetch ended without a usable response
+enum class FetchError {
+    None,       // The server answered (check header.status)
+    InvalidUrl, // Unsupported scheme or malformed URL
+    Resolve,    // Hostname lookup failed
+    Connect,    // TCP connection could not be established
+    Tls,        // TLS handshake failed
+    Send,       // Writing the request failed
+    Receive,    // Reading the response failed
+    Redirect,   // Redirect loop or too many hops
+    Decode,     // Body used an unknown or corrupt Content-Encoding
+    Rejected,   // Turned away by the admission check (see Response::rejection)
+    Timeout     // A deadline passed (see Response::timeout)
+};
+
+// Why the admission check stopped a download
+enum class Rejection {
+    None,
+    ContentType,    // Content-Type is not one we parse
+    DeclaredLength, // Content-Length is over the byte budget for the type
+    BodyLimit       // Body grew past the byte budget while downloading
+};
+
+// Which deadline a fetch overran
+enum class TimeoutPhase {
+    None,
+    Resolve,   // DNS lookup
+    Connect,   // TCP handshake
+    Tls,       // TLS handshake
+    FirstByte, // From sending the request to the first byte of the response
+    Read,      // Silence between two reads once the response started
+    Total      // The whole fetch, redirects included
 };
 
 // Struct to represent the entire HTTP/HTTPS response
 struct Response {
     ResponseHeader header; // Parsed response header
-    std::string body;      // Response body content
+    std::string rawHeader; // Header block as received, status line through the blank line
+    std::string body;      // Response body content (empty when it was streamed to a FetchEngine BodyCallback)
+    FetchError error = FetchError::None; // Set when the fetch failed before a response arrived
+    std::string finalUrl;  // URL the response came from, after redirects
+    bool notModified = false; // 304 to a conditional re-fetch: the stored copy is still current
+    Rejection rejection = Rejection::None; // Reason for FetchError::Rejected
+    TimeoutPhase timeout = TimeoutPhase::None; // Deadline behind FetchError::Timeout
 };
 
+// Short human readable name for a fetch error (e.g. "connect")
+const char* fetchErrorName(FetchError error);
+
+// Short human readable name for an admission rejection (e.g. "content type")
+const char* rejectionName(Rejection rejection);
+
+// Short human readable name for a timeout phase (e.g. "first byte")
+const char* timeoutPhaseName(TimeoutPhase phase);
+
+class HttpHeaderParser;
+
+// Build a ResponseHeader from a parser that has seen the whole header
+ResponseHeader makeResponseHeader(const HttpHeaderParser& parser);
+
+// Parse a complete header block (status line through the blank line)
 ResponseHeader handle_response(const std::string& response);
 
 // Functions for downloading content
 Response httpDownloader(std::string& url);
 Response httpsDownloader(std::string& url);
 
-// Utility functions for parsing URLs
-std::string getHostnameFromUrl(const std::string& url);
-std::string getHostPathFromUrl(const std::string& url);
+// Utility functions for parsing URLs (see url.h to get every part from one parse)
+std::string getHostnameFromUrl(const std::string& url); // Without the port
+std::string getHostPathFromUrl(const std::string& url); // Path and query, as sent in the request line
+int getPortFromUrl(const std::string& url); // Explicit port, else 80 / 443 by scheme; -1 if malformed
 
-// Function to download a page (HTTP or HTTPS)
+// Function to download a page (HTTP or HTTPS), blocking until it completes.
+// Use FetchEngine (fetch_engine.h) to keep many downloads in flight at once.
 Response downloadPage(std::string& url);
 
 
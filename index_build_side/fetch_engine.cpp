@@ -0,0 +1,1428 @@
+#include "fetch_engine.h"
+#include "content_decoder.h"
+#include "http_framing.h"
+#include "http_header_parser.h"
+#include "redirect_map.h"
+#include "resolver.h"
+#include "tls_context.h"
+#include "url.h"
+#include "validator_store.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <netinet/in.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+
+// Largest single read from a socket
+#define READ_SIZE 65536
+// Cap on how much body space a Content-Length header may reserve up front
+#define MAX_PRESIZE (16 * 1024 * 1024)
+#define MAX_EVENTS 256
+// io_uring backend: submission queue entries, and the receive buffers shared by all connections
+#define RING_ENTRIES 1024
+#define RING_BUFFER_COUNT 512
+#define RING_BUFFER_SIZE 16384
+// Deadline timers: resolution, and slots in one turn of the wheel (about 10 s)
+#define TIMER_TICK_MS 10
+#define TIMER_SLOTS 1024
+// Low half of a timer key naming a DNS lookup instead of a connection
+#define LOOKUP_TIMER 0xffffffffu
+
+// Non-blocking I/O results besides a byte count (>0) or EOF (0)
+#define IO_WANT_READ -1
+#define IO_WANT_WRITE -2
+#define IO_ERROR -3
+
+enum class ConnState {
+    Connecting,  // Waiting for one of the racing connect attempts to succeed
+    Handshaking, // TLS handshake in progress
+    Sending,     // Writing the current fetch's request
+    Receiving,   // Reading the current fetch's response
+    Idle         // Pooled keep-alive connection without a fetch
+};
+
+// What an io_uring completion belongs to, packed into its user data next to
+// the connection serial and socket fd (serial 0 is the resolver's eventfd)
+enum class RingOp : uint8_t {
+    Connect = 1,
+    Send,
+    Recv,
+    Poll
+};
+#define RING_FD_BITS 24
+
+static uint64_t ringData(uint32_t serial, int fd, RingOp op) {
+    return (static_cast<uint64_t>(serial) << 32) | (static_cast<uint64_t>(op) << RING_FD_BITS) | static_cast<uint32_t>(fd);
+}
+
+struct FetchEngine::Fetch {
+    std::string requestedUrl; // As submitted; reported to the callback
+    std::string url;          // Currently fetched, after redirects
+    FetchCallback onComplete;
+    BodyCallback onBody;
+    const AdmissionPolicy* admission = nullptr; // Replaces the engine's policy when set
+    bool streaming = false;  // Current response's body goes to onBody instead of response.body
+    bool https = false;
+    std::string hostname;    // Without the port; looked up in DNS and sent as SNI
+    int port = 0;
+    std::string hostKey;     // scheme://host[:port], the connection pool key
+    std::string request;
+    Response response;
+    bool retried = false;    // Already re-sent after a stale keep-alive connection
+    bool conditional = false; // Request carries cache validators
+    std::vector<std::string> redirectChain; // URLs already visited by this fetch, for loop detection
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max(); // End of the total budget
+};
+
+struct FetchEngine::Connection {
+    int fd = -1;                         // The socket that won the connect race; -1 while connecting
+    uint32_t serial = 0;                 // Tells a reused fd number apart in stale epoll events
+    SSL* ssl = nullptr;
+    bool https = false;
+    std::string hostname;
+    int port = 0;
+    std::string hostKey;
+    ConnState state = ConnState::Connecting;
+    uint32_t events = 0;                 // Interest currently registered with epoll
+    std::unique_ptr<Fetch> fetch;        // Request currently using the connection
+    size_t requestSent = 0;
+    std::string headerBuffer;            // Partial header carried over between reads
+    HttpHeaderParser headerParser;       // Resumes across reads, so a split header is scanned once
+    bool headerParsed = false;
+    bool receivedAny = false;            // Any byte of the current response arrived
+    bool keepAlive = false;              // Connection may be reused after this response
+    BodyFramer framer;
+    bool malformed = false;              // Response header could not be parsed
+    ContentDecoder decoder;
+    std::string framed;                  // De-framed body bytes waiting to be decompressed
+    bool decodeFailed = false;
+    size_t bodyBudget = 0;               // Most decoded body bytes the admission check allows
+    size_t bodyReceived = 0;             // Decoded body bytes delivered so far
+    Rejection rejection = Rejection::None;
+    size_t requestsServed = 0;           // Responses completed on this connection
+    std::chrono::steady_clock::time_point idleSince;
+    std::list<Connection*>::iterator idlePos;
+    std::chrono::steady_clock::time_point phaseStart; // Connect, handshake or request began
+    std::chrono::steady_clock::time_point lastRead;   // Latest response bytes arrived
+    TimerWheel::TimerId timer = 0;       // Pending deadline timer; re-checked when it fires
+    std::chrono::steady_clock::time_point timerDue;
+    std::vector<HostAddress> candidates; // Addresses to connect to, in attempt order; never resized
+    size_t nextCandidate = 0;            // First address not tried yet
+    std::vector<std::pair<int, size_t>> attempts; // Sockets with a connect in flight, and their candidate
+    std::chrono::steady_clock::time_point nextAttempt; // When the next address joins the race
+
+    // io_uring backend only
+    unsigned ringOps = 0;                // Submissions whose completion has not arrived
+    bool recvArmed = false;
+    bool sendArmed = false;
+    bool rxEof = false;                  // The peer closed its side
+    const char* rxData = nullptr;        // Received bytes the state machine has not read yet
+    size_t rxSize = 0;
+    std::string rxSpill;                 // Holds rxData once its ring buffer has been given back
+    std::string sending;                 // Bytes of the send in flight
+    size_t sendOffset = 0;
+    std::string outbound;                // Bytes written while a send was in flight
+};
+
+// Read from the socket or TLS stream without blocking. Under io_uring the
+// "socket" is the bytes the last receive completion delivered.
+ssize_t FetchEngine::transportRead(Connection& conn, char* buffer, size_t size) {
+    SSL* ssl = conn.ssl;
+    if (ssl) {
+        int n = SSL_read(ssl, buffer, static_cast<int>(size));
+        if (n > 0) return n;
+        switch (SSL_get_error(ssl, n)) {
+            case SSL_ERROR_WANT_READ: return IO_WANT_READ;
+            case SSL_ERROR_WANT_WRITE: return IO_WANT_WRITE;
+            case SSL_ERROR_ZERO_RETURN: return 0;
+            // Many servers close without a close_notify alert
+            case SSL_ERROR_SYSCALL: return ERR_peek_error() == 0 ? 0 : IO_ERROR;
+            default: return IO_ERROR;
+        }
+    }
+
+    if (ring_) {
+        if (conn.rxSize == 0) return conn.rxEof ? 0 : IO_WANT_READ;
+        size_t n = std::min(size, conn.rxSize);
+        std::memcpy(buffer, conn.rxData, n);
+        conn.rxData += n;
+        conn.rxSize -= n;
+        if (conn.rxSize == 0) conn.rxSpill.clear();
+        return n;
+    }
+
+    ssize_t n = recv(conn.fd, buffer, size, 0);
+    if (n >= 0) return n;
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return IO_WANT_READ;
+    return IO_ERROR;
+}
+
+// Write to the socket or TLS stream without blocking. Under io_uring writes
+// only collect in memory; flushRing() sends them once the state machine waits.
+ssize_t FetchEngine::transportWrite(Connection& conn, const char* data, size_t size) {
+    SSL* ssl = conn.ssl;
+    if (ssl) {
+        int n = SSL_write(ssl, data, static_cast<int>(size));
+        if (n > 0) return n;
+        switch (SSL_get_error(ssl, n)) {
+            case SSL_ERROR_WANT_READ: return IO_WANT_READ;
+            case SSL_ERROR_WANT_WRITE: return IO_WANT_WRITE;
+            default: return IO_ERROR;
+        }
+    }
+
+    if (ring_) {
+        conn.outbound.append(data, size);
+        return size;
+    }
+
+    ssize_t n = send(conn.fd, data, size, MSG_NOSIGNAL);
+    if (n >= 0) return n;
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return IO_WANT_WRITE;
+    return IO_ERROR;
+}
+
+// Pick how the response body is delimited from its status and headers
+static BodyFraming chooseFraming(const ResponseHeader& header) {
+    if (header.status == 204 || header.status == 304 || (header.status >= 100 && header.status < 200)) {
+        return BodyFraming::None;
+    }
+
+    std::string encoding = header.transferEncoding;
+    std::transform(encoding.begin(), encoding.end(), encoding.begin(),
+                   [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+    if (encoding.find("chunked") != std::string::npos) {
+        return BodyFraming::Chunked;
+    }
+    if (header.contentLength >= 0) {
+        return BodyFraming::ContentLength;
+    }
+    return BodyFraming::UntilClose;
+}
+
+FetchEngine::FetchEngine(const FetchEngineOptions& options, Resolver* resolver)
+    : options_(options), epollFd_(epoll_create1(EPOLL_CLOEXEC)), resolver_(resolver), timers_(TIMER_TICK_MS, TIMER_SLOTS) {
+    if (options_.maxConnections == 0) options_.maxConnections = 1;
+    if (options_.maxConnectionsPerHost == 0) options_.maxConnectionsPerHost = 1;
+    readBuffer_.resize(READ_SIZE);
+
+    if (!resolver_) {
+        ownedResolver_ = std::make_unique<Resolver>();
+        resolver_ = ownedResolver_.get();
+    }
+
+    // Finished lookups wake up epoll_wait; serial 0 never names a connection
+    struct epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = static_cast<uint32_t>(resolver_->notifyFd());
+    epoll_ctl(epollFd_, EPOLL_CTL_ADD, resolver_->notifyFd(), &event);
+
+    if (options_.ioBackend == IoBackend::IoUring) {
+        ring_ = std::make_unique<IoRing>();
+        if (ring_->init(RING_ENTRIES, RING_BUFFER_COUNT, RING_BUFFER_SIZE)) {
+            ring_->prepPollIn(resolver_->notifyFd(), ringData(0, resolver_->notifyFd(), RingOp::Poll));
+        } else {
+            std::cerr << "io_uring unavailable (" << ring_->error() << "), using epoll" << std::endl;
+            ring_.reset();
+        }
+    }
+
+    // A peer resetting a TLS connection must not kill the crawler
+    std::signal(SIGPIPE, SIG_IGN);
+}
+
+FetchEngine::~FetchEngine() {
+    for (auto& entry : connections_) {
+        Connection& conn = *entry.second;
+        if (conn.ssl) SSL_free(conn.ssl);
+        for (const auto& attempt : conn.attempts) closeAttempt(attempt.first);
+        if (conn.fd != -1) closeAttempt(conn.fd);
+    }
+    if (epollFd_ != -1) close(epollFd_);
+}
+
+void FetchEngine::submit(const std::string& url, FetchCallback onComplete, BodyCallback onBody,
+                         const AdmissionPolicy* admission) {
+    ++fetchesInFlight_;
+
+    auto fetch = std::make_unique<Fetch>();
+    fetch->requestedUrl = url;
+    fetch->url = redirects_.resolve(url); // Skip redirects we already know about
+    fetch->onComplete = std::move(onComplete);
+    fetch->onBody = std::move(onBody);
+    fetch->admission = admission;
+    start(std::move(fetch));
+}
+
+// Build the request for fetch->url and send it on its way
+void FetchEngine::start(std::unique_ptr<Fetch> fetch) {
+    const std::string& url = fetch->url;
+    UrlParts parts;
+    bool valid = parseUrl(url, parts);
+    fetch->https = equalsIgnoreCase(parts.scheme, "https");
+    if (!valid || (!fetch->https && !equalsIgnoreCase(parts.scheme, "http"))) {
+        complete(std::move(fetch), FetchError::InvalidUrl);
+        return;
+    }
+    fetch->hostname.assign(parts.host);
+    fetch->port = parts.portNumber;
+
+    // The port only appears in Host when it is not the scheme's default
+    std::string authority = fetch->hostname;
+    if (fetch->port != (fetch->https ? 443 : 80)) {
+        authority += ":" + std::to_string(fetch->port);
+    }
+    fetch->hostKey = (fetch->https ? "https://" : "http://") + authority;
+    fetch->conditional = false;
+    fetch->streaming = false;
+    fetch->request = "GET ";
+    appendRequestTarget(parts, fetch->request);
+    fetch->request += " HTTP/1.1\r\nHost: " + authority + "\r\n";
+    if (!options_.userAgent.empty()) {
+        fetch->request += "User-Agent: " + options_.userAgent + "\r\n";
+    }
+    if (options_.acceptCompressed) {
+        fetch->request += std::string("Accept-Encoding: ") + acceptedContentCodings() + "\r\n";
+    }
+    Validators validators;
+    if (validators_ && validators_->lookup(url, validators)) {
+        if (!validators.etag.empty()) {
+            fetch->request += "If-None-Match: " + validators.etag + "\r\n";
+        }
+        if (!validators.lastModified.empty()) {
+            fetch->request += "If-Modified-Since: " + validators.lastModified + "\r\n";
+        }
+        fetch->conditional = true;
+    }
+    fetch->request += "\r\n";
+
+    dispatch(std::move(fetch));
+}
+
+// Hand a fetch to an idle pooled connection, a new connection, or a wait queue
+void FetchEngine::dispatch(std::unique_ptr<Fetch> fetch, bool allowReuse) {
+    std::string hostKey = fetch->hostKey;
+    HostPool* pool = &hosts_[hostKey];
+
+    if (!pool->idle.empty()) {
+        if (allowReuse) {
+            Connection* conn = pool->idle.back(); // Most recently used is least likely to be stale
+            pool->idle.pop_back();
+            idle_.erase(conn->idlePos);
+            assign(*conn, std::move(fetch));
+            return;
+        }
+
+        // A reused connection to this host just went stale; the others likely are too
+        while (!pool->idle.empty()) {
+            closeConnection(*pool->idle.front());
+        }
+        pool = &hosts_[hostKey];
+    }
+
+    if (pool->open >= options_.maxConnectionsPerHost) {
+        pool->waiting.push_back(std::move(fetch));
+        hostsWaiting_.insert(hostKey);
+        return;
+    }
+    if (connections_.size() >= options_.maxConnections && !evictOldestIdle()) {
+        pending_.push_back(std::move(fetch));
+        return;
+    }
+
+    connectNew(hosts_[hostKey], std::move(fetch));
+}
+
+// Helper function to order a host's addresses for Happy Eyeballs: the
+// families alternate (RFC 8305 section 4), starting with the resolver's
+// first, so a family that is broken on this network delays the other by
+// only one attempt. The port is filled in here.
+static std::vector<HostAddress> attemptOrder(const std::vector<HostAddress>& addresses, int port) {
+    std::vector<HostAddress> first, second;
+    for (const HostAddress& address : addresses) {
+        bool sameFamily = address.addr.ss_family == addresses.front().addr.ss_family;
+        (sameFamily ? first : second).push_back(address);
+    }
+
+    std::vector<HostAddress> ordered;
+    for (size_t i = 0; i < std::max(first.size(), second.size()); ++i) {
+        if (i < first.size()) ordered.push_back(first[i]);
+        if (i < second.size()) ordered.push_back(second[i]);
+    }
+    for (HostAddress& address : ordered) {
+        auto* v4 = reinterpret_cast<sockaddr_in*>(&address.addr);
+        v4->sin_port = htons(static_cast<uint16_t>(port)); // Same offset in sockaddr_in6
+    }
+    return ordered;
+}
+
+// Open a connection to the host, racing its cached addresses
+void FetchEngine::connectNew(HostPool& pool, std::unique_ptr<Fetch> fetch) {
+    startDeadline(*fetch);
+    ResolvedHost resolved;
+    if (!resolver_->lookupCached(fetch->hostname, resolved)) {
+        awaitAddress(std::move(fetch));
+        return;
+    }
+    if (!resolved.found || resolved.addresses.empty()) {
+        complete(std::move(fetch), FetchError::Resolve);
+        return;
+    }
+
+    auto conn = std::make_unique<Connection>();
+    conn->serial = ++nextSerial_;
+    conn->https = fetch->https;
+    conn->hostname = fetch->hostname;
+    conn->port = fetch->port;
+    conn->hostKey = fetch->hostKey;
+    conn->candidates = attemptOrder(resolved.addresses, fetch->port);
+    conn->fetch = std::move(fetch);
+    conn->phaseStart = Clock::now();
+    ++pool.open;
+
+    Connection& ref = *conn;
+    connections_[ref.serial] = std::move(conn);
+    connectNext(ref);
+}
+
+// Start a non-blocking connect to the next untried address, skipping those
+// that fail straight away (e.g. IPv6 without a route). Returns false when
+// the connection was given up because nothing is left to try or wait for.
+bool FetchEngine::connectNext(Connection& conn) {
+    while (conn.nextCandidate < conn.candidates.size()) {
+        size_t candidate = conn.nextCandidate++;
+        const HostAddress& address = conn.candidates[candidate];
+        const sockaddr* target = reinterpret_cast<const sockaddr*>(&address.addr);
+
+        // io_uring waits on blocking sockets itself; with O_NONBLOCK it would hand back EAGAIN
+        int type = SOCK_STREAM | SOCK_CLOEXEC | (ring_ ? 0 : SOCK_NONBLOCK);
+        int sockfd = socket(address.addr.ss_family, type, IPPROTO_TCP);
+        if (sockfd == -1) continue;
+        if (ring_ && sockfd >= (1 << RING_FD_BITS)) {
+            close(sockfd);
+            continue;
+        }
+
+        if (ring_) {
+            // The address lives in candidates, which outlives the queued connect
+            ring_->prepConnect(sockfd, target, address.length, ringData(conn.serial, sockfd, RingOp::Connect));
+            ++conn.ringOps;
+        } else {
+            int rc = connect(sockfd, target, address.length);
+            struct epoll_event event{};
+            event.events = EPOLLOUT;
+            event.data.u64 = (static_cast<uint64_t>(conn.serial) << 32) | static_cast<uint32_t>(sockfd);
+            if ((rc != 0 && errno != EINPROGRESS) || epoll_ctl(epollFd_, EPOLL_CTL_ADD, sockfd, &event) != 0) {
+                close(sockfd);
+                continue;
+            }
+        }
+
+        ++connectStats_.attempts;
+        conn.attempts.emplace_back(sockfd, candidate);
+        conn.nextAttempt = Clock::now() + std::chrono::milliseconds(std::max(options_.connectAttemptDelayMs, 0));
+        armTimer(conn);
+        return true;
+    }
+
+    if (conn.attempts.empty()) {
+        abortFetch(conn, FetchError::Connect);
+        return false;
+    }
+    armTimer(conn);
+    return true;
+}
+
+// One racing connect finished. The first to succeed becomes the connection
+// and the rest are dropped; a failure brings the next address in at once.
+void FetchEngine::connectFinished(Connection& conn, int fd, bool connected) {
+    auto attempt = std::find_if(conn.attempts.begin(), conn.attempts.end(),
+                                [fd](const std::pair<int, size_t>& entry) { return entry.first == fd; });
+    if (attempt == conn.attempts.end()) {
+        return; // Lost the race and was already closed
+    }
+    size_t candidate = attempt->second;
+    conn.attempts.erase(attempt);
+    if (!connected) {
+        closeAttempt(fd);
+        connectNext(conn);
+        return;
+    }
+
+    for (const auto& other : conn.attempts) closeAttempt(other.first);
+    conn.attempts.clear();
+    conn.nextCandidate = conn.candidates.size();
+    conn.fd = fd;
+    conn.events = EPOLLOUT; // As registered for the connect
+    if (candidate > 0) ++connectStats_.fallbacks;
+    if (conn.candidates[candidate].addr.ss_family == AF_INET6) ++connectStats_.ipv6;
+
+    if (conn.https) {
+        conn.ssl = newClientConnection(conn.hostname, conn.port);
+        if (!conn.ssl) {
+            abortFetch(conn, FetchError::Tls);
+            return;
+        }
+        if (ring_) {
+            // The ring moves the bytes; OpenSSL only sees memory
+            BIO* network = BIO_new(BIO_s_mem());
+            BIO_set_mem_eof_return(network, -1); // Empty means "wait", not EOF
+            SSL_set_bio(conn.ssl, network, BIO_new(BIO_s_mem()));
+        } else {
+            SSL_set_fd(conn.ssl, conn.fd);
+        }
+        conn.state = ConnState::Handshaking;
+    } else {
+        conn.state = ConnState::Sending;
+    }
+    conn.phaseStart = Clock::now();
+    advance(conn);
+}
+
+// Close a socket whose connect lost the race or failed
+void FetchEngine::closeAttempt(int fd) {
+    if (ring_) {
+        // Pending operations complete (with an error) once the socket is shut down
+        shutdown(fd, SHUT_RDWR);
+    } else {
+        epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+    }
+    close(fd);
+}
+
+// Park a fetch until its hostname is resolved, starting the lookup if needed
+void FetchEngine::awaitAddress(std::unique_ptr<Fetch> fetch) {
+    std::string hostname = fetch->hostname;
+    DnsWait& waiting = awaitingDns_[hostname];
+    waiting.fetches.push_back(std::move(fetch));
+    if (waiting.fetches.size() == 1) {
+        // Fetches joining a lookup share its deadline
+        if (options_.resolveTimeoutMs > 0) {
+            waiting.lookup = ++nextSerial_;
+            lookups_[waiting.lookup] = hostname;
+            waiting.timer = timers_.schedule(Clock::now() + std::chrono::milliseconds(options_.resolveTimeoutMs),
+                                             (static_cast<uint64_t>(waiting.lookup) << 32) | LOOKUP_TIMER);
+        }
+        resolver_->resolve(hostname, [this](const std::string& name, const ResolvedHost&) {
+            onResolved(name);
+        });
+    }
+}
+
+// Re-dispatch the fetches that were waiting on a finished lookup
+void FetchEngine::onResolved(const std::string& hostname) {
+    auto it = awaitingDns_.find(hostname);
+    if (it == awaitingDns_.end()) return;
+    std::vector<std::unique_ptr<Fetch>> fetches = std::move(it->second.fetches);
+    timers_.cancel(it->second.timer);
+    lookups_.erase(it->second.lookup);
+    awaitingDns_.erase(it);
+
+    for (std::unique_ptr<Fetch>& fetch : fetches) {
+        dispatch(std::move(fetch));
+    }
+}
+
+// Start a fetch on an established connection taken from the pool
+void FetchEngine::assign(Connection& conn, std::unique_ptr<Fetch> fetch) {
+    startDeadline(*fetch);
+    conn.fetch = std::move(fetch);
+    conn.requestSent = 0;
+    conn.headerBuffer.clear();
+    conn.headerParser.reset();
+    conn.malformed = false;
+    conn.rejection = Rejection::None;
+    conn.headerParsed = false;
+    conn.receivedAny = false;
+    conn.keepAlive = false;
+    conn.state = ConnState::Sending;
+    conn.phaseStart = Clock::now();
+    advance(conn);
+}
+
+// Update the epoll interest set for a connection's socket.
+// The state machine waits only through here, so this is where its deadline is kept.
+void FetchEngine::watch(Connection& conn, uint32_t events) {
+    armTimer(conn);
+    if (ring_) {
+        watchRing(conn, events);
+        return;
+    }
+    if (conn.events == events) return;
+
+    struct epoll_event event{};
+    event.events = events;
+    event.data.u64 = (static_cast<uint64_t>(conn.serial) << 32) | static_cast<uint32_t>(conn.fd);
+    int op = conn.events == 0 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+    if (epoll_ctl(epollFd_, op, conn.fd, &event) != 0) {
+        abortFetch(conn, FetchError::Connect);
+        return;
+    }
+    conn.events = events;
+}
+
+void FetchEngine::handleEvent(Connection& conn, int fd) {
+    if (conn.state == ConnState::Connecting) {
+        int err = 0;
+        socklen_t len = sizeof(err);
+        bool connected = getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0;
+        connectFinished(conn, fd, connected);
+        return;
+    }
+    if (fd != conn.fd) {
+        return; // A losing attempt's event, reported before it was closed
+    }
+
+    if (conn.state == ConnState::Idle) {
+        // Readiness on an idle connection means the server closed it
+        closeConnection(conn);
+        return;
+    }
+
+    advance(conn);
+}
+
+// Run the connection's state machine until it needs to wait for the socket
+void FetchEngine::advance(Connection& conn) {
+    while (true) {
+        switch (conn.state) {
+            case ConnState::Connecting:
+            case ConnState::Idle:
+                return;
+
+            case ConnState::Handshaking: {
+                int rc = SSL_connect(conn.ssl);
+                if (rc == 1) {
+                    recordHandshake(conn.ssl);
+                    conn.state = ConnState::Sending;
+                    conn.phaseStart = Clock::now();
+                    break;
+                }
+                int err = SSL_get_error(conn.ssl, rc);
+                if (err == SSL_ERROR_WANT_READ) {
+                    watch(conn, EPOLLIN);
+                } else if (err == SSL_ERROR_WANT_WRITE) {
+                    watch(conn, EPOLLOUT);
+                } else {
+                    abortFetch(conn, FetchError::Tls);
+                }
+                return;
+            }
+
+            case ConnState::Sending: {
+                const std::string& request = conn.fetch->request;
+                while (conn.requestSent < request.size()) {
+                    ssize_t n = transportWrite(conn, request.data() + conn.requestSent,
+                                               request.size() - conn.requestSent);
+                    if (n == IO_WANT_READ || n == IO_WANT_WRITE) {
+                        watch(conn, n == IO_WANT_READ ? EPOLLIN : EPOLLOUT);
+                        return;
+                    }
+                    if (n <= 0) {
+                        abortFetch(conn, FetchError::Send);
+                        return;
+                    }
+                    conn.requestSent += n;
+                }
+                conn.state = ConnState::Receiving;
+                break;
+            }
+
+            case ConnState::Receiving: {
+                bool nextFetch = false;
+                while (!nextFetch) {
+                    bool finished = false;
+                    ssize_t n = receive(conn, finished);
+                    if (n == IO_WANT_READ || n == IO_WANT_WRITE) {
+                        watch(conn, n == IO_WANT_READ ? EPOLLIN : EPOLLOUT);
+                        return;
+                    }
+                    if (n == IO_ERROR) {
+                        abortFetch(conn, FetchError::Receive);
+                        return;
+                    }
+                    if (n == 0) {
+                        if (conn.headerParsed && conn.framer.framing() == BodyFraming::UntilClose) {
+                            // The close delimits the body
+                            conn.keepAlive = false;
+                            completeFetch(conn);
+                        } else {
+                            abortFetch(conn, FetchError::Receive);
+                        }
+                        return;
+                    }
+
+                    conn.receivedAny = true;
+                    conn.lastRead = Clock::now();
+                    if (finished) {
+                        if (!completeFetch(conn)) return;
+                        nextFetch = true;
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
+
+// Read the next piece of the response. Body bytes that need no de-framing or
+// decoding are read straight into Response::body; everything else goes
+// through the shared read buffer. Sets finished once the response is complete.
+ssize_t FetchEngine::receive(Connection& conn, bool& finished) {
+    size_t direct = 0;
+    if (conn.headerParsed && conn.decoder.coding() == ContentCoding::Identity) {
+        direct = conn.framer.directBytes();
+    }
+
+    if (direct > 0) {
+        std::string& body = conn.fetch->response.body;
+        size_t before = body.size();
+        body.resize(before + std::min(direct, static_cast<size_t>(READ_SIZE)));
+        ssize_t n = transportRead(conn, &body[before], body.size() - before);
+        body.resize(before + std::max<ssize_t>(n, 0));
+        if (n > 0) {
+            conn.framer.commitDirect(n);
+            finished = !withinBudget(conn, n) || conn.framer.done();
+            streamBody(*conn.fetch);
+        }
+        return n;
+    }
+
+    ssize_t n = transportRead(conn, readBuffer_.data(), readBuffer_.size());
+    if (n > 0) {
+        size_t before = conn.fetch->response.body.size();
+        bool parsed = conn.headerParsed;
+        finished = consume(conn, readBuffer_.data(), n);
+        // A body that arrived with the header is measured from empty
+        size_t received = conn.fetch->response.body.size() - (parsed ? before : 0);
+        if (conn.headerParsed && !withinBudget(conn, received)) {
+            finished = true;
+        }
+        streamBody(*conn.fetch);
+    }
+    return n;
+}
+
+// Hand the body received so far to a streaming fetch's callback and drop it,
+// so such a page never holds more than one read's worth of body
+void FetchEngine::streamBody(Fetch& fetch) {
+    std::string& body = fetch.response.body;
+    if (fetch.streaming && !body.empty()) {
+        fetch.onBody(fetch.response, body.data(), body.size());
+        body.clear();
+    }
+}
+
+// Split received bytes into the header and the framed body.
+// Returns true once the current response is complete.
+bool FetchEngine::consume(Connection& conn, const char* data, size_t size) {
+    Response& response = conn.fetch->response;
+
+    if (conn.headerParsed) {
+        size_t used = feedBody(conn, data, size);
+        if (used < size) {
+            // Bytes past the end of the response; we never pipeline, so don't trust the connection
+            conn.keepAlive = false;
+        }
+        return conn.framer.done() || conn.framer.failed();
+    }
+
+    // Parse the header where it lies; only a header split across reads is copied aside
+    const char* header = data;
+    size_t available = size;
+    bool buffered = !conn.headerBuffer.empty();
+    if (buffered) {
+        conn.headerBuffer.append(data, size);
+        header = conn.headerBuffer.data();
+        available = conn.headerBuffer.size();
+    }
+
+    while (true) {
+        HeaderParseStatus status = conn.headerParser.parse(header, available);
+        if (status == HeaderParseStatus::Error) {
+            conn.malformed = true;
+            return true;
+        }
+        if (status == HeaderParseStatus::Incomplete) {
+            // Keep what is left of this read; interim responses before it are done with
+            if (buffered) {
+                conn.headerBuffer.erase(0, header - conn.headerBuffer.data());
+            } else {
+                conn.headerBuffer.assign(header, available);
+            }
+            return false;
+        }
+
+        response.header = makeResponseHeader(conn.headerParser);
+        response.rawHeader.assign(header, conn.headerParser.headerSize());
+        header += conn.headerParser.headerSize();
+        available -= conn.headerParser.headerSize();
+        conn.headerParser.reset();
+
+        // Skip interim responses such as 100 Continue
+        if (response.header.status < 100 || response.header.status >= 200) break;
+    }
+
+    // A redirect about to be followed is done with at its header: its body is
+    // never looked at, so it is neither admitted nor read, however long
+    bool followed = !redirectTarget(*conn.fetch).empty();
+    if (!followed && !admit(conn)) {
+        return true;
+    }
+
+    BodyFraming framing = chooseFraming(response.header);
+    conn.keepAlive = response.header.keepAlive && framing != BodyFraming::UntilClose;
+    if (followed && framing != BodyFraming::None) {
+        framing = BodyFraming::None;
+        conn.keepAlive = false; // The unread body is still on the wire
+    }
+    conn.framer.reset(framing, framing == BodyFraming::ContentLength ? response.header.contentLength : 0);
+    conn.decodeFailed = !conn.decoder.reset(followed ? ContentCoding::Identity : parseContentCoding(response.header.contentEncoding));
+    conn.headerParsed = true;
+    conn.bodyReceived = 0;
+    response.finalUrl = conn.fetch->url;
+    conn.fetch->streaming = conn.fetch->onBody && response.header.status >= 200 && response.header.status < 300;
+
+    // Size the body once instead of growing it read by read
+    if (framing == BodyFraming::ContentLength && !conn.fetch->streaming) {
+        response.body.reserve(std::min(static_cast<size_t>(response.header.contentLength),
+                                       static_cast<size_t>(MAX_PRESIZE)));
+    }
+
+    size_t used = feedBody(conn, header, available);
+    conn.headerBuffer.clear();
+    if (used < available) {
+        conn.keepAlive = false;
+    }
+    return conn.framer.done() || conn.framer.failed();
+}
+
+// Check a freshly parsed header against the admission policy of its fetch.
+// Returns false when the body should not be downloaded at all.
+bool FetchEngine::admit(Connection& conn) {
+    const ResponseHeader& header = conn.fetch->response.header;
+    const AdmissionPolicy& policy = conn.fetch->admission ? *conn.fetch->admission : admission_;
+    conn.rejection = policy.check(header, conn.bodyBudget);
+    switch (conn.rejection) {
+        case Rejection::None:
+            if (header.status >= 200 && header.status < 300) ++admissionStats_.admitted;
+            return true;
+        case Rejection::ContentType: ++admissionStats_.contentType; break;
+        case Rejection::DeclaredLength: ++admissionStats_.declaredLength; break;
+        case Rejection::BodyLimit: break;
+    }
+    conn.keepAlive = false; // The unread body is still on the wire
+    return false;
+}
+
+// Count received body bytes against the budget set by admit().
+// Returns false once the body has outgrown it.
+bool FetchEngine::withinBudget(Connection& conn, size_t received) {
+    if (conn.rejection != Rejection::None) {
+        return false;
+    }
+    conn.bodyReceived += received;
+    if (conn.bodyReceived <= conn.bodyBudget) {
+        return true;
+    }
+    // Drop the overshoot so a streaming caller never sees more than the budget
+    std::string& body = conn.fetch->response.body;
+    body.resize(body.size() - std::min(body.size(), conn.bodyReceived - conn.bodyBudget));
+    conn.rejection = Rejection::BodyLimit;
+    conn.keepAlive = false;
+    ++admissionStats_.bodyLimit;
+    return false;
+}
+
+// Run received bytes through the framer and then the content decoder.
+// Returns how many bytes belonged to the current response.
+size_t FetchEngine::feedBody(Connection& conn, const char* data, size_t size) {
+    Response& response = conn.fetch->response;
+    if (conn.decoder.coding() == ContentCoding::Identity) {
+        return conn.framer.feed(data, size, response.body);
+    }
+
+    // Inflate at most one byte past the budget: enough for withinBudget() to
+    // refuse the body, without letting a compression bomb run on
+    size_t limit = conn.bodyBudget > conn.bodyReceived ? conn.bodyBudget - conn.bodyReceived + 1 : 1;
+    conn.framed.clear();
+    size_t used = conn.framer.feed(data, size, conn.framed);
+    if (!conn.decodeFailed && !conn.decoder.feed(conn.framed.data(), conn.framed.size(), response.body, limit)) {
+        conn.decodeFailed = true;
+    }
+    return used;
+}
+
+// Queue the finished fetch and recycle the connection.
+// Returns true when the connection already carries the next fetch.
+bool FetchEngine::completeFetch(Connection& conn) {
+    FetchError error = FetchError::None;
+    if (conn.malformed || conn.framer.failed()) {
+        error = FetchError::Receive;
+    } else if (conn.rejection != Rejection::None) {
+        error = FetchError::Rejected;
+        conn.fetch->response.rejection = conn.rejection;
+    } else if (conn.decodeFailed || !conn.decoder.finished()) {
+        error = FetchError::Decode;
+    }
+    // A bad encoding does not disturb the framing, so the connection stays usable
+    bool reusable = conn.keepAlive && error != FetchError::Receive;
+    ++conn.requestsServed;
+    complete(std::move(conn.fetch), error);
+
+    if (!reusable) {
+        closeConnection(conn);
+        return false;
+    }
+
+    HostPool& pool = hosts_[conn.hostKey];
+    if (pool.waiting.empty()) {
+        makeIdle(conn);
+        return false;
+    }
+
+    std::unique_ptr<Fetch> next = std::move(pool.waiting.front());
+    pool.waiting.pop_front();
+    if (pool.waiting.empty()) hostsWaiting_.erase(conn.hostKey);
+
+    startDeadline(*next);
+    conn.fetch = std::move(next);
+    conn.requestSent = 0;
+    conn.headerBuffer.clear();
+    conn.headerParser.reset();
+    conn.malformed = false;
+    conn.rejection = Rejection::None;
+    conn.headerParsed = false;
+    conn.receivedAny = false;
+    conn.keepAlive = false;
+    conn.state = ConnState::Sending;
+    conn.phaseStart = Clock::now();
+    return true;
+}
+
+// Close a connection that failed, retrying its fetch once if a reused
+// keep-alive connection turned out to be closed by the server
+void FetchEngine::abortFetch(Connection& conn, FetchError error) {
+    std::unique_ptr<Fetch> fetch = std::move(conn.fetch);
+    bool stale = conn.requestsServed > 0 && !conn.receivedAny;
+    closeConnection(conn);
+    if (!fetch) return;
+
+    if (stale && !fetch->retried) {
+        fetch->retried = true;
+        fetch->response = Response{};
+        dispatch(std::move(fetch), false);
+        return;
+    }
+    complete(std::move(fetch), error);
+}
+
+// Park a keep-alive connection in its host's pool
+void FetchEngine::makeIdle(Connection& conn) {
+    conn.state = ConnState::Idle;
+    conn.idleSince = Clock::now();
+    conn.idlePos = idle_.insert(idle_.end(), &conn);
+    hosts_[conn.hostKey].idle.push_back(&conn);
+    watch(conn, EPOLLIN | EPOLLRDHUP);
+}
+
+void FetchEngine::closeConnection(Connection& conn) {
+    auto hostIt = hosts_.find(conn.hostKey);
+    if (conn.state == ConnState::Idle) {
+        idle_.erase(conn.idlePos);
+        if (hostIt != hosts_.end()) {
+            std::deque<Connection*>& idle = hostIt->second.idle;
+            idle.erase(std::remove(idle.begin(), idle.end(), &conn), idle.end());
+        }
+    }
+    if (conn.fetch) {
+        complete(std::move(conn.fetch), FetchError::Receive);
+    }
+    timers_.cancel(conn.timer);
+
+    if (conn.ssl) {
+        if (SSL_is_init_finished(conn.ssl)) SSL_shutdown(conn.ssl);
+        SSL_free(conn.ssl);
+        conn.ssl = nullptr;
+    }
+    for (const auto& attempt : conn.attempts) closeAttempt(attempt.first);
+    conn.attempts.clear();
+    if (conn.fd != -1) closeAttempt(conn.fd);
+
+    if (hostIt != hosts_.end()) {
+        HostPool& pool = hostIt->second;
+        --pool.open;
+        if (pool.open == 0 && pool.idle.empty() && pool.waiting.empty()) {
+            hosts_.erase(hostIt);
+        }
+    }
+    uint32_t serial = conn.serial;
+    if (conn.ringOps > 0) {
+        // The kernel may still read the send buffer; keep it until the completions arrive
+        retired_[serial] = std::move(connections_[serial]);
+    }
+    connections_.erase(serial);
+}
+
+// Close pooled connections that have been idle longer than the timeout
+void FetchEngine::evictIdle(Clock::time_point now) {
+    auto timeout = std::chrono::milliseconds(options_.idleTimeoutMs);
+    while (!idle_.empty() && now - idle_.front()->idleSince >= timeout) {
+        closeConnection(*idle_.front());
+    }
+}
+
+// Free a global slot by closing the least recently used idle connection
+bool FetchEngine::evictOldestIdle() {
+    if (idle_.empty()) return false;
+    closeConnection(*idle_.front());
+    return true;
+}
+
+// Open connections for fetches that were held back by the per-host cap
+void FetchEngine::pumpWaiting(const std::string& hostKey) {
+    auto it = hosts_.find(hostKey);
+    if (it == hosts_.end()) {
+        hostsWaiting_.erase(hostKey);
+        return;
+    }
+
+    HostPool& pool = it->second;
+    while (!pool.waiting.empty() && pool.open < options_.maxConnectionsPerHost &&
+           (connections_.size() < options_.maxConnections || evictOldestIdle())) {
+        std::unique_ptr<Fetch> fetch = std::move(pool.waiting.front());
+        pool.waiting.pop_front();
+        connectNew(pool, std::move(fetch));
+    }
+    if (pool.waiting.empty()) hostsWaiting_.erase(hostKey);
+}
+
+// Queue a fetch's callback to run from poll()
+void FetchEngine::complete(std::unique_ptr<Fetch> fetch, FetchError error) {
+    if (error == FetchError::None && followRedirect(fetch, error)) {
+        return;
+    }
+
+    fetch->response.error = error;
+    fetch->response.finalUrl = fetch->url;
+    if (error != FetchError::None) {
+        fetch->response.header = ResponseHeader{};
+        fetch->response.rawHeader.clear();
+        fetch->response.body.clear();
+    } else if (fetch->conditional && fetch->response.header.status == 304) {
+        fetch->response.notModified = true;
+    } else if (validators_) {
+        validators_->record(fetch->url, fetch->response.header);
+    }
+    completed_.push_back(std::move(fetch));
+}
+
+// Where the response of a fetch redirects to, or "" when it is not a
+// redirect to follow (not http(s), or redirects are off)
+std::string FetchEngine::redirectTarget(const Fetch& fetch) const {
+    const ResponseHeader& header = fetch.response.header;
+    bool redirect = header.status == 301 || header.status == 302 || header.status == 303 ||
+                    header.status == 307 || header.status == 308;
+    if (!redirect || options_.maxRedirects <= 0 || header.location.empty()) {
+        return "";
+    }
+    return resolveLocation(fetch.url, header.location);
+}
+
+// Queue another hop if the response is a redirect we should follow.
+// Returns true when the fetch was taken over; sets error for loops and long chains.
+bool FetchEngine::followRedirect(std::unique_ptr<Fetch>& fetch, FetchError& error) {
+    std::string target = redirectTarget(*fetch);
+    if (target.empty()) {
+        return false; // Hand the response to the caller as-is
+    }
+    const ResponseHeader& header = fetch->response.header;
+
+    fetch->redirectChain.push_back(fetch->url);
+    bool loop = std::find(fetch->redirectChain.begin(), fetch->redirectChain.end(), target) != fetch->redirectChain.end();
+    if (loop || fetch->redirectChain.size() > static_cast<size_t>(options_.maxRedirects)) {
+        error = FetchError::Redirect;
+        return false;
+    }
+
+    if (header.status == 301 || header.status == 308) {
+        redirects_.learn(fetch->url, target);
+    }
+    fetch->url = target;
+    fetch->response = Response{};
+    fetch->retried = false;
+    redirected_.push_back(std::move(fetch));
+    return true;
+}
+
+size_t FetchEngine::poll(int timeoutMs) {
+    if (!completed_.empty() || !redirected_.empty()) {
+        timeoutMs = 0;
+    } else if (!idle_.empty()) {
+        // Wake up in time to evict the oldest idle connection
+        auto expiry = idle_.front()->idleSince + std::chrono::milliseconds(options_.idleTimeoutMs);
+        long long wait = std::chrono::duration_cast<std::chrono::milliseconds>(expiry - Clock::now()).count() + 1;
+        wait = std::max<long long>(wait, 0);
+        if (timeoutMs < 0 || wait < timeoutMs) timeoutMs = static_cast<int>(wait);
+    }
+    // ...and in time for the next deadline
+    int deadline = timers_.msUntilNext(Clock::now());
+    if (deadline >= 0 && (timeoutMs < 0 || deadline < timeoutMs)) timeoutMs = deadline;
+
+    if (ring_ && (!connections_.empty() || resolver_->pending() > 0)) {
+        // Everything queued since the last poll goes to the kernel in this one call
+        ring_->submitAndWait(timeoutMs);
+        IoCompletion completion;
+        while (ring_->nextCompletion(completion)) {
+            handleCompletion(completion);
+        }
+        // Buffers are back in the ring; retry receives that found it empty
+        std::vector<uint32_t> starved;
+        starved.swap(starved_);
+        for (uint32_t serial : starved) {
+            auto it = connections_.find(serial);
+            if (it != connections_.end()) {
+                watchRing(*it->second, it->second->events);
+            }
+        }
+    } else if (!connections_.empty() || resolver_->pending() > 0) {
+        struct epoll_event events[MAX_EVENTS];
+        int count = epoll_wait(epollFd_, events, MAX_EVENTS, timeoutMs);
+        for (int i = 0; i < count; ++i) {
+            int fd = static_cast<int>(events[i].data.u64 & 0xffffffff);
+            uint32_t serial = static_cast<uint32_t>(events[i].data.u64 >> 32);
+            if (serial == 0) {
+                resolver_->dispatchCompletions();
+                continue;
+            }
+            auto it = connections_.find(serial);
+            if (it != connections_.end()) {
+                handleEvent(*it->second, fd);
+            }
+        }
+    }
+
+    Clock::time_point now = Clock::now();
+    expired_.clear();
+    timers_.expire(now, expired_);
+    for (uint64_t key : expired_) {
+        handleTimer(key, now);
+    }
+    evictIdle(now);
+
+    // Refill freed slots: hosts held back by their own cap first, then the global queue
+    if (!hostsWaiting_.empty()) {
+        std::vector<std::string> hosts(hostsWaiting_.begin(), hostsWaiting_.end());
+        for (const std::string& hostKey : hosts) {
+            pumpWaiting(hostKey);
+        }
+    }
+    while (!pending_.empty() && (connections_.size() < options_.maxConnections || !idle_.empty())) {
+        std::unique_ptr<Fetch> fetch = std::move(pending_.front());
+        pending_.pop_front();
+        dispatch(std::move(fetch));
+    }
+
+    // Next hops of redirected fetches
+    while (!redirected_.empty()) {
+        std::unique_ptr<Fetch> fetch = std::move(redirected_.front());
+        redirected_.pop_front();
+        start(std::move(fetch));
+    }
+
+    size_t finished = 0;
+    while (!completed_.empty()) {
+        std::unique_ptr<Fetch> fetch = std::move(completed_.front());
+        completed_.pop_front();
+        --fetchesInFlight_;
+        if (fetch->onComplete) {
+            fetch->onComplete(fetch->requestedUrl, fetch->response);
+        }
+        ++finished;
+    }
+    return finished;
+}
+
+void FetchEngine::run() {
+    while (inFlight() > 0) {
+        poll(-1);
+    }
+}
+
+// Start a fetch's total budget when it first goes to the network, so time
+// spent queued behind the connection limits is not held against the host
+void FetchEngine::startDeadline(Fetch& fetch) {
+    if (options_.totalTimeoutMs > 0 && fetch.deadline == Clock::time_point::max()) {
+        fetch.deadline = Clock::now() + std::chrono::milliseconds(options_.totalTimeoutMs);
+    }
+}
+
+// When the phase a connection is in runs out of time, and which phase
+// that is; time_point::max() when nothing bounds it
+FetchEngine::Clock::time_point FetchEngine::connectionDeadline(const Connection& conn, TimeoutPhase& phase) const {
+    Clock::time_point due = Clock::time_point::max();
+    phase = TimeoutPhase::None;
+    auto bound = [&](Clock::time_point start, int timeoutMs, TimeoutPhase limited) {
+        if (timeoutMs <= 0) return;
+        Clock::time_point end = start + std::chrono::milliseconds(timeoutMs);
+        if (end < due) {
+            due = end;
+            phase = limited;
+        }
+    };
+
+    switch (conn.state) {
+        case ConnState::Connecting:
+            bound(conn.phaseStart, options_.connectTimeoutMs, TimeoutPhase::Connect);
+            if (conn.nextCandidate < conn.candidates.size() && conn.nextAttempt < due) {
+                due = conn.nextAttempt; // Not a deadline: the next address joins the race
+                phase = TimeoutPhase::None;
+            }
+            break;
+        case ConnState::Handshaking: bound(conn.phaseStart, options_.tlsTimeoutMs, TimeoutPhase::Tls); break;
+        case ConnState::Sending:
+        case ConnState::Receiving:
+            if (conn.receivedAny) {
+                bound(conn.lastRead, options_.readTimeoutMs, TimeoutPhase::Read);
+            } else {
+                bound(conn.phaseStart, options_.firstByteTimeoutMs, TimeoutPhase::FirstByte);
+            }
+            break;
+        case ConnState::Idle: return due; // Pooled connections expire through idleTimeoutMs
+    }
+    if (conn.fetch && conn.fetch->deadline < due) {
+        due = conn.fetch->deadline;
+        phase = TimeoutPhase::Total;
+    }
+    return due;
+}
+
+// Make sure a timer fires by the connection's current deadline. A pending
+// timer that fires no later is kept: it re-checks the deadline when it
+// fires, so steady reads cost no timer updates at all.
+void FetchEngine::armTimer(Connection& conn) {
+    TimeoutPhase phase;
+    Clock::time_point due = connectionDeadline(conn, phase);
+    if (due == Clock::time_point::max() || (conn.timer != 0 && conn.timerDue <= due)) {
+        return;
+    }
+    timers_.cancel(conn.timer);
+    conn.timer = timers_.schedule(due, static_cast<uint64_t>(conn.serial) << 32);
+    conn.timerDue = due;
+}
+
+// A connection or DNS lookup timer fired: end what overran its deadline,
+// or re-arm for the later deadline progress has earned since
+void FetchEngine::handleTimer(uint64_t key, Clock::time_point now) {
+    uint32_t serial = static_cast<uint32_t>(key >> 32);
+    uint32_t low = static_cast<uint32_t>(key & 0xffffffffu);
+
+    if (low == LOOKUP_TIMER) {
+        auto lookup = lookups_.find(serial);
+        if (lookup == lookups_.end()) return;
+        auto it = awaitingDns_.find(lookup->second);
+        lookups_.erase(lookup);
+        if (it == awaitingDns_.end()) return;
+        // A late answer still lands in the resolver's cache for later fetches
+        std::vector<std::unique_ptr<Fetch>> fetches = std::move(it->second.fetches);
+        awaitingDns_.erase(it);
+        for (std::unique_ptr<Fetch>& fetch : fetches) {
+            timeOut(std::move(fetch), TimeoutPhase::Resolve);
+        }
+        return;
+    }
+
+    auto it = connections_.find(serial);
+    if (it == connections_.end()) return;
+    Connection& conn = *it->second;
+    conn.timer = 0;
+    TimeoutPhase phase;
+    if (connectionDeadline(conn, phase) > now) {
+        armTimer(conn);
+        return;
+    }
+    if (phase == TimeoutPhase::None) {
+        connectNext(conn); // Time to race the next address
+        return;
+    }
+
+    // Never retried like a stale keep-alive connection: the host is slow, not gone
+    std::unique_ptr<Fetch> fetch = std::move(conn.fetch);
+    closeConnection(conn);
+    if (fetch) timeOut(std::move(fetch), phase);
+}
+
+// Complete a fetch that overran a deadline
+void FetchEngine::timeOut(std::unique_ptr<Fetch> fetch, TimeoutPhase phase) {
+    switch (phase) {
+        case TimeoutPhase::Resolve: ++timeoutStats_.resolve; break;
+        case TimeoutPhase::Connect: ++timeoutStats_.connect; break;
+        case TimeoutPhase::Tls: ++timeoutStats_.tls; break;
+        case TimeoutPhase::FirstByte: ++timeoutStats_.firstByte; break;
+        case TimeoutPhase::Read: ++timeoutStats_.read; break;
+        case TimeoutPhase::Total: ++timeoutStats_.total; break;
+        case TimeoutPhase::None: break;
+    }
+    fetch->response.timeout = phase;
+    complete(std::move(fetch), FetchError::Timeout);
+}
+
+// io_uring counterpart of epoll interest: queue a receive when the state
+// machine waits for input, after sending what it wrote
+void FetchEngine::watchRing(Connection& conn, uint32_t events) {
+    flushRing(conn);
+    // Memory BIOs never refuse a write, so only input is ever waited for
+    if ((events & EPOLLIN) && !conn.recvArmed && !conn.rxEof) {
+        ring_->prepRecv(conn.fd, ringData(conn.serial, conn.fd, RingOp::Recv));
+        conn.recvArmed = true;
+        ++conn.ringOps;
+    }
+    conn.events = events;
+}
+
+// Queue a send of everything written so far, unless one is in flight
+void FetchEngine::flushRing(Connection& conn) {
+    if (conn.ssl) {
+        BIO* network = SSL_get_wbio(conn.ssl);
+        size_t pending = BIO_ctrl_pending(network);
+        if (pending > 0) {
+            size_t before = conn.outbound.size();
+            conn.outbound.resize(before + pending);
+            int n = BIO_read(network, &conn.outbound[before], static_cast<int>(pending));
+            conn.outbound.resize(before + std::max(n, 0));
+        }
+    }
+    if (conn.sendArmed || conn.outbound.empty()) return;
+
+    conn.sending.swap(conn.outbound);
+    conn.outbound.clear();
+    conn.sendOffset = 0;
+    ring_->prepSend(conn.fd, conn.sending.data(), conn.sending.size(), ringData(conn.serial, conn.fd, RingOp::Send));
+    conn.sendArmed = true;
+    ++conn.ringOps;
+}
+
+void FetchEngine::handleCompletion(const IoCompletion& completion) {
+    uint32_t serial = static_cast<uint32_t>(completion.userData >> 32);
+    RingOp op = static_cast<RingOp>((completion.userData >> RING_FD_BITS) & 0xff);
+    int fd = static_cast<int>(completion.userData & ((1u << RING_FD_BITS) - 1));
+
+    if (serial == 0) {
+        resolver_->dispatchCompletions();
+        ring_->prepPollIn(fd, ringData(0, fd, RingOp::Poll));
+        return;
+    }
+
+    auto it = connections_.find(serial);
+    if (it == connections_.end()) {
+        // The connection was closed while this operation was in flight
+        ring_->recycle(completion);
+        auto retired = retired_.find(serial);
+        if (retired != retired_.end() && --retired->second->ringOps == 0) {
+            retired_.erase(retired);
+        }
+        return;
+    }
+
+    Connection& conn = *it->second;
+    --conn.ringOps;
+    switch (op) {
+        case RingOp::Connect:
+            if (conn.state == ConnState::Connecting) {
+                connectFinished(conn, fd, completion.result >= 0);
+            }
+            break;
+        case RingOp::Send:
+            sendCompleted(conn, completion.result);
+            break;
+        case RingOp::Recv:
+            receiveCompleted(conn, completion);
+            break;
+        case RingOp::Poll:
+            break;
+    }
+}
+
+// Feed received bytes to the state machine, then hand the buffer back
+void FetchEngine::receiveCompleted(Connection& conn, const IoCompletion& completion) {
+    conn.recvArmed = false;
+    int result = completion.result;
+    if (result == -ENOBUFS) {
+        starved_.push_back(conn.serial);
+        return;
+    }
+    if (result < 0) {
+        failRing(conn);
+        return;
+    }
+
+    const char* data = ring_->buffer(completion);
+    uint32_t serial = conn.serial;
+    if (result == 0) {
+        conn.rxEof = true;
+        if (conn.ssl) BIO_set_mem_eof_return(SSL_get_rbio(conn.ssl), 0);
+    } else if (conn.ssl) {
+        BIO_write(SSL_get_rbio(conn.ssl), data, result);
+    } else if (conn.rxSize > 0) {
+        // Unread bytes are already copied aside; keep them in order
+        size_t offset = conn.rxData - conn.rxSpill.data();
+        conn.rxSpill.erase(0, offset);
+        conn.rxSpill.append(data, result);
+        conn.rxData = conn.rxSpill.data();
+        conn.rxSize = conn.rxSpill.size();
+    } else {
+        // Read in place; copied aside below only if something is left over
+        conn.rxData = data;
+        conn.rxSize = result;
+    }
+
+    handleEvent(conn, conn.fd);
+
+    auto it = connections_.find(serial);
+    if (it != connections_.end()) {
+        Connection& live = *it->second;
+        if (live.rxSize > 0 && live.rxSpill.empty()) {
+            live.rxSpill.assign(live.rxData, live.rxSize);
+            live.rxData = live.rxSpill.data();
+        }
+    }
+    ring_->recycle(completion);
+}
+
+void FetchEngine::sendCompleted(Connection& conn, int result) {
+    conn.sendArmed = false;
+    if (result <= 0) {
+        failRing(conn);
+        return;
+    }
+    conn.sendOffset += result;
+    if (conn.sendOffset < conn.sending.size()) {
+        ring_->prepSend(conn.fd, conn.sending.data() + conn.sendOffset, conn.sending.size() - conn.sendOffset,
+                        ringData(conn.serial, conn.fd, RingOp::Send));
+        conn.sendArmed = true;
+        ++conn.ringOps;
+        return;
+    }
+    conn.sending.clear();
+    flushRing(conn);
+}
+
+// A receive or send failed: end the connection as its current phase would under epoll
+void FetchEngine::failRing(Connection& conn) {
+    switch (conn.state) {
+        case ConnState::Idle: closeConnection(conn); break;
+        case ConnState::Connecting: abortFetch(conn, FetchError::Connect); break;
+        case ConnState::Handshaking: abortFetch(conn, FetchError::Tls); break;
+        case ConnState::Sending: abortFetch(conn, FetchError::Send); break;
+        case ConnState::Receiving: abortFetch(conn, FetchError::Receive); break;
+    }
+}
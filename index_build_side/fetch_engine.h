@@ -0,0 +1,255 @@
+#ifndef FETCH_ENGINE_H
+#define FETCH_ENGINE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <sys/types.h>
+
+#include "admission.h"
+#include "downloader.h"
+#include "io_ring.h"
+#include "redirect_map.h"
+#include "timer_wheel.h"
+
+class Resolver;
+class ValidatorStore;
+
+// Callback invoked exactly once per submitted URL, from inside poll()
+using FetchCallback = std::function<void(const std::string& url, Response& response)>;
+
+// Callback receiving a 2xx body piece by piece as it is received and decoded,
+// from inside poll(). response carries the header and finalUrl; its body stays empty.
+using BodyCallback = std::function<void(const Response& response, const char* data, size_t size)>;
+
+// How sockets are driven
+enum class IoBackend {
+    Epoll,  // Non-blocking calls on readiness from epoll
+    IoUring // Batched io_uring submissions; falls back to Epoll where unavailable
+};
+
+// Tunables for a FetchEngine
+struct FetchEngineOptions {
+    size_t maxConnections = 1024;       // Open sockets across all hosts (busy, idle or connecting)
+    size_t maxConnectionsPerHost = 6;   // Open sockets to any one scheme://host
+    int idleTimeoutMs = 30000;          // Close pooled keep-alive connections unused for this long
+    bool acceptCompressed = true;       // Ask for gzip/deflate/br bodies (decoded before the callback)
+    int maxRedirects = 5;               // Redirect hops followed per fetch (0 returns 3xx responses as-is)
+    std::string userAgent = "searchengine-crawler/1.0"; // Sent as User-Agent ("" to leave it out)
+    IoBackend ioBackend = IoBackend::Epoll;
+
+    // Deadlines per phase of a fetch, in milliseconds (0 = none). A fetch that
+    // overruns one completes with FetchError::Timeout and Response::timeout set.
+    int resolveTimeoutMs = 10000;   // DNS lookup
+    int connectTimeoutMs = 10000;   // TCP handshake
+    int tlsTimeoutMs = 10000;       // TLS handshake
+    int firstByteTimeoutMs = 30000; // Request start to the first response byte
+    int readTimeoutMs = 30000;      // Silence between reads once the response started
+    int totalTimeoutMs = 120000;    // Whole fetch, redirects included, from its first connection attempt
+
+    // Happy Eyeballs (RFC 8305): while a connect is pending, another address
+    // of the host is tried every connectAttemptDelayMs; the first to connect wins
+    int connectAttemptDelayMs = 250;
+};
+
+// Connection attempts, for seeing how often the first address was not enough
+struct ConnectStats {
+    unsigned long attempts = 0;  // Sockets a connect was started on
+    unsigned long fallbacks = 0; // Connections won by an address other than the first
+    unsigned long ipv6 = 0;      // Connections won over IPv6
+};
+
+// Fetches that ended with FetchError::Timeout, by phase
+struct TimeoutStats {
+    unsigned long resolve = 0;
+    unsigned long connect = 0;
+    unsigned long tls = 0;
+    unsigned long firstByte = 0;
+    unsigned long read = 0;
+    unsigned long total = 0;
+};
+
+// Event-driven downloader: keeps many HTTP/HTTPS fetches in flight at once on
+// non-blocking sockets multiplexed through a single epoll instance. Nothing
+// blocks on a peer; a slow host only holds its own slots.
+//
+// Connections are HTTP/1.1 keep-alive and pooled per scheme://host, so a run
+// of fetches to the same host reuses one TCP + TLS session instead of paying
+// a new handshake for every URL.
+//
+// Bodies are de-framed (chunked / Content-Length) and decompressed as they
+// arrive, so Response::body always holds the plain payload.
+//
+// An AdmissionPolicy looks at every response header before the body is
+// read: unwanted types and oversized pages are dropped with
+// FetchError::Rejected, and bodies are cut off at their type's byte budget.
+//
+// Redirects are followed up to maxRedirects hops with loop detection, and
+// permanent ones are learned so later fetches of the old URL skip the hop.
+//
+// Hostnames are resolved asynchronously through a caching Resolver; pass one
+// in to share its cache (and prefetching) with the caller. New connections
+// race the host's IPv6 and IPv4 addresses Happy Eyeballs style, so a dead
+// address or a broken address family costs one attempt delay, not a timeout.
+//
+// Every phase of a fetch runs against a deadline kept on one TimerWheel
+// shared by all connections, so a host that accepts and then stalls or
+// trickles bytes costs a slot for a bounded time, never the whole crawl.
+//
+// With IoBackend::IoUring, connects, sends and receives are queued on an
+// io_uring and handed to the kernel in one system call per poll(). Receives
+// take their buffer from a provided-buffer ring only once data arrives, and
+// TLS runs over memory BIOs so OpenSSL never touches the socket. The state
+// machine above the transport is shared by both backends.
+class FetchEngine {
+public:
+    explicit FetchEngine(const FetchEngineOptions& options = FetchEngineOptions(), Resolver* resolver = nullptr);
+    ~FetchEngine();
+
+    FetchEngine(const FetchEngine&) = delete;
+    FetchEngine& operator=(const FetchEngine&) = delete;
+
+    // Queue a URL for download. onComplete receives the response (or the error)
+    // from a later poll(); fetches beyond the connection limits wait their turn.
+    // With onBody, a successful body is streamed to it instead of being collected.
+    // With admission, the fetch and its redirects are checked against that
+    // policy instead of admissionPolicy(); it must outlive the fetch.
+    void submit(const std::string& url, FetchCallback onComplete, BodyCallback onBody = nullptr,
+                const AdmissionPolicy* admission = nullptr);
+
+    // Wait up to timeoutMs (-1 = forever) for socket activity, advance every
+    // ready fetch and run the callbacks of the finished ones.
+    // Returns the number of callbacks that ran.
+    size_t poll(int timeoutMs);
+
+    // Drive the event loop until every submitted fetch has completed
+    void run();
+
+    size_t inFlight() const { return fetchesInFlight_; } // Submitted fetches whose callback has not run yet
+    size_t capacity() const { return options_.maxConnections; }
+    bool hasCapacity() const { return fetchesInFlight_ < options_.maxConnections; }
+    size_t openConnections() const { return connections_.size(); }
+    size_t idleConnections() const { return idle_.size(); }
+    Resolver& resolver() { return *resolver_; }
+
+    // Whether the io_uring backend is in use (it was asked for and the kernel supports it)
+    bool usingIoUring() const { return ring_ != nullptr; }
+    IoRingStats ioRingStats() const { return ring_ ? ring_->stats() : IoRingStats(); }
+
+    // Send If-None-Match / If-Modified-Since from store and keep it updated
+    // from responses; pages that did not change complete with notModified set
+    void setValidatorStore(ValidatorStore* store) { validators_ = store; }
+
+    // Permanent redirects learned so far (load / save it to keep them across runs)
+    RedirectMap& redirectMap() { return redirects_; }
+
+    // Which bodies are downloaded, and how large they may grow
+    AdmissionPolicy& admissionPolicy() { return admission_; }
+    const AdmissionStats& admissionStats() const { return admissionStats_; }
+
+    const TimeoutStats& timeoutStats() const { return timeoutStats_; }
+    const ConnectStats& connectStats() const { return connectStats_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    struct Fetch;
+    struct Connection;
+
+    // Per scheme://host bookkeeping for the connection pool
+    struct HostPool {
+        size_t open = 0;                            // Sockets to this host, in any state
+        std::deque<Connection*> idle;               // Keep-alive connections ready for reuse
+        std::deque<std::unique_ptr<Fetch>> waiting; // Fetches held back by maxConnectionsPerHost
+    };
+
+    // Fetches parked on one hostname lookup
+    struct DnsWait {
+        std::vector<std::unique_ptr<Fetch>> fetches;
+        uint32_t lookup = 0;             // Serial naming the lookup in its timer key
+        TimerWheel::TimerId timer = 0;
+    };
+
+    void start(std::unique_ptr<Fetch> fetch);
+    void dispatch(std::unique_ptr<Fetch> fetch, bool allowReuse = true);
+    void connectNew(HostPool& pool, std::unique_ptr<Fetch> fetch);
+    void awaitAddress(std::unique_ptr<Fetch> fetch);
+    void onResolved(const std::string& hostname);
+    bool connectNext(Connection& conn);
+    void connectFinished(Connection& conn, int fd, bool connected);
+    void closeAttempt(int fd);
+    void assign(Connection& conn, std::unique_ptr<Fetch> fetch);
+    void handleEvent(Connection& conn, int fd);
+    void advance(Connection& conn);
+    ssize_t receive(Connection& conn, bool& finished);
+    void streamBody(Fetch& fetch);
+    bool consume(Connection& conn, const char* data, size_t size);
+    bool admit(Connection& conn);
+    bool withinBudget(Connection& conn, size_t received);
+    size_t feedBody(Connection& conn, const char* data, size_t size);
+    bool completeFetch(Connection& conn);
+    void abortFetch(Connection& conn, FetchError error);
+    void watch(Connection& conn, uint32_t events);
+    void makeIdle(Connection& conn);
+    void closeConnection(Connection& conn);
+    void evictIdle(Clock::time_point now);
+    bool evictOldestIdle();
+    void pumpWaiting(const std::string& hostKey);
+    void complete(std::unique_ptr<Fetch> fetch, FetchError error);
+    std::string redirectTarget(const Fetch& fetch) const;
+    bool followRedirect(std::unique_ptr<Fetch>& fetch, FetchError& error);
+    ssize_t transportRead(Connection& conn, char* buffer, size_t size);
+    ssize_t transportWrite(Connection& conn, const char* data, size_t size);
+
+    // Deadlines
+    void startDeadline(Fetch& fetch);
+    Clock::time_point connectionDeadline(const Connection& conn, TimeoutPhase& phase) const;
+    void armTimer(Connection& conn);
+    void handleTimer(uint64_t key, Clock::time_point now);
+    void timeOut(std::unique_ptr<Fetch> fetch, TimeoutPhase phase);
+
+    // io_uring backend
+    void watchRing(Connection& conn, uint32_t events);
+    void flushRing(Connection& conn);
+    void handleCompletion(const IoCompletion& completion);
+    void receiveCompleted(Connection& conn, const IoCompletion& completion);
+    void sendCompleted(Connection& conn, int result);
+    void failRing(Connection& conn);
+
+    FetchEngineOptions options_;
+    int epollFd_;
+    std::unique_ptr<Resolver> ownedResolver_; // Set when no resolver was passed in
+    Resolver* resolver_;
+    ValidatorStore* validators_ = nullptr;
+    RedirectMap redirects_;
+    AdmissionPolicy admission_;
+    AdmissionStats admissionStats_;
+    TimeoutStats timeoutStats_;
+    ConnectStats connectStats_;
+    TimerWheel timers_;                            // Deadlines of every connection and DNS lookup
+    std::vector<uint64_t> expired_;                // Keys of the timers that fired in this poll()
+    size_t fetchesInFlight_ = 0;
+    uint32_t nextSerial_ = 0;
+    std::unordered_map<uint32_t, std::unique_ptr<Connection>> connections_; // Keyed by serial (a connecting one has several sockets)
+    std::unordered_map<std::string, HostPool> hosts_;
+    std::unordered_set<std::string> hostsWaiting_; // Hosts with fetches in HostPool::waiting
+    std::list<Connection*> idle_;                  // Idle connections, least recently used first
+    std::deque<std::unique_ptr<Fetch>> pending_;   // Waiting for a free global slot
+    std::unordered_map<std::string, DnsWait> awaitingDns_; // Keyed by hostname
+    std::unordered_map<uint32_t, std::string> lookups_;    // Hostname of each timed lookup, by lookup serial
+    std::deque<std::unique_ptr<Fetch>> completed_; // Callback not run yet
+    std::deque<std::unique_ptr<Fetch>> redirected_; // Next hop not started yet
+    std::vector<char> readBuffer_;                 // Shared by all connections; bytes are consumed before the next read
+    std::unordered_map<uint32_t, std::unique_ptr<Connection>> retired_; // Closed, with io_uring operations still in flight; keyed by serial
+    std::vector<uint32_t> starved_;                // Connections (by serial) whose receive found no free buffer
+    std::unique_ptr<IoRing> ring_;                 // Set when the io_uring backend is in use; destroyed first
+};
+
+#endif // FETCH_ENGINE_H
@@ -0,0 +1,150 @@
+#include "frontier.h"
+#include "url.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+// Slack for floating point drift when a bucket refills to exactly one token
+#define TOKEN_EPSILON 1e-9
+
+Frontier::Frontier(const FrontierOptions& options) : options_(options) {
+    options_.requestsPerSecond = std::max(options_.requestsPerSecond, 1e-6);
+    options_.burst = std::max(options_.burst, 1.0);
+}
+
+// Helper function to take the lowercase authority ("host[:port]") out of a URL
+std::string Frontier::hostOf(const std::string& url) {
+    UrlParts parts;
+    parseUrl(url, parts); // A malformed URL still gets a queue of its own
+    std::string host(parts.host);
+    if (!parts.port.empty()) host.append(":").append(parts.port);
+    for (char& ch : host) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    return host;
+}
+
+// Find a host's queue, creating it with a full bucket on first sight
+Frontier::HostQueue& Frontier::hostQueue(const std::string& host, Clock::time_point now) {
+    auto result = hosts_.try_emplace(host);
+    HostQueue& queue = result.first->second;
+    if (result.second) {
+        queue.rate = options_.requestsPerSecond;
+        queue.capacity = options_.burst;
+        queue.tokens = options_.burst;
+        queue.refilled = now;
+    }
+    return queue;
+}
+
+// Add the tokens earned since the last refill
+void Frontier::refill(HostQueue& queue, Clock::time_point now) const {
+    if (now <= queue.refilled) return;
+    double elapsed = std::chrono::duration<double>(now - queue.refilled).count();
+    queue.tokens = std::min(queue.capacity, queue.tokens + elapsed * queue.rate);
+    queue.refilled = now;
+}
+
+// Time at which the bucket holds a whole token again
+Frontier::Clock::time_point Frontier::nextAllowed(const HostQueue& queue, Clock::time_point now) const {
+    if (queue.tokens >= 1.0 - TOKEN_EPSILON) {
+        return now;
+    }
+    std::chrono::duration<double> wait((1.0 - queue.tokens) / queue.rate);
+    return queue.refilled + std::chrono::duration_cast<Clock::duration>(wait);
+}
+
+// Give a host with queued URLs a fresh entry in the ready heap
+void Frontier::schedule(const std::string& host, HostQueue& queue, Clock::time_point now) {
+    queue.due = nextAllowed(queue, now);
+    queue.scheduled = true;
+    ready_.emplace(queue.due, host);
+}
+
+void Frontier::push(const std::string& url) {
+    Clock::time_point now = Clock::now();
+    std::string host = hostOf(url);
+    HostQueue& queue = hostQueue(host, now);
+    queue.urls.push_back(url);
+    ++size_;
+    if (!queue.scheduled) {
+        refill(queue, now);
+        schedule(host, queue, now);
+    }
+}
+
+bool Frontier::pop(std::string& url, Clock::time_point now) {
+    while (!ready_.empty() && ready_.top().first <= now) {
+        ReadyEntry entry = ready_.top();
+        ready_.pop();
+
+        HostQueue& queue = hosts_.find(entry.second)->second;
+        if (!queue.scheduled || entry.first != queue.due) {
+            continue; // Superseded by a later schedule()
+        }
+        queue.scheduled = false;
+
+        refill(queue, now);
+        if (queue.tokens < 1.0 - TOKEN_EPSILON) {
+            schedule(entry.second, queue, now);
+            continue;
+        }
+        queue.tokens = std::max(queue.tokens - 1.0, 0.0);
+
+        url = std::move(queue.urls.front());
+        queue.urls.pop_front();
+        --size_;
+        if (!queue.urls.empty()) {
+            schedule(entry.second, queue, now);
+        }
+        return true;
+    }
+    return false;
+}
+
+int Frontier::msUntilReady(Clock::time_point now) const {
+    // Stale heap entries may outlive the last queued URL
+    if (size_ == 0 || ready_.empty()) {
+        return -1;
+    }
+    Clock::time_point due = ready_.top().first;
+    if (due <= now) {
+        return 0;
+    }
+    double wait = std::chrono::duration<double, std::milli>(due - now).count();
+    return static_cast<int>(std::ceil(wait));
+}
+
+void Frontier::setCrawlDelay(const std::string& host, double seconds) {
+    Clock::time_point now = Clock::now();
+    std::string key = hostOf(host);
+    HostQueue& queue = hostQueue(key, now);
+    refill(queue, now);
+
+    if (seconds > 0) {
+        queue.rate = 1.0 / seconds;
+        queue.capacity = 1.0;
+    } else {
+        queue.rate = options_.requestsPerSecond;
+        queue.capacity = options_.burst;
+    }
+    queue.tokens = std::min(queue.tokens, queue.capacity);
+
+    // The old heap entry may now be too early or too late
+    if (!queue.urls.empty()) {
+        schedule(key, queue, now);
+    }
+}
+
+void Frontier::backOff(const std::string& url, double seconds) {
+    Clock::time_point now = Clock::now();
+    std::string host = hostOf(url);
+    HostQueue& queue = hostQueue(host, now);
+    refill(queue, now);
+
+    // A bucket in debt refills for seconds before it holds a token again
+    queue.tokens = std::min(queue.tokens, 0.0) - seconds * queue.rate;
+
+    if (!queue.urls.empty()) {
+        schedule(host, queue, now);
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef FRONTIER_H
+#define FRONTIER_H
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Tunables for a Frontier
+struct FrontierOptions {
+    double requestsPerSecond = 2.0; // Sustained request rate allowed per host
+    double burst = 4.0;             // Requests a host that has been left alone may take at once
+};
+
+// Politeness scheduler for the crawl frontier. URLs wait in one queue per
+// host; each host refills a token bucket at its own rate, and a min-heap
+// keyed on the time each host may be fetched again hands out URLs from
+// whichever host is eligible first. A busy host is held to its rate while
+// the others keep the fetch engine supplied.
+class Frontier {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit Frontier(const FrontierOptions& options = FrontierOptions());
+
+    // Queue url behind the other URLs of its host
+    void push(const std::string& url);
+
+    // Take the next URL whose host may be fetched at now.
+    // Returns false when every queued host is still waiting for a token.
+    bool pop(std::string& url, Clock::time_point now = Clock::now());
+
+    // Milliseconds until pop() can next succeed: 0 if it can now, -1 if nothing is queued
+    int msUntilReady(Clock::time_point now = Clock::now()) const;
+
+    // Honor a robots.txt Crawl-delay for host ("example.com" or "example.com:8080"):
+    // at most one request per delay, without bursts. A delay of 0 restores the default rate.
+    void setCrawlDelay(const std::string& host, double seconds);
+
+    // Hold the host of url back for seconds on top of its rate, e.g. after it
+    // timed out. Penalties add up, so a host that keeps stalling is tried ever
+    // more rarely, and wear off as its bucket refills.
+    void backOff(const std::string& url, double seconds);
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+    size_t hosts() const { return hosts_.size(); } // Hosts seen so far, queued or not
+
+private:
+    struct HostQueue {
+        std::deque<std::string> urls;
+        double rate;               // Tokens per second
+        double capacity;           // Bucket size
+        double tokens;
+        Clock::time_point refilled;
+        bool scheduled = false;    // Has a live entry in ready_
+        Clock::time_point due;     // Time of that entry; older entries are stale
+    };
+    using ReadyEntry = std::pair<Clock::time_point, std::string>;
+
+    static std::string hostOf(const std::string& url);
+    HostQueue& hostQueue(const std::string& host, Clock::time_point now);
+    void refill(HostQueue& queue, Clock::time_point now) const;
+    Clock::time_point nextAllowed(const HostQueue& queue, Clock::time_point now) const;
+    void schedule(const std::string& host, HostQueue& queue, Clock::time_point now);
+
+    FrontierOptions options_;
+    std::unordered_map<std::string, HostQueue> hosts_;
+    // Earliest time each host with queued URLs may be fetched, soonest first
+    std::priority_queue<ReadyEntry, std::vector<ReadyEntry>, std::greater<ReadyEntry>> ready_;
+    size_t size_ = 0;
+};
+
+#endif // FRONTIER_H
@@ -0,0 +1,154 @@
+#include "html_entities.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Longest digit run a numeric reference reads. The spec reads any number
+// of digits; capping the run keeps a reference split across two pieces
+// small, and no page pads a code point this far.
+#define MAX_REFERENCE_DIGITS 32
+// Longest entity name without its ';', and longest legacy name (no ';')
+#define MAX_ENTITY_NAME 31
+#define MAX_LEGACY_NAME 6
+
+struct NamedEntity {
+    std::string_view name;  // Without the '&'
+    std::string_view value; // UTF-8
+};
+
+// FNV-1a with a seed mixed into the offset basis; utils/gen_html_entity_table.py
+// lays the table out with the same function
+static constexpr uint32_t entityHash(std::string_view name, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (char ch : name) {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+#include "html_entity_table.h"
+
+// Helper function to find the only slot a name can be in
+static constexpr size_t entitySlot(std::string_view name) {
+    int32_t seed = ENTITY_SEEDS[entityHash(name, 0) % ENTITY_BUCKET_COUNT];
+    if (seed < 0) return static_cast<size_t>(-seed - 1);
+    return entityHash(name, static_cast<uint32_t>(seed)) % ENTITY_COUNT;
+}
+
+// Every name must land in its own slot, checked whenever this file compiles
+static constexpr bool entityTableIsPerfect() {
+    for (size_t i = 0; i < ENTITY_COUNT; ++i) {
+        if (entitySlot(ENTITIES[i].name) != i) return false;
+    }
+    return true;
+}
+static_assert(entityTableIsPerfect(), "html_entity_table.h does not match entityHash(); regenerate it");
+
+// Helper function to look up a name (with its ';', if any)
+static const NamedEntity* findEntity(std::string_view name) {
+    const NamedEntity& entity = ENTITIES[entitySlot(name)];
+    return entity.name == name ? &entity : nullptr;
+}
+
+// What numeric references to 0x80-0x9F stand for: the windows-1252
+// characters at those bytes, or 0 where the code point is kept
+static const uint16_t C1_REPLACEMENTS[32] = {
+    0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+    0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178};
+
+size_t encodeUtf8(uint32_t codePoint, char* out) {
+    if (codePoint < 0x80) {
+        out[0] = static_cast<char>(codePoint);
+        return 1;
+    }
+    if (codePoint < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+        out[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        return 2;
+    }
+    if (codePoint < 0x10000) {
+        out[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+        out[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        return 3;
+    }
+    out[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+    out[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+    out[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    out[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    return 4;
+}
+
+// Helper function for the ASCII letters and digits entity names are made of
+static bool isNameChar(char ch) {
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9');
+}
+
+// Helper function for the value of a digit, or -1 if ch is not one
+static int digitValue(char ch, bool hex) {
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (!hex) return -1;
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    return -1;
+}
+
+// Helper function to decode "&#123;" or "&#x7B;"; the ';' may be missing
+static size_t decodeNumeric(std::string_view text, bool final, char* out, size_t& outSize) {
+    size_t i = 2;
+    bool hex = i < text.size() && (text[i] == 'x' || text[i] == 'X');
+    if (hex) ++i;
+    if (i == text.size()) return final ? 0 : REFERENCE_INCOMPLETE;
+
+    size_t digitsStart = i;
+    uint32_t value = 0;
+    while (i < text.size() && i - digitsStart < MAX_REFERENCE_DIGITS) {
+        int digit = digitValue(text[i], hex);
+        if (digit < 0) break;
+        if (value <= 0x10FFFF) value = value * (hex ? 16 : 10) + digit; // Past that it only has to stay too big
+        ++i;
+    }
+    if (i == digitsStart) return 0;
+    if (i == text.size() && !final) return REFERENCE_INCOMPLETE;
+    if (i < text.size() && text[i] == ';') ++i;
+
+    if (value == 0 || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) {
+        value = 0xFFFD;
+    } else if (value >= 0x80 && value <= 0x9F && C1_REPLACEMENTS[value - 0x80] != 0) {
+        value = C1_REPLACEMENTS[value - 0x80];
+    }
+    outSize = encodeUtf8(value, out);
+    return i;
+}
+
+size_t decodeCharacterReference(std::string_view text, bool final, char* out, size_t& outSize) {
+    outSize = 0;
+    if (text.size() > 1 && text[1] == '#') return decodeNumeric(text, final, out, outSize);
+
+    // Names are ASCII letters and digits; read as many as the longest name has
+    size_t i = 1;
+    while (i < text.size() && i <= MAX_ENTITY_NAME && isNameChar(text[i])) ++i;
+    if (i == text.size() && !final) return REFERENCE_INCOMPLETE;
+    size_t run = i - 1;
+    if (run == 0) return 0;
+
+    const NamedEntity* entity = nullptr;
+    size_t length = 0;
+    if (i < text.size() && text[i] == ';') {
+        entity = findEntity(text.substr(1, run + 1));
+        length = run + 2;
+    }
+    // Otherwise the longest legacy name the run starts with, as in "&notit;" (¬it;)
+    for (size_t legacy = std::min<size_t>(run, MAX_LEGACY_NAME); !entity && legacy >= 2; --legacy) {
+        entity = findEntity(text.substr(1, legacy));
+        length = legacy + 1;
+    }
+    if (!entity) return 0;
+
+    std::memcpy(out, entity->value.data(), entity->value.size());
+    outSize = entity->value.size();
+    return length;
+}
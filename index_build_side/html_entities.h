@@ -0,0 +1,32 @@
+#ifndef HTML_ENTITIES_H
+#define HTML_ENTITIES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Character reference decoding as the WHATWG tokenizer does it in text:
+// all 2231 named references, including the legacy ones that work without
+// a ';' ("&nbsp", "&copy"), and decimal or hex numeric references, whose
+// code points are checked and written out as UTF-8.
+//
+// Named references are looked up in a minimal perfect hash built at
+// compile time, so a lookup is two hashes of the name and one compare.
+
+// decodeCharacterReference() result for text that ends while a longer
+// reference could still follow
+#define REFERENCE_INCOMPLETE SIZE_MAX
+
+// Most UTF-8 bytes one reference decodes to
+#define MAX_REFERENCE_UTF8 8
+
+// Decode the character reference text starts with (text[0] is '&') into
+// out, setting outSize. Returns the number of bytes it spans, or 0 when
+// there is none and the '&' is plain text. Unless final is set (nothing
+// follows text), text that ends mid-reference gives REFERENCE_INCOMPLETE.
+size_t decodeCharacterReference(std::string_view text, bool final, char* out, size_t& outSize);
+
+// Write a code point as UTF-8; returns the number of bytes (1 to 4)
+size_t encodeUtf8(uint32_t codePoint, char* out);
+
+#endif // HTML_ENTITIES_H
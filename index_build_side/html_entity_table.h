@@ -0,0 +1,2295 @@
+// Generated by utils/gen_html_entity_table.py from the WHATWG named
+// character reference list; do not edit by hand.
+#ifndef HTML_ENTITY_TABLE_H
+#define HTML_ENTITY_TABLE_H
+
+#define ENTITY_COUNT 2231
+#define ENTITY_BUCKET_COUNT 743
+
+// Per bucket: -(slot + 1) for a single entry, else the seed of its second hash
+static constexpr int32_t ENTITY_SEEDS[ENTITY_BUCKET_COUNT] = {
+    -6, 23, 3, 0, 0, -49, 4, 10, 0, 4, 8, 1, -69, 79, 1, 32,
+    -88, 48, -92, 4, -93, -109, 1, 7, 51, 5, -153, 62, 14, 2, 10, 20,
+    7, 2, 4, 2, 32, 6, 2, 30, 17, 11, 2, 14, -201, 1, 23, -233,
+    2, 1, 15, 18, 3, -244, -261, 1, 4, 7, 15, 1, 13, 10, 26, 8,
+    1, 2, -264, 10, 26, 22, 2, 12, 6, 1, 17, 3, 1, 40, 10, 15,
+    11, 4, 14, 40, -266, 7, 57, 0, 63, -300, 11, -317, 22, 81, 4, 1,
+    19, -361, 28, 1, 2, 13, 14, 4, 11, 24, 52, 2, 2, 1, 0, 9,
+    -389, 4, 3, 18, 3, 1, 3, 2, 16, 10, 3, 65, 1, -431, 38, 2,
+    0, -459, 11, 1, 19, 3, -471, 13, 6, 6, 34, 1, 1, -489, -500, 3,
+    3, -512, 26, -545, 3, -560, 4, 2, 6, 17, 0, -619, 1, 56, 1, 0,
+    2, 0, 4, 1, 14, 1, 2, 1, 0, 3, 1, 1, 30, 2, 3, 48,
+    -623, 7, 1, 75, 2, 1, 26, 9, 5, -630, 57, 57, 43, 17, 2, 2,
+    -635, 3, 3, 1, 14, 14, 9, 5, 20, 3, 4, 46, 14, 21, 18, 5,
+    9, 1, 12, 1, 1, 2, 44, 3, 44, -641, -677, 7, 42, 27, 23, 5,
+    2, 66, 1, 34, 12, 16, 31, 1, 18, 5, 5, 7, 19, 2, 15, 18,
+    0, 1, 4, 1, 55, -697, 2, 6, 76, 31, -708, -731, 1, 1, -737, 3,
+    65, 0, 4, 9, 28, 5, 21, 50, 3, 17, -758, 5, 5, -774, 33, 2,
+    9, -815, 6, 35, 12, 5, 24, 2, -841, 2, 1, 7, 16, 8, 10, 6,
+    15, 23, 4, -848, 9, 49, 70, -851, 29, -860, 10, 32, 25, 1, 48, 57,
+    42, 1, 28, 24, 22, 0, 132, 2, 14, 39, 2, -878, 17, 15, 35, 199,
+    6, 30, 6, 12, 7, 66, 13, -914, -922, -926, 22, 2, 71, 20, -929, -935,
+    2, -945, 0, 59, 12, 1, -952, 76, 74, 34, 9, 76, 14, -1008, 11, -1078,
+    3, 8, 23, 2, -1100, -1114, 31, 17, 48, 2, 2, 71, 3, 10, 26, -1119,
+    2, 16, 20, 61, 28, 5, -1123, 2, 1, 43, 5, 31, 32, -1152, 5, 17,
+    0, -1163, 44, 7, -1164, -1192, 0, 2, 1, -1203, 16, 26, 182, 18, -1231, 41,
+    -1244, 0, 75, 1, 10, 38, 1, 2, -1281, -1288, 209, 42, 60, 9, 20, 0,
+    6, -1297, 9, 4, 10, 15, 2, 9, 5, 6, 9, 67, 95, 2, -1318, 9,
+    4, 5, 0, 133, 3, 1, 0, 26, 31, 1, -1340, -1343, -1360, 14, 44, 36,
+    -1388, 4, 20, 1, 1, 72, 31, 23, 2, 1, 32, -1403, 23, 17, -1404, -1412,
+    4, 1, 10, 9, -1417, 105, 105, 1, 3, 10, 42, 17, 6, 1, 7, 1,
+    40, 1, 1, 6, 33, 94, 184, 35, 46, 1, 1, 15, 36, 18, 20, 3,
+    2, 51, 0, -1421, -1458, 12, 35, 26, 23, -1462, 19, 36, 24, 6, -1471, 75,
+    157, 169, 103, 6, -1489, 3, 90, 328, 208, 459, 10, 25, 2, -1495, 8, 39,
+    24, -1523, 16, 11, -1538, 64, 190, 59, 157, 138, 2, 3, 4, -1581, 0, -1633,
+    -1656, 74, 134, 237, -1676, 2, 14, 55, -1689, 0, 18, 26, 101, 1, 225, 3,
+    37, -1738, 12, 32, 105, 24, 331, 182, 43, -1750, 36, 1, 2, 71, 103, 51,
+    7, 104, -1753, 1, 21, -1760, 2, 111, 167, 20, 22, 19, 542, 42, 98, -1802,
+    -1810, 4, 16, 74, 23, -1816, -1825, 369, 129, 126, 76, 7, 56, -1856, 7, 22,
+    -1858, 109, -1878, 124, 61, -1923, 72, 0, 0, 56, 14, 79, 60, 49, 12, 56,
+    265, 0, 4, 3, 5, 87, 141, 0, 20, 24, 396, 9, 2, 1, 72, 168,
+    30, 0, 300, 78, 88, 32, 19, 123, 1, 64, -1945, -1975, 261, -1987, 2, -1996,
+    18, 5, 29, 2, 0, 96, 26, 26, 36, 826, 310, 53, 4, 3, 376, -2017,
+    4, 21, 171, 2, -2024, 103, 2, 55, 3, 8, 2, 2, -2045, -2077, -2089, 1,
+    26, 35, 63, 199, 427, 353, 102, 38, 1, 17, 12, -2116, 60, 124, 99, 50,
+    377, 3, -2126, 15, 22, 1025, 94, -2182, 0, 1, 121, 103, 432, 671, 5, 217,
+    40, 135, 2, 109, 3, 12, 13, 152, 188, 54, 0, 5, 224, 10, 71, 2,
+    -2185, 10, -2198, 110, -2224, 22, 17,
+};
+
+// Names without the '&', with the ';' where the name needs one; values in UTF-8
+static constexpr NamedEntity ENTITIES[ENTITY_COUNT] = {
+    {"glj;", "\xe2\xaa\xa4"},
+    {"Copf;", "\xe2\x84\x82"},
+    {"Nfr;", "\xf0\x9d\x94\x91"},
+    {"RightTriangleEqual;", "\xe2\x8a\xb5"},
+    {"oelig;", "\xc5\x93"},
+    {"nrarrw;", "\xe2\x86\x9d\xcc\xb8"},
+    {"Escr;", "\xe2\x84\xb0"},
+    {"imped;", "\xc6\xb5"},
+    {"tridot;", "\xe2\x97\xac"},
+    {"ccupssm;", "\xe2\xa9\x90"},
+    {"utrif;", "\xe2\x96\xb4"},
+    {"Qfr;", "\xf0\x9d\x94\x94"},
+    {"Pscr;", "\xf0\x9d\x92\xab"},
+    {"phiv;", "\xcf\x95"},
+    {"parsl;", "\xe2\xab\xbd"},
+    {"eng;", "\xc5\x8b"},
+    {"olt;", "\xe2\xa7\x80"},
+    {"sup1", "\xc2\xb9"},
+    {"prnsim;", "\xe2\x8b\xa8"},
+    {"rmoust;", "\xe2\x8e\xb1"},
+    {"NotRightTriangleBar;", "\xe2\xa7\x90\xcc\xb8"},
+    {"blacktriangle;", "\xe2\x96\xb4"},
+    {"nabla;", "\xe2\x88\x87"},
+    {"boxVR;", "\xe2\x95\xa0"},
+    {"nsime;", "\xe2\x89\x84"},
+    {"uwangle;", "\xe2\xa6\xa7"},
+    {"quest;", "\x3f"},
+    {"prnE;", "\xe2\xaa\xb5"},
+    {"wp;", "\xe2\x84\x98"},
+    {"Aring;", "\xc3\x85"},
+    {"Idot;", "\xc4\xb0"},
+    {"smallsetminus;", "\xe2\x88\x96"},
+    {"Gcedil;", "\xc4\xa2"},
+    {"Ifr;", "\xe2\x84\x91"},
+    {"nwnear;", "\xe2\xa4\xa7"},
+    {"odiv;", "\xe2\xa8\xb8"},
+    {"els;", "\xe2\xaa\x95"},
+    {"ljcy;", "\xd1\x99"},
+    {"Equal;", "\xe2\xa9\xb5"},
+    {"prE;", "\xe2\xaa\xb3"},
+    {"yfr;", "\xf0\x9d\x94\xb6"},
+    {"plusacir;", "\xe2\xa8\xa3"},
+    {"rthree;", "\xe2\x8b\x8c"},
+    {"egsdot;", "\xe2\xaa\x98"},
+    {"bernou;", "\xe2\x84\xac"},
+    {"chi;", "\xcf\x87"},
+    {"boxbox;", "\xe2\xa7\x89"},
+    {"Sub;", "\xe2\x8b\x90"},
+    {"lscr;", "\xf0\x9d\x93\x81"},
+    {"cscr;", "\xf0\x9d\x92\xb8"},
+    {"suphsol;", "\xe2\x9f\x89"},
+    {"GreaterEqual;", "\xe2\x89\xa5"},
+    {"vscr;", "\xf0\x9d\x93\x8b"},
+    {"leftharpoonup;", "\xe2\x86\xbc"},
+    {"blk34;", "\xe2\x96\x93"},
+    {"NotGreaterTilde;", "\xe2\x89\xb5"},
+    {"xwedge;", "\xe2\x8b\x80"},
+    {"AMP;", "\x26"},
+    {"DiacriticalDot;", "\xcb\x99"},
+    {"Assign;", "\xe2\x89\x94"},
+    {"plus;", "\x2b"},
+    {"circleddash;", "\xe2\x8a\x9d"},
+    {"permil;", "\xe2\x80\xb0"},
+    {"QUOT;", "\x22"},
+    {"bumpe;", "\xe2\x89\x8f"},
+    {"Eogon;", "\xc4\x98"},
+    {"Prime;", "\xe2\x80\xb3"},
+    {"bigtriangleup;", "\xe2\x96\xb3"},
+    {"npre;", "\xe2\xaa\xaf\xcc\xb8"},
+    {"sup2;", "\xc2\xb2"},
+    {"SHcy;", "\xd0\xa8"},
+    {"xnis;", "\xe2\x8b\xbb"},
+    {"Eta;", "\xce\x97"},
+    {"half;", "\xc2\xbd"},
+    {"gl;", "\xe2\x89\xb7"},
+    {"Hopf;", "\xe2\x84\x8d"},
+    {"zwj;", "\xe2\x80\x8d"},
+    {"tcaron;", "\xc5\xa5"},
+    {"blacktriangleright;", "\xe2\x96\xb8"},
+    {"ntilde", "\xc3\xb1"},
+    {"Kcy;", "\xd0\x9a"},
+    {"there4;", "\xe2\x88\xb4"},
+    {"Ropf;", "\xe2\x84\x9d"},
+    {"thksim;", "\xe2\x88\xbc"},
+    {"deg;", "\xc2\xb0"},
+    {"between;", "\xe2\x89\xac"},
+    {"bowtie;", "\xe2\x8b\x88"},
+    {"raquo", "\xc2\xbb"},
+    {"CircleDot;", "\xe2\x8a\x99"},
+    {"DiacriticalDoubleAcute;", "\xcb\x9d"},
+    {"Lstrok;", "\xc5\x81"},
+    {"frac25;", "\xe2\x85\x96"},
+    {"subseteqq;", "\xe2\xab\x85"},
+    {"Tau;", "\xce\xa4"},
+    {"Element;", "\xe2\x88\x88"},
+    {"le;", "\xe2\x89\xa4"},
+    {"semi;", "\x3b"},
+    {"trianglelefteq;", "\xe2\x8a\xb4"},
+    {"olcross;", "\xe2\xa6\xbb"},
+    {"DZcy;", "\xd0\x8f"},
+    {"inodot;", "\xc4\xb1"},
+    {"zfr;", "\xf0\x9d\x94\xb7"},
+    {"dtri;", "\xe2\x96\xbf"},
+    {"die;", "\xc2\xa8"},
+    {"jukcy;", "\xd1\x94"},
+    {"Yacute;", "\xc3\x9d"},
+    {"Qscr;", "\xf0\x9d\x92\xac"},
+    {"Colone;", "\xe2\xa9\xb4"},
+    {"Ncy;", "\xd0\x9d"},
+    {"boxUR;", "\xe2\x95\x9a"},
+    {"pound", "\xc2\xa3"},
+    {"lcub;", "\x7b"},
+    {"RightDownVector;", "\xe2\x87\x82"},
+    {"rhard;", "\xe2\x87\x81"},
+    {"precsim;", "\xe2\x89\xbe"},
+    {"lltri;", "\xe2\x97\xba"},
+    {"ominus;", "\xe2\x8a\x96"},
+    {"RoundImplies;", "\xe2\xa5\xb0"},
+    {"yen;", "\xc2\xa5"},
+    {"sup3;", "\xc2\xb3"},
+    {"ratail;", "\xe2\xa4\x9a"},
+    {"lesdoto;", "\xe2\xaa\x81"},
+    {"vzigzag;", "\xe2\xa6\x9a"},
+    {"Intersection;", "\xe2\x8b\x82"},
+    {"leftrightsquigarrow;", "\xe2\x86\xad"},
+    {"nmid;", "\xe2\x88\xa4"},
+    {"zcaron;", "\xc5\xbe"},
+    {"sqcup;", "\xe2\x8a\x94"},
+    {"Wfr;", "\xf0\x9d\x94\x9a"},
+    {"Hscr;", "\xe2\x84\x8b"},
+    {"Dcy;", "\xd0\x94"},
+    {"sdotb;", "\xe2\x8a\xa1"},
+    {"leqq;", "\xe2\x89\xa6"},
+    {"boxdr;", "\xe2\x94\x8c"},
+    {"ccups;", "\xe2\xa9\x8c"},
+    {"CHcy;", "\xd0\xa7"},
+    {"LeftTeeVector;", "\xe2\xa5\x9a"},
+    {"Iuml", "\xc3\x8f"},
+    {"intprod;", "\xe2\xa8\xbc"},
+    {"gammad;", "\xcf\x9d"},
+    {"Not;", "\xe2\xab\xac"},
+    {"larrb;", "\xe2\x87\xa4"},
+    {"scap;", "\xe2\xaa\xb8"},
+    {"umacr;", "\xc5\xab"},
+    {"rfloor;", "\xe2\x8c\x8b"},
+    {"RightArrow;", "\xe2\x86\x92"},
+    {"ecaron;", "\xc4\x9b"},
+    {"sung;", "\xe2\x99\xaa"},
+    {"angmsdaa;", "\xe2\xa6\xa8"},
+    {"cir;", "\xe2\x97\x8b"},
+    {"Mopf;", "\xf0\x9d\x95\x84"},
+    {"boxH;", "\xe2\x95\x90"},
+    {"Bopf;", "\xf0\x9d\x94\xb9"},
+    {"simdot;", "\xe2\xa9\xaa"},
+    {"bbrk;", "\xe2\x8e\xb5"},
+    {"LJcy;", "\xd0\x89"},
+    {"Supset;", "\xe2\x8b\x91"},
+    {"glE;", "\xe2\xaa\x92"},
+    {"supE;", "\xe2\xab\x86"},
+    {"Ecaron;", "\xc4\x9a"},
+    {"gnap;", "\xe2\xaa\x8a"},
+    {"gjcy;", "\xd1\x93"},
+    {"vcy;", "\xd0\xb2"},
+    {"Union;", "\xe2\x8b\x83"},
+    {"larrlp;", "\xe2\x86\xab"},
+    {"nearrow;", "\xe2\x86\x97"},
+    {"Bcy;", "\xd0\x91"},
+    {"Xi;", "\xce\x9e"},
+    {"ratio;", "\xe2\x88\xb6"},
+    {"Rcaron;", "\xc5\x98"},
+    {"lnapprox;", "\xe2\xaa\x89"},
+    {"upharpoonleft;", "\xe2\x86\xbf"},
+    {"caron;", "\xcb\x87"},
+    {"LeftUpTeeVector;", "\xe2\xa5\xa0"},
+    {"nsupseteqq;", "\xe2\xab\x86\xcc\xb8"},
+    {"LeftRightVector;", "\xe2\xa5\x8e"},
+    {"Xfr;", "\xf0\x9d\x94\x9b"},
+    {"HARDcy;", "\xd0\xaa"},
+    {"fork;", "\xe2\x8b\x94"},
+    {"searhk;", "\xe2\xa4\xa5"},
+    {"PrecedesTilde;", "\xe2\x89\xbe"},
+    {"LeftArrow;", "\xe2\x86\x90"},
+    {"bprime;", "\xe2\x80\xb5"},
+    {"THORN", "\xc3\x9e"},
+    {"shchcy;", "\xd1\x89"},
+    {"lsquor;", "\xe2\x80\x9a"},
+    {"rtrie;", "\xe2\x8a\xb5"},
+    {"mdash;", "\xe2\x80\x94"},
+    {"pr;", "\xe2\x89\xba"},
+    {"Pcy;", "\xd0\x9f"},
+    {"rfisht;", "\xe2\xa5\xbd"},
+    {"ogt;", "\xe2\xa7\x81"},
+    {"npr;", "\xe2\x8a\x80"},
+    {"plusdo;", "\xe2\x88\x94"},
+    {"hairsp;", "\xe2\x80\x8a"},
+    {"straightphi;", "\xcf\x95"},
+    {"cemptyv;", "\xe2\xa6\xb2"},
+    {"rAtail;", "\xe2\xa4\x9c"},
+    {"Jcy;", "\xd0\x99"},
+    {"xuplus;", "\xe2\xa8\x84"},
+    {"dfisht;", "\xe2\xa5\xbf"},
+    {"efDot;", "\xe2\x89\x92"},
+    {"djcy;", "\xd1\x92"},
+    {"szlig;", "\xc3\x9f"},
+    {"Euml;", "\xc3\x8b"},
+    {"Congruent;", "\xe2\x89\xa1"},
+    {"lrcorner;", "\xe2\x8c\x9f"},
+    {"YAcy;", "\xd0\xaf"},
+    {"Rscr;", "\xe2\x84\x9b"},
+    {"iuml;", "\xc3\xaf"},
+    {"urcrop;", "\xe2\x8c\x8e"},
+    {"bsolhsub;", "\xe2\x9f\x88"},
+    {"dash;", "\xe2\x80\x90"},
+    {"nvsim;", "\xe2\x88\xbc\xe2\x83\x92"},
+    {"simlE;", "\xe2\xaa\x9f"},
+    {"thickapprox;", "\xe2\x89\x88"},
+    {"tstrok;", "\xc5\xa7"},
+    {"ForAll;", "\xe2\x88\x80"},
+    {"lates;", "\xe2\xaa\xad\xef\xb8\x80"},
+    {"dashv;", "\xe2\x8a\xa3"},
+    {"lnsim;", "\xe2\x8b\xa6"},
+    {"ssmile;", "\xe2\x8c\xa3"},
+    {"puncsp;", "\xe2\x80\x88"},
+    {"AElig;", "\xc3\x86"},
+    {"triangleleft;", "\xe2\x97\x83"},
+    {"lt", "\x3c"},
+    {"gfr;", "\xf0\x9d\x94\xa4"},
+    {"hearts;", "\xe2\x99\xa5"},
+    {"uharl;", "\xe2\x86\xbf"},
+    {"iogon;", "\xc4\xaf"},
+    {"leftrightharpoons;", "\xe2\x87\x8b"},
+    {"Auml;", "\xc3\x84"},
+    {"acute;", "\xc2\xb4"},
+    {"NotSubsetEqual;", "\xe2\x8a\x88"},
+    {"Exists;", "\xe2\x88\x83"},
+    {"Scirc;", "\xc5\x9c"},
+    {"oscr;", "\xe2\x84\xb4"},
+    {"nGg;", "\xe2\x8b\x99\xcc\xb8"},
+    {"atilde;", "\xc3\xa3"},
+    {"iocy;", "\xd1\x91"},
+    {"parsim;", "\xe2\xab\xb3"},
+    {"acy;", "\xd0\xb0"},
+    {"Kfr;", "\xf0\x9d\x94\x8e"},
+    {"nLt;", "\xe2\x89\xaa\xe2\x83\x92"},
+    {"roang;", "\xe2\x9f\xad"},
+    {"dscr;", "\xf0\x9d\x92\xb9"},
+    {"orderof;", "\xe2\x84\xb4"},
+    {"Pr;", "\xe2\xaa\xbb"},
+    {"Umacr;", "\xc5\xaa"},
+    {"SquareIntersection;", "\xe2\x8a\x93"},
+    {"tprime;", "\xe2\x80\xb4"},
+    {"mumap;", "\xe2\x8a\xb8"},
+    {"boxVh;", "\xe2\x95\xab"},
+    {"LongLeftArrow;", "\xe2\x9f\xb5"},
+    {"larrfs;", "\xe2\xa4\x9d"},
+    {"pcy;", "\xd0\xbf"},
+    {"siml;", "\xe2\xaa\x9d"},
+    {"TripleDot;", "\xe2\x83\x9b"},
+    {"larrbfs;", "\xe2\xa4\x9f"},
+    {"jcy;", "\xd0\xb9"},
+    {"notni;", "\xe2\x88\x8c"},
+    {"cong;", "\xe2\x89\x85"},
+    {"Vert;", "\xe2\x80\x96"},
+    {"blacksquare;", "\xe2\x96\xaa"},
+    {"rarrc;", "\xe2\xa4\xb3"},
+    {"NotSucceedsEqual;", "\xe2\xaa\xb0\xcc\xb8"},
+    {"boxdl;", "\xe2\x94\x90"},
+    {"Gscr;", "\xf0\x9d\x92\xa2"},
+    {"oline;", "\xe2\x80\xbe"},
+    {"Proportion;", "\xe2\x88\xb7"},
+    {"Ntilde;", "\xc3\x91"},
+    {"profalar;", "\xe2\x8c\xae"},
+    {"NotLessLess;", "\xe2\x89\xaa\xcc\xb8"},
+    {"boxvL;", "\xe2\x95\xa1"},
+    {"dfr;", "\xf0\x9d\x94\xa1"},
+    {"ocy;", "\xd0\xbe"},
+    {"LowerLeftArrow;", "\xe2\x86\x99"},
+    {"ange;", "\xe2\xa6\xa4"},
+    {"vopf;", "\xf0\x9d\x95\xa7"},
+    {"fallingdotseq;", "\xe2\x89\x92"},
+    {"Atilde;", "\xc3\x83"},
+    {"DownRightVectorBar;", "\xe2\xa5\x97"},
+    {"GreaterTilde;", "\xe2\x89\xb3"},
+    {"checkmark;", "\xe2\x9c\x93"},
+    {"angmsdab;", "\xe2\xa6\xa9"},
+    {"DiacriticalAcute;", "\xc2\xb4"},
+    {"NotGreaterSlantEqual;", "\xe2\xa9\xbe\xcc\xb8"},
+    {"gesdoto;", "\xe2\xaa\x82"},
+    {"circledS;", "\xe2\x93\x88"},
+    {"intlarhk;", "\xe2\xa8\x97"},
+    {"commat;", "\x40"},
+    {"andslope;", "\xe2\xa9\x98"},
+    {"Poincareplane;", "\xe2\x84\x8c"},
+    {"lsaquo;", "\xe2\x80\xb9"},
+    {"UnderBracket;", "\xe2\x8e\xb5"},
+    {"awint;", "\xe2\xa8\x91"},
+    {"TildeTilde;", "\xe2\x89\x88"},
+    {"Vscr;", "\xf0\x9d\x92\xb1"},
+    {"capbrcup;", "\xe2\xa9\x89"},
+    {"natur;", "\xe2\x99\xae"},
+    {"Because;", "\xe2\x88\xb5"},
+    {"num;", "\x23"},
+    {"subsetneq;", "\xe2\x8a\x8a"},
+    {"dzcy;", "\xd1\x9f"},
+    {"geqslant;", "\xe2\xa9\xbe"},
+    {"elsdot;", "\xe2\xaa\x97"},
+    {"sube;", "\xe2\x8a\x86"},
+    {"RightTriangleBar;", "\xe2\xa7\x90"},
+    {"yscr;", "\xf0\x9d\x93\x8e"},
+    {"ensp;", "\xe2\x80\x82"},
+    {"gcirc;", "\xc4\x9d"},
+    {"eta;", "\xce\xb7"},
+    {"oopf;", "\xf0\x9d\x95\xa0"},
+    {"rbrksld;", "\xe2\xa6\x8e"},
+    {"hookleftarrow;", "\xe2\x86\xa9"},
+    {"ii;", "\xe2\x85\x88"},
+    {"cedil;", "\xc2\xb8"},
+    {"uacute;", "\xc3\xba"},
+    {"OElig;", "\xc5\x92"},
+    {"Diamond;", "\xe2\x8b\x84"},
+    {"yicy;", "\xd1\x97"},
+    {"ffllig;", "\xef\xac\x84"},
+    {"uArr;", "\xe2\x87\x91"},
+    {"dscy;", "\xd1\x95"},
+    {"Jfr;", "\xf0\x9d\x94\x8d"},
+    {"Laplacetrf;", "\xe2\x84\x92"},
+    {"nsucceq;", "\xe2\xaa\xb0\xcc\xb8"},
+    {"Otilde", "\xc3\x95"},
+    {"lbrace;", "\x7b"},
+    {"nshortmid;", "\xe2\x88\xa4"},
+    {"imath;", "\xc4\xb1"},
+    {"lang;", "\xe2\x9f\xa8"},
+    {"rightleftharpoons;", "\xe2\x87\x8c"},
+    {"Jcirc;", "\xc4\xb4"},
+    {"Otimes;", "\xe2\xa8\xb7"},
+    {"incare;", "\xe2\x84\x85"},
+    {"LT;", "\x3c"},
+    {"lg;", "\xe2\x89\xb6"},
+    {"lAarr;", "\xe2\x87\x9a"},
+    {"NotHumpDownHump;", "\xe2\x89\x8e\xcc\xb8"},
+    {"nlE;", "\xe2\x89\xa6\xcc\xb8"},
+    {"precnsim;", "\xe2\x8b\xa8"},
+    {"DownTee;", "\xe2\x8a\xa4"},
+    {"dsol;", "\xe2\xa7\xb6"},
+    {"loarr;", "\xe2\x87\xbd"},
+    {"curlyeqsucc;", "\xe2\x8b\x9f"},
+    {"NotReverseElement;", "\xe2\x88\x8c"},
+    {"nrtri;", "\xe2\x8b\xab"},
+    {"ldrushar;", "\xe2\xa5\x8b"},
+    {"zhcy;", "\xd0\xb6"},
+    {"NotLessGreater;", "\xe2\x89\xb8"},
+    {"Acirc;", "\xc3\x82"},
+    {"Kopf;", "\xf0\x9d\x95\x82"},
+    {"ouml", "\xc3\xb6"},
+    {"qopf;", "\xf0\x9d\x95\xa2"},
+    {"iexcl", "\xc2\xa1"},
+    {"andand;", "\xe2\xa9\x95"},
+    {"Gopf;", "\xf0\x9d\x94\xbe"},
+    {"Ycirc;", "\xc5\xb6"},
+    {"ETH", "\xc3\x90"},
+    {"DifferentialD;", "\xe2\x85\x86"},
+    {"rdsh;", "\xe2\x86\xb3"},
+    {"nlt;", "\xe2\x89\xae"},
+    {"parallel;", "\xe2\x88\xa5"},
+    {"Gfr;", "\xf0\x9d\x94\x8a"},
+    {"Ucirc", "\xc3\x9b"},
+    {"midcir;", "\xe2\xab\xb0"},
+    {"quot;", "\x22"},
+    {"DownArrow;", "\xe2\x86\x93"},
+    {"sharp;", "\xe2\x99\xaf"},
+    {"ell;", "\xe2\x84\x93"},
+    {"NestedGreaterGreater;", "\xe2\x89\xab"},
+    {"notinE;", "\xe2\x8b\xb9\xcc\xb8"},
+    {"lopf;", "\xf0\x9d\x95\x9d"},
+    {"DiacriticalTilde;", "\xcb\x9c"},
+    {"Scy;", "\xd0\xa1"},
+    {"ntriangleleft;", "\xe2\x8b\xaa"},
+    {"xoplus;", "\xe2\xa8\x81"},
+    {"ruluhar;", "\xe2\xa5\xa8"},
+    {"eplus;", "\xe2\xa9\xb1"},
+    {"star;", "\xe2\x98\x86"},
+    {"Omicron;", "\xce\x9f"},
+    {"RightDownTeeVector;", "\xe2\xa5\x9d"},
+    {"SquareSupersetEqual;", "\xe2\x8a\x92"},
+    {"Esim;", "\xe2\xa9\xb3"},
+    {"Scaron;", "\xc5\xa0"},
+    {"hyphen;", "\xe2\x80\x90"},
+    {"OverBrace;", "\xe2\x8f\x9e"},
+    {"cylcty;", "\xe2\x8c\xad"},
+    {"Fscr;", "\xe2\x84\xb1"},
+    {"marker;", "\xe2\x96\xae"},
+    {"lnE;", "\xe2\x89\xa8"},
+    {"vDash;", "\xe2\x8a\xa8"},
+    {"xotime;", "\xe2\xa8\x82"},
+    {"rdquor;", "\xe2\x80\x9d"},
+    {"notinvc;", "\xe2\x8b\xb6"},
+    {"drcorn;", "\xe2\x8c\x9f"},
+    {"Dopf;", "\xf0\x9d\x94\xbb"},
+    {"AMP", "\x26"},
+    {"nequiv;", "\xe2\x89\xa2"},
+    {"ZeroWidthSpace;", "\xe2\x80\x8b"},
+    {"daleth;", "\xe2\x84\xb8"},
+    {"nltri;", "\xe2\x8b\xaa"},
+    {"Gcy;", "\xd0\x93"},
+    {"CirclePlus;", "\xe2\x8a\x95"},
+    {"npar;", "\xe2\x88\xa6"},
+    {"barvee;", "\xe2\x8a\xbd"},
+    {"dot;", "\xcb\x99"},
+    {"realpart;", "\xe2\x84\x9c"},
+    {"Cross;", "\xe2\xa8\xaf"},
+    {"Wcirc;", "\xc5\xb4"},
+    {"leftrightarrow;", "\xe2\x86\x94"},
+    {"blank;", "\xe2\x90\xa3"},
+    {"dotminus;", "\xe2\x88\xb8"},
+    {"beth;", "\xe2\x84\xb6"},
+    {"xcup;", "\xe2\x8b\x83"},
+    {"Jukcy;", "\xd0\x84"},
+    {"lfisht;", "\xe2\xa5\xbc"},
+    {"smtes;", "\xe2\xaa\xac\xef\xb8\x80"},
+    {"Ccirc;", "\xc4\x88"},
+    {"ddarr;", "\xe2\x87\x8a"},
+    {"pound;", "\xc2\xa3"},
+    {"succneqq;", "\xe2\xaa\xb6"},
+    {"Iukcy;", "\xd0\x86"},
+    {"timesb;", "\xe2\x8a\xa0"},
+    {"simplus;", "\xe2\xa8\xa4"},
+    {"blk14;", "\xe2\x96\x91"},
+    {"nvdash;", "\xe2\x8a\xac"},
+    {"bnot;", "\xe2\x8c\x90"},
+    {"rBarr;", "\xe2\xa4\x8f"},
+    {"vert;", "\x7c"},
+    {"Pi;", "\xce\xa0"},
+    {"nlarr;", "\xe2\x86\x9a"},
+    {"measuredangle;", "\xe2\x88\xa1"},
+    {"NotSquareSuperset;", "\xe2\x8a\x90\xcc\xb8"},
+    {"boxvH;", "\xe2\x95\xaa"},
+    {"gcy;", "\xd0\xb3"},
+    {"NewLine;", "\x0a"},
+    {"nsubseteq;", "\xe2\x8a\x88"},
+    {"blk12;", "\xe2\x96\x92"},
+    {"Im;", "\xe2\x84\x91"},
+    {"niv;", "\xe2\x88\x8b"},
+    {"napprox;", "\xe2\x89\x89"},
+    {"Ccedil", "\xc3\x87"},
+    {"sccue;", "\xe2\x89\xbd"},
+    {"leftrightarrows;", "\xe2\x87\x86"},
+    {"dblac;", "\xcb\x9d"},
+    {"clubsuit;", "\xe2\x99\xa3"},
+    {"Updownarrow;", "\xe2\x87\x95"},
+    {"boxUL;", "\xe2\x95\x9d"},
+    {"Jsercy;", "\xd0\x88"},
+    {"MediumSpace;", "\xe2\x81\x9f"},
+    {"Rang;", "\xe2\x9f\xab"},
+    {"xhArr;", "\xe2\x9f\xba"},
+    {"para", "\xc2\xb6"},
+    {"NegativeThinSpace;", "\xe2\x80\x8b"},
+    {"gtrless;", "\xe2\x89\xb7"},
+    {"ReverseEquilibrium;", "\xe2\x87\x8b"},
+    {"gscr;", "\xe2\x84\x8a"},
+    {"Ucirc;", "\xc3\x9b"},
+    {"Sopf;", "\xf0\x9d\x95\x8a"},
+    {"ltcc;", "\xe2\xaa\xa6"},
+    {"straightepsilon;", "\xcf\xb5"},
+    {"nsup;", "\xe2\x8a\x85"},
+    {"lsime;", "\xe2\xaa\x8d"},
+    {"RightFloor;", "\xe2\x8c\x8b"},
+    {"nearr;", "\xe2\x86\x97"},
+    {"InvisibleTimes;", "\xe2\x81\xa2"},
+    {"supsup;", "\xe2\xab\x96"},
+    {"ycy;", "\xd1\x8b"},
+    {"longleftarrow;", "\xe2\x9f\xb5"},
+    {"ntriangleright;", "\xe2\x8b\xab"},
+    {"lowbar;", "\x5f"},
+    {"nltrie;", "\xe2\x8b\xac"},
+    {"prec;", "\xe2\x89\xba"},
+    {"PrecedesEqual;", "\xe2\xaa\xaf"},
+    {"rotimes;", "\xe2\xa8\xb5"},
+    {"hArr;", "\xe2\x87\x94"},
+    {"nharr;", "\xe2\x86\xae"},
+    {"Iopf;", "\xf0\x9d\x95\x80"},
+    {"gsiml;", "\xe2\xaa\x90"},
+    {"spar;", "\xe2\x88\xa5"},
+    {"Eacute", "\xc3\x89"},
+    {"nu;", "\xce\xbd"},
+    {"Gt;", "\xe2\x89\xab"},
+    {"trie;", "\xe2\x89\x9c"},
+    {"bcy;", "\xd0\xb1"},
+    {"iota;", "\xce\xb9"},
+    {"UpArrowBar;", "\xe2\xa4\x92"},
+    {"DiacriticalGrave;", "\x60"},
+    {"simrarr;", "\xe2\xa5\xb2"},
+    {"eqsim;", "\xe2\x89\x82"},
+    {"shortparallel;", "\xe2\x88\xa5"},
+    {"pointint;", "\xe2\xa8\x95"},
+    {"LeftCeiling;", "\xe2\x8c\x88"},
+    {"deg", "\xc2\xb0"},
+    {"veeeq;", "\xe2\x89\x9a"},
+    {"RightVector;", "\xe2\x87\x80"},
+    {"timesbar;", "\xe2\xa8\xb1"},
+    {"Imacr;", "\xc4\xaa"},
+    {"otilde;", "\xc3\xb5"},
+    {"gtrsim;", "\xe2\x89\xb3"},
+    {"times", "\xc3\x97"},
+    {"nbsp;", "\xc2\xa0"},
+    {"boxhu;", "\xe2\x94\xb4"},
+    {"thetav;", "\xcf\x91"},
+    {"nacute;", "\xc5\x84"},
+    {"vprop;", "\xe2\x88\x9d"},
+    {"triplus;", "\xe2\xa8\xb9"},
+    {"vartriangleright;", "\xe2\x8a\xb3"},
+    {"YUcy;", "\xd0\xae"},
+    {"Map;", "\xe2\xa4\x85"},
+    {"DoubleVerticalBar;", "\xe2\x88\xa5"},
+    {"gtrapprox;", "\xe2\xaa\x86"},
+    {"cuesc;", "\xe2\x8b\x9f"},
+    {"quatint;", "\xe2\xa8\x96"},
+    {"nexists;", "\xe2\x88\x84"},
+    {"emsp14;", "\xe2\x80\x85"},
+    {"becaus;", "\xe2\x88\xb5"},
+    {"female;", "\xe2\x99\x80"},
+    {"apos;", "\x27"},
+    {"bnequiv;", "\xe2\x89\xa1\xe2\x83\xa5"},
+    {"ascr;", "\xf0\x9d\x92\xb6"},
+    {"lbbrk;", "\xe2\x9d\xb2"},
+    {"rect;", "\xe2\x96\xad"},
+    {"Lcedil;", "\xc4\xbb"},
+    {"racute;", "\xc5\x95"},
+    {"smashp;", "\xe2\xa8\xb3"},
+    {"boxV;", "\xe2\x95\x91"},
+    {"hslash;", "\xe2\x84\x8f"},
+    {"grave;", "\x60"},
+    {"leq;", "\xe2\x89\xa4"},
+    {"laemptyv;", "\xe2\xa6\xb4"},
+    {"subdot;", "\xe2\xaa\xbd"},
+    {"rbrke;", "\xe2\xa6\x8c"},
+    {"rrarr;", "\xe2\x87\x89"},
+    {"empty;", "\xe2\x88\x85"},
+    {"Lmidot;", "\xc4\xbf"},
+    {"Wedge;", "\xe2\x8b\x80"},
+    {"Bumpeq;", "\xe2\x89\x8e"},
+    {"ubreve;", "\xc5\xad"},
+    {"nbump;", "\xe2\x89\x8e\xcc\xb8"},
+    {"Udblac;", "\xc5\xb0"},
+    {"ShortDownArrow;", "\xe2\x86\x93"},
+    {"frac58;", "\xe2\x85\x9d"},
+    {"lrtri;", "\xe2\x8a\xbf"},
+    {"Longleftarrow;", "\xe2\x9f\xb8"},
+    {"subset;", "\xe2\x8a\x82"},
+    {"xutri;", "\xe2\x96\xb3"},
+    {"RightDoubleBracket;", "\xe2\x9f\xa7"},
+    {"NotSupersetEqual;", "\xe2\x8a\x89"},
+    {"Hacek;", "\xcb\x87"},
+    {"varkappa;", "\xcf\xb0"},
+    {"iscr;", "\xf0\x9d\x92\xbe"},
+    {"Ocy;", "\xd0\x9e"},
+    {"RightArrowLeftArrow;", "\xe2\x87\x84"},
+    {"ne;", "\xe2\x89\xa0"},
+    {"cupcap;", "\xe2\xa9\x86"},
+    {"LeftDownTeeVector;", "\xe2\xa5\xa1"},
+    {"doteqdot;", "\xe2\x89\x91"},
+    {"Racute;", "\xc5\x94"},
+    {"doublebarwedge;", "\xe2\x8c\x86"},
+    {"gneqq;", "\xe2\x89\xa9"},
+    {"Uarr;", "\xe2\x86\x9f"},
+    {"ecolon;", "\xe2\x89\x95"},
+    {"nwarr;", "\xe2\x86\x96"},
+    {"NotEqual;", "\xe2\x89\xa0"},
+    {"suphsub;", "\xe2\xab\x97"},
+    {"NotDoubleVerticalBar;", "\xe2\x88\xa6"},
+    {"UnderParenthesis;", "\xe2\x8f\x9d"},
+    {"ocirc", "\xc3\xb4"},
+    {"xrArr;", "\xe2\x9f\xb9"},
+    {"simg;", "\xe2\xaa\x9e"},
+    {"udblac;", "\xc5\xb1"},
+    {"isinv;", "\xe2\x88\x88"},
+    {"Sacute;", "\xc5\x9a"},
+    {"hoarr;", "\xe2\x87\xbf"},
+    {"odot;", "\xe2\x8a\x99"},
+    {"boxHu;", "\xe2\x95\xa7"},
+    {"angmsdac;", "\xe2\xa6\xaa"},
+    {"ecir;", "\xe2\x89\x96"},
+    {"horbar;", "\xe2\x80\x95"},
+    {"lessdot;", "\xe2\x8b\x96"},
+    {"mcomma;", "\xe2\xa8\xa9"},
+    {"curarrm;", "\xe2\xa4\xbc"},
+    {"minusd;", "\xe2\x88\xb8"},
+    {"QUOT", "\x22"},
+    {"boxvr;", "\xe2\x94\x9c"},
+    {"Otilde;", "\xc3\x95"},
+    {"intcal;", "\xe2\x8a\xba"},
+    {"simeq;", "\xe2\x89\x83"},
+    {"NJcy;", "\xd0\x8a"},
+    {"asympeq;", "\xe2\x89\x8d"},
+    {"Mcy;", "\xd0\x9c"},
+    {"mstpos;", "\xe2\x88\xbe"},
+    {"Ograve;", "\xc3\x92"},
+    {"nearhk;", "\xe2\xa4\xa4"},
+    {"rarrap;", "\xe2\xa5\xb5"},
+    {"succnapprox;", "\xe2\xaa\xba"},
+    {"aring", "\xc3\xa5"},
+    {"phone;", "\xe2\x98\x8e"},
+    {"NotLessEqual;", "\xe2\x89\xb0"},
+    {"vdash;", "\xe2\x8a\xa2"},
+    {"bullet;", "\xe2\x80\xa2"},
+    {"utdot;", "\xe2\x8b\xb0"},
+    {"LeftArrowRightArrow;", "\xe2\x87\x86"},
+    {"vee;", "\xe2\x88\xa8"},
+    {"PrecedesSlantEqual;", "\xe2\x89\xbc"},
+    {"rarrhk;", "\xe2\x86\xaa"},
+    {"LeftTriangle;", "\xe2\x8a\xb2"},
+    {"rscr;", "\xf0\x9d\x93\x87"},
+    {"UnderBar;", "\x5f"},
+    {"pre;", "\xe2\xaa\xaf"},
+    {"boxhd;", "\xe2\x94\xac"},
+    {"iecy;", "\xd0\xb5"},
+    {"nvinfin;", "\xe2\xa7\x9e"},
+    {"rangle;", "\xe2\x9f\xa9"},
+    {"angzarr;", "\xe2\x8d\xbc"},
+    {"capcup;", "\xe2\xa9\x87"},
+    {"Zcaron;", "\xc5\xbd"},
+    {"robrk;", "\xe2\x9f\xa7"},
+    {"gnsim;", "\xe2\x8b\xa7"},
+    {"ShortUpArrow;", "\xe2\x86\x91"},
+    {"ltcir;", "\xe2\xa9\xb9"},
+    {"ulcorner;", "\xe2\x8c\x9c"},
+    {"conint;", "\xe2\x88\xae"},
+    {"smid;", "\xe2\x88\xa3"},
+    {"expectation;", "\xe2\x84\xb0"},
+    {"Wscr;", "\xf0\x9d\x92\xb2"},
+    {"xodot;", "\xe2\xa8\x80"},
+    {"gneq;", "\xe2\xaa\x88"},
+    {"sacute;", "\xc5\x9b"},
+    {"profline;", "\xe2\x8c\x92"},
+    {"iopf;", "\xf0\x9d\x95\x9a"},
+    {"Coproduct;", "\xe2\x88\x90"},
+    {"LessTilde;", "\xe2\x89\xb2"},
+    {"LeftRightArrow;", "\xe2\x86\x94"},
+    {"boxv;", "\xe2\x94\x82"},
+    {"dcy;", "\xd0\xb4"},
+    {"vartheta;", "\xcf\x91"},
+    {"target;", "\xe2\x8c\x96"},
+    {"LowerRightArrow;", "\xe2\x86\x98"},
+    {"ncy;", "\xd0\xbd"},
+    {"twixt;", "\xe2\x89\xac"},
+    {"ncaron;", "\xc5\x88"},
+    {"UpEquilibrium;", "\xe2\xa5\xae"},
+    {"gesdotol;", "\xe2\xaa\x84"},
+    {"SucceedsTilde;", "\xe2\x89\xbf"},
+    {"cirE;", "\xe2\xa7\x83"},
+    {"sqsupe;", "\xe2\x8a\x92"},
+    {"backepsilon;", "\xcf\xb6"},
+    {"capcap;", "\xe2\xa9\x8b"},
+    {"Iuml;", "\xc3\x8f"},
+    {"upsih;", "\xcf\x92"},
+    {"sqcap;", "\xe2\x8a\x93"},
+    {"supsim;", "\xe2\xab\x88"},
+    {"frac45;", "\xe2\x85\x98"},
+    {"Uuml", "\xc3\x9c"},
+    {"csup;", "\xe2\xab\x90"},
+    {"ulcorn;", "\xe2\x8c\x9c"},
+    {"micro", "\xc2\xb5"},
+    {"NegativeVeryThinSpace;", "\xe2\x80\x8b"},
+    {"yopf;", "\xf0\x9d\x95\xaa"},
+    {"CupCap;", "\xe2\x89\x8d"},
+    {"plankv;", "\xe2\x84\x8f"},
+    {"gacute;", "\xc7\xb5"},
+    {"dzigrarr;", "\xe2\x9f\xbf"},
+    {"xi;", "\xce\xbe"},
+    {"crarr;", "\xe2\x86\xb5"},
+    {"Icirc", "\xc3\x8e"},
+    {"otimes;", "\xe2\x8a\x97"},
+    {"pscr;", "\xf0\x9d\x93\x85"},
+    {"eqvparsl;", "\xe2\xa7\xa5"},
+    {"Emacr;", "\xc4\x92"},
+    {"aacute", "\xc3\xa1"},
+    {"longmapsto;", "\xe2\x9f\xbc"},
+    {"cuepr;", "\xe2\x8b\x9e"},
+    {"epsiv;", "\xcf\xb5"},
+    {"dbkarow;", "\xe2\xa4\x8f"},
+    {"nopf;", "\xf0\x9d\x95\x9f"},
+    {"lescc;", "\xe2\xaa\xa8"},
+    {"neArr;", "\xe2\x87\x97"},
+    {"NotPrecedesEqual;", "\xe2\xaa\xaf\xcc\xb8"},
+    {"ldsh;", "\xe2\x86\xb2"},
+    {"Aacute", "\xc3\x81"},
+    {"ccirc;", "\xc4\x89"},
+    {"Nu;", "\xce\x9d"},
+    {"sigma;", "\xcf\x83"},
+    {"disin;", "\xe2\x8b\xb2"},
+    {"nsupseteq;", "\xe2\x8a\x89"},
+    {"icirc;", "\xc3\xae"},
+    {"leftthreetimes;", "\xe2\x8b\x8b"},
+    {"ExponentialE;", "\xe2\x85\x87"},
+    {"ycirc;", "\xc5\xb7"},
+    {"ldca;", "\xe2\xa4\xb6"},
+    {"approxeq;", "\xe2\x89\x8a"},
+    {"rAarr;", "\xe2\x87\x9b"},
+    {"Integral;", "\xe2\x88\xab"},
+    {"lbarr;", "\xe2\xa4\x8c"},
+    {"Ecirc;", "\xc3\x8a"},
+    {"rsh;", "\xe2\x86\xb1"},
+    {"int;", "\xe2\x88\xab"},
+    {"downdownarrows;", "\xe2\x87\x8a"},
+    {"prurel;", "\xe2\x8a\xb0"},
+    {"qint;", "\xe2\xa8\x8c"},
+    {"upuparrows;", "\xe2\x87\x88"},
+    {"complexes;", "\xe2\x84\x82"},
+    {"lEg;", "\xe2\xaa\x8b"},
+    {"bopf;", "\xf0\x9d\x95\x93"},
+    {"jmath;", "\xc8\xb7"},
+    {"apacir;", "\xe2\xa9\xaf"},
+    {"bigvee;", "\xe2\x8b\x81"},
+    {"boxVH;", "\xe2\x95\xac"},
+    {"zwnj;", "\xe2\x80\x8c"},
+    {"Edot;", "\xc4\x96"},
+    {"lesges;", "\xe2\xaa\x93"},
+    {"sopf;", "\xf0\x9d\x95\xa4"},
+    {"perp;", "\xe2\x8a\xa5"},
+    {"larr;", "\xe2\x86\x90"},
+    {"rfr;", "\xf0\x9d\x94\xaf"},
+    {"topbot;", "\xe2\x8c\xb6"},
+    {"ltri;", "\xe2\x97\x83"},
+    {"utri;", "\xe2\x96\xb5"},
+    {"upsilon;", "\xcf\x85"},
+    {"boxUl;", "\xe2\x95\x9c"},
+    {"DoubleUpDownArrow;", "\xe2\x87\x95"},
+    {"Rrightarrow;", "\xe2\x87\x9b"},
+    {"lsh;", "\xe2\x86\xb0"},
+    {"xlarr;", "\xe2\x9f\xb5"},
+    {"lgE;", "\xe2\xaa\x91"},
+    {"Ouml", "\xc3\x96"},
+    {"duarr;", "\xe2\x87\xb5"},
+    {"biguplus;", "\xe2\xa8\x84"},
+    {"shy;", "\xc2\xad"},
+    {"rightarrow;", "\xe2\x86\x92"},
+    {"bigwedge;", "\xe2\x8b\x80"},
+    {"Tfr;", "\xf0\x9d\x94\x97"},
+    {"LeftDownVectorBar;", "\xe2\xa5\x99"},
+    {"lcedil;", "\xc4\xbc"},
+    {"ntgl;", "\xe2\x89\xb9"},
+    {"xscr;", "\xf0\x9d\x93\x8d"},
+    {"ordf;", "\xc2\xaa"},
+    {"NotExists;", "\xe2\x88\x84"},
+    {"NegativeThickSpace;", "\xe2\x80\x8b"},
+    {"csupe;", "\xe2\xab\x92"},
+    {"oslash;", "\xc3\xb8"},
+    {"kappa;", "\xce\xba"},
+    {"Cscr;", "\xf0\x9d\x92\x9e"},
+    {"sqcups;", "\xe2\x8a\x94\xef\xb8\x80"},
+    {"lpar;", "\x28"},
+    {"Zopf;", "\xe2\x84\xa4"},
+    {"GT;", "\x3e"},
+    {"NotGreaterLess;", "\xe2\x89\xb9"},
+    {"Ocirc;", "\xc3\x94"},
+    {"xdtri;", "\xe2\x96\xbd"},
+    {"boxUr;", "\xe2\x95\x99"},
+    {"boxDL;", "\xe2\x95\x97"},
+    {"Longleftrightarrow;", "\xe2\x9f\xba"},
+    {"Ouml;", "\xc3\x96"},
+    {"LessGreater;", "\xe2\x89\xb6"},
+    {"smt;", "\xe2\xaa\xaa"},
+    {"kgreen;", "\xc4\xb8"},
+    {"xrarr;", "\xe2\x9f\xb6"},
+    {"edot;", "\xc4\x97"},
+    {"diamond;", "\xe2\x8b\x84"},
+    {"Product;", "\xe2\x88\x8f"},
+    {"aogon;", "\xc4\x85"},
+    {"vBar;", "\xe2\xab\xa8"},
+    {"precneqq;", "\xe2\xaa\xb5"},
+    {"bot;", "\xe2\x8a\xa5"},
+    {"theta;", "\xce\xb8"},
+    {"ucirc;", "\xc3\xbb"},
+    {"VerticalLine;", "\x7c"},
+    {"nesear;", "\xe2\xa4\xa8"},
+    {"ucirc", "\xc3\xbb"},
+    {"CounterClockwiseContourIntegral;", "\xe2\x88\xb3"},
+    {"Vdashl;", "\xe2\xab\xa6"},
+    {"uuml", "\xc3\xbc"},
+    {"harrcir;", "\xe2\xa5\x88"},
+    {"Hfr;", "\xe2\x84\x8c"},
+    {"rsquo;", "\xe2\x80\x99"},
+    {"topfork;", "\xe2\xab\x9a"},
+    {"tint;", "\xe2\x88\xad"},
+    {"amalg;", "\xe2\xa8\xbf"},
+    {"chcy;", "\xd1\x87"},
+    {"NotSucceedsSlantEqual;", "\xe2\x8b\xa1"},
+    {"raemptyv;", "\xe2\xa6\xb3"},
+    {"nsim;", "\xe2\x89\x81"},
+    {"Dcaron;", "\xc4\x8e"},
+    {"or;", "\xe2\x88\xa8"},
+    {"lceil;", "\xe2\x8c\x88"},
+    {"prap;", "\xe2\xaa\xb7"},
+    {"nles;", "\xe2\xa9\xbd\xcc\xb8"},
+    {"Phi;", "\xce\xa6"},
+    {"kjcy;", "\xd1\x9c"},
+    {"NotLeftTriangle;", "\xe2\x8b\xaa"},
+    {"Sfr;", "\xf0\x9d\x94\x96"},
+    {"easter;", "\xe2\xa9\xae"},
+    {"rationals;", "\xe2\x84\x9a"},
+    {"lsim;", "\xe2\x89\xb2"},
+    {"UpperRightArrow;", "\xe2\x86\x97"},
+    {"Ycy;", "\xd0\xab"},
+    {"starf;", "\xe2\x98\x85"},
+    {"plusb;", "\xe2\x8a\x9e"},
+    {"uhblk;", "\xe2\x96\x80"},
+    {"NotCongruent;", "\xe2\x89\xa2"},
+    {"Leftarrow;", "\xe2\x87\x90"},
+    {"origof;", "\xe2\x8a\xb6"},
+    {"subplus;", "\xe2\xaa\xbf"},
+    {"llcorner;", "\xe2\x8c\x9e"},
+    {"rightarrowtail;", "\xe2\x86\xa3"},
+    {"NotLeftTriangleEqual;", "\xe2\x8b\xac"},
+    {"imacr;", "\xc4\xab"},
+    {"iiiint;", "\xe2\xa8\x8c"},
+    {"supne;", "\xe2\x8a\x8b"},
+    {"submult;", "\xe2\xab\x81"},
+    {"nvrtrie;", "\xe2\x8a\xb5\xe2\x83\x92"},
+    {"tdot;", "\xe2\x83\x9b"},
+    {"asymp;", "\xe2\x89\x88"},
+    {"Implies;", "\xe2\x87\x92"},
+    {"radic;", "\xe2\x88\x9a"},
+    {"LeftTee;", "\xe2\x8a\xa3"},
+    {"supplus;", "\xe2\xab\x80"},
+    {"VerticalBar;", "\xe2\x88\xa3"},
+    {"orarr;", "\xe2\x86\xbb"},
+    {"rceil;", "\xe2\x8c\x89"},
+    {"UpperLeftArrow;", "\xe2\x86\x96"},
+    {"FilledSmallSquare;", "\xe2\x97\xbc"},
+    {"DownTeeArrow;", "\xe2\x86\xa7"},
+    {"ge;", "\xe2\x89\xa5"},
+    {"ffilig;", "\xef\xac\x83"},
+    {"leftleftarrows;", "\xe2\x87\x87"},
+    {"dArr;", "\xe2\x87\x93"},
+    {"nlsim;", "\xe2\x89\xb4"},
+    {"Sc;", "\xe2\xaa\xbc"},
+    {"qscr;", "\xf0\x9d\x93\x86"},
+    {"hscr;", "\xf0\x9d\x92\xbd"},
+    {"operp;", "\xe2\xa6\xb9"},
+    {"lesg;", "\xe2\x8b\x9a\xef\xb8\x80"},
+    {"EmptySmallSquare;", "\xe2\x97\xbb"},
+    {"rarrsim;", "\xe2\xa5\xb4"},
+    {"subsub;", "\xe2\xab\x95"},
+    {"varsupsetneq;", "\xe2\x8a\x8b\xef\xb8\x80"},
+    {"nsccue;", "\xe2\x8b\xa1"},
+    {"rharul;", "\xe2\xa5\xac"},
+    {"Precedes;", "\xe2\x89\xba"},
+    {"compfn;", "\xe2\x88\x98"},
+    {"Zeta;", "\xce\x96"},
+    {"rarrb;", "\xe2\x87\xa5"},
+    {"Omacr;", "\xc5\x8c"},
+    {"NotHumpEqual;", "\xe2\x89\x8f\xcc\xb8"},
+    {"sup2", "\xc2\xb2"},
+    {"Downarrow;", "\xe2\x87\x93"},
+    {"sol;", "\x2f"},
+    {"Ugrave", "\xc3\x99"},
+    {"prime;", "\xe2\x80\xb2"},
+    {"NestedLessLess;", "\xe2\x89\xaa"},
+    {"bump;", "\xe2\x89\x8e"},
+    {"Succeeds;", "\xe2\x89\xbb"},
+    {"gsim;", "\xe2\x89\xb3"},
+    {"Dfr;", "\xf0\x9d\x94\x87"},
+    {"itilde;", "\xc4\xa9"},
+    {"ThickSpace;", "\xe2\x81\x9f\xe2\x80\x8a"},
+    {"Rsh;", "\xe2\x86\xb1"},
+    {"bepsi;", "\xcf\xb6"},
+    {"curlywedge;", "\xe2\x8b\x8f"},
+    {"clubs;", "\xe2\x99\xa3"},
+    {"lhard;", "\xe2\x86\xbd"},
+    {"thkap;", "\xe2\x89\x88"},
+    {"npreceq;", "\xe2\xaa\xaf\xcc\xb8"},
+    {"nparsl;", "\xe2\xab\xbd\xe2\x83\xa5"},
+    {"timesd;", "\xe2\xa8\xb0"},
+    {"Lscr;", "\xe2\x84\x92"},
+    {"bsol;", "\x5c"},
+    {"Acy;", "\xd0\x90"},
+    {"wedge;", "\xe2\x88\xa7"},
+    {"dharr;", "\xe2\x87\x82"},
+    {"VDash;", "\xe2\x8a\xab"},
+    {"bfr;", "\xf0\x9d\x94\x9f"},
+    {"ltrPar;", "\xe2\xa6\x96"},
+    {"epar;", "\xe2\x8b\x95"},
+    {"cupdot;", "\xe2\x8a\x8d"},
+    {"RightUpVectorBar;", "\xe2\xa5\x94"},
+    {"copf;", "\xf0\x9d\x95\x94"},
+    {"omicron;", "\xce\xbf"},
+    {"Ncaron;", "\xc5\x87"},
+    {"urtri;", "\xe2\x97\xb9"},
+    {"Eacute;", "\xc3\x89"},
+    {"dopf;", "\xf0\x9d\x95\x95"},
+    {"kscr;", "\xf0\x9d\x93\x80"},
+    {"NotLess;", "\xe2\x89\xae"},
+    {"Gammad;", "\xcf\x9c"},
+    {"oacute;", "\xc3\xb3"},
+    {"Tstrok;", "\xc5\xa6"},
+    {"laquo;", "\xc2\xab"},
+    {"ltdot;", "\xe2\x8b\x96"},
+    {"nsucc;", "\xe2\x8a\x81"},
+    {"DoubleDownArrow;", "\xe2\x87\x93"},
+    {"ntlg;", "\xe2\x89\xb8"},
+    {"longleftrightarrow;", "\xe2\x9f\xb7"},
+    {"Upsi;", "\xcf\x92"},
+    {"Ofr;", "\xf0\x9d\x94\x92"},
+    {"iinfin;", "\xe2\xa7\x9c"},
+    {"middot;", "\xc2\xb7"},
+    {"mopf;", "\xf0\x9d\x95\x9e"},
+    {"nsupset;", "\xe2\x8a\x83\xe2\x83\x92"},
+    {"varpi;", "\xcf\x96"},
+    {"curvearrowright;", "\xe2\x86\xb7"},
+    {"ordf", "\xc2\xaa"},
+    {"middot", "\xc2\xb7"},
+    {"orslope;", "\xe2\xa9\x97"},
+    {"scnE;", "\xe2\xaa\xb6"},
+    {"gla;", "\xe2\xaa\xa5"},
+    {"ngsim;", "\xe2\x89\xb5"},
+    {"curren;", "\xc2\xa4"},
+    {"emacr;", "\xc4\x93"},
+    {"Cap;", "\xe2\x8b\x92"},
+    {"swArr;", "\xe2\x87\x99"},
+    {"Vee;", "\xe2\x8b\x81"},
+    {"rbrace;", "\x7d"},
+    {"nwarrow;", "\xe2\x86\x96"},
+    {"cwconint;", "\xe2\x88\xb2"},
+    {"dHar;", "\xe2\xa5\xa5"},
+    {"sum;", "\xe2\x88\x91"},
+    {"gne;", "\xe2\xaa\x88"},
+    {"Egrave;", "\xc3\x88"},
+    {"frac15;", "\xe2\x85\x95"},
+    {"rArr;", "\xe2\x87\x92"},
+    {"Mu;", "\xce\x9c"},
+    {"tfr;", "\xf0\x9d\x94\xb1"},
+    {"fjlig;", "\x66\x6a"},
+    {"oast;", "\xe2\x8a\x9b"},
+    {"LeftTeeArrow;", "\xe2\x86\xa4"},
+    {"EmptyVerySmallSquare;", "\xe2\x96\xab"},
+    {"and;", "\xe2\x88\xa7"},
+    {"smte;", "\xe2\xaa\xac"},
+    {"langd;", "\xe2\xa6\x91"},
+    {"downharpoonleft;", "\xe2\x87\x83"},
+    {"varrho;", "\xcf\xb1"},
+    {"HumpEqual;", "\xe2\x89\x8f"},
+    {"TScy;", "\xd0\xa6"},
+    {"late;", "\xe2\xaa\xad"},
+    {"gvertneqq;", "\xe2\x89\xa9\xef\xb8\x80"},
+    {"UpTee;", "\xe2\x8a\xa5"},
+    {"boxVL;", "\xe2\x95\xa3"},
+    {"lrarr;", "\xe2\x87\x86"},
+    {"reals;", "\xe2\x84\x9d"},
+    {"models;", "\xe2\x8a\xa7"},
+    {"ofr;", "\xf0\x9d\x94\xac"},
+    {"szlig", "\xc3\x9f"},
+    {"egrave", "\xc3\xa8"},
+    {"notindot;", "\xe2\x8b\xb5\xcc\xb8"},
+    {"ccedil;", "\xc3\xa7"},
+    {"Zscr;", "\xf0\x9d\x92\xb5"},
+    {"RightCeiling;", "\xe2\x8c\x89"},
+    {"Gdot;", "\xc4\xa0"},
+    {"Dscr;", "\xf0\x9d\x92\x9f"},
+    {"aelig;", "\xc3\xa6"},
+    {"lbrack;", "\x5b"},
+    {"hybull;", "\xe2\x81\x83"},
+    {"Yacute", "\xc3\x9d"},
+    {"supset;", "\xe2\x8a\x83"},
+    {"Agrave;", "\xc3\x80"},
+    {"lmoust;", "\xe2\x8e\xb0"},
+    {"nvge;", "\xe2\x89\xa5\xe2\x83\x92"},
+    {"iff;", "\xe2\x87\x94"},
+    {"auml", "\xc3\xa4"},
+    {"Jopf;", "\xf0\x9d\x95\x81"},
+    {"epsilon;", "\xce\xb5"},
+    {"Colon;", "\xe2\x88\xb7"},
+    {"xcirc;", "\xe2\x97\xaf"},
+    {"mlcp;", "\xe2\xab\x9b"},
+    {"atilde", "\xc3\xa3"},
+    {"boxminus;", "\xe2\x8a\x9f"},
+    {"supnE;", "\xe2\xab\x8c"},
+    {"ccaron;", "\xc4\x8d"},
+    {"hbar;", "\xe2\x84\x8f"},
+    {"Uring;", "\xc5\xae"},
+    {"napos;", "\xc5\x89"},
+    {"Dashv;", "\xe2\xab\xa4"},
+    {"SquareUnion;", "\xe2\x8a\x94"},
+    {"swarr;", "\xe2\x86\x99"},
+    {"swarhk;", "\xe2\xa4\xa6"},
+    {"rarrw;", "\xe2\x86\x9d"},
+    {"ugrave", "\xc3\xb9"},
+    {"nleqslant;", "\xe2\xa9\xbd\xcc\xb8"},
+    {"dd;", "\xe2\x85\x86"},
+    {"excl;", "\x21"},
+    {"SucceedsSlantEqual;", "\xe2\x89\xbd"},
+    {"capdot;", "\xe2\xa9\x80"},
+    {"RightUpVector;", "\xe2\x86\xbe"},
+    {"minus;", "\xe2\x88\x92"},
+    {"DownBreve;", "\xcc\x91"},
+    {"harrw;", "\xe2\x86\xad"},
+    {"Iogon;", "\xc4\xae"},
+    {"gsime;", "\xe2\xaa\x8e"},
+    {"Lang;", "\xe2\x9f\xaa"},
+    {"IJlig;", "\xc4\xb2"},
+    {"lrhar;", "\xe2\x87\x8b"},
+    {"Therefore;", "\xe2\x88\xb4"},
+    {"Aogon;", "\xc4\x84"},
+    {"afr;", "\xf0\x9d\x94\x9e"},
+    {"xfr;", "\xf0\x9d\x94\xb5"},
+    {"Zfr;", "\xe2\x84\xa8"},
+    {"DoubleRightArrow;", "\xe2\x87\x92"},
+    {"osol;", "\xe2\x8a\x98"},
+    {"Rfr;", "\xe2\x84\x9c"},
+    {"DoubleLongRightArrow;", "\xe2\x9f\xb9"},
+    {"boxhD;", "\xe2\x95\xa5"},
+    {"mldr;", "\xe2\x80\xa6"},
+    {"gE;", "\xe2\x89\xa7"},
+    {"supdot;", "\xe2\xaa\xbe"},
+    {"Darr;", "\xe2\x86\xa1"},
+    {"amp", "\x26"},
+    {"setmn;", "\xe2\x88\x96"},
+    {"Dot;", "\xc2\xa8"},
+    {"lHar;", "\xe2\xa5\xa2"},
+    {"cent;", "\xc2\xa2"},
+    {"cularr;", "\xe2\x86\xb6"},
+    {"rightsquigarrow;", "\xe2\x86\x9d"},
+    {"vrtri;", "\xe2\x8a\xb3"},
+    {"fscr;", "\xf0\x9d\x92\xbb"},
+    {"yacute", "\xc3\xbd"},
+    {"gdot;", "\xc4\xa1"},
+    {"rang;", "\xe2\x9f\xa9"},
+    {"supdsub;", "\xe2\xab\x98"},
+    {"DoubleRightTee;", "\xe2\x8a\xa8"},
+    {"sc;", "\xe2\x89\xbb"},
+    {"erDot;", "\xe2\x89\x93"},
+    {"subseteq;", "\xe2\x8a\x86"},
+    {"Eopf;", "\xf0\x9d\x94\xbc"},
+    {"coprod;", "\xe2\x88\x90"},
+    {"simgE;", "\xe2\xaa\xa0"},
+    {"fnof;", "\xc6\x92"},
+    {"OverParenthesis;", "\xe2\x8f\x9c"},
+    {"euro;", "\xe2\x82\xac"},
+    {"CircleMinus;", "\xe2\x8a\x96"},
+    {"bkarow;", "\xe2\xa4\x8d"},
+    {"Auml", "\xc3\x84"},
+    {"lap;", "\xe2\xaa\x85"},
+    {"comma;", "\x2c"},
+    {"alpha;", "\xce\xb1"},
+    {"scpolint;", "\xe2\xa8\x93"},
+    {"agrave;", "\xc3\xa0"},
+    {"ggg;", "\xe2\x8b\x99"},
+    {"laquo", "\xc2\xab"},
+    {"ohbar;", "\xe2\xa6\xb5"},
+    {"imagline;", "\xe2\x84\x90"},
+    {"scsim;", "\xe2\x89\xbf"},
+    {"nleftrightarrow;", "\xe2\x86\xae"},
+    {"NotGreaterGreater;", "\xe2\x89\xab\xcc\xb8"},
+    {"vltri;", "\xe2\x8a\xb2"},
+    {"par;", "\xe2\x88\xa5"},
+    {"acE;", "\xe2\x88\xbe\xcc\xb3"},
+    {"boxvh;", "\xe2\x94\xbc"},
+    {"sfrown;", "\xe2\x8c\xa2"},
+    {"yen", "\xc2\xa5"},
+    {"drbkarow;", "\xe2\xa4\x90"},
+    {"uring;", "\xc5\xaf"},
+    {"nsubE;", "\xe2\xab\x85\xcc\xb8"},
+    {"solbar;", "\xe2\x8c\xbf"},
+    {"ngt;", "\xe2\x89\xaf"},
+    {"lnap;", "\xe2\xaa\x89"},
+    {"ecirc;", "\xc3\xaa"},
+    {"hardcy;", "\xd1\x8a"},
+    {"mDDot;", "\xe2\x88\xba"},
+    {"angmsdag;", "\xe2\xa6\xae"},
+    {"angrtvbd;", "\xe2\xa6\x9d"},
+    {"andv;", "\xe2\xa9\x9a"},
+    {"Oscr;", "\xf0\x9d\x92\xaa"},
+    {"leftharpoondown;", "\xe2\x86\xbd"},
+    {"ltlarr;", "\xe2\xa5\xb6"},
+    {"TildeEqual;", "\xe2\x89\x83"},
+    {"lmidot;", "\xc5\x80"},
+    {"xharr;", "\xe2\x9f\xb7"},
+    {"squarf;", "\xe2\x96\xaa"},
+    {"planck;", "\xe2\x84\x8f"},
+    {"bdquo;", "\xe2\x80\x9e"},
+    {"LeftUpVector;", "\xe2\x86\xbf"},
+    {"NotCupCap;", "\xe2\x89\xad"},
+    {"ouml;", "\xc3\xb6"},
+    {"qfr;", "\xf0\x9d\x94\xae"},
+    {"gtdot;", "\xe2\x8b\x97"},
+    {"IOcy;", "\xd0\x81"},
+    {"agrave", "\xc3\xa0"},
+    {"propto;", "\xe2\x88\x9d"},
+    {"supseteq;", "\xe2\x8a\x87"},
+    {"auml;", "\xc3\xa4"},
+    {"varsubsetneqq;", "\xe2\xab\x8b\xef\xb8\x80"},
+    {"Uopf;", "\xf0\x9d\x95\x8c"},
+    {"mapstodown;", "\xe2\x86\xa7"},
+    {"RightTeeVector;", "\xe2\xa5\x9b"},
+    {"centerdot;", "\xc2\xb7"},
+    {"Ucy;", "\xd0\xa3"},
+    {"longrightarrow;", "\xe2\x9f\xb6"},
+    {"verbar;", "\x7c"},
+    {"gopf;", "\xf0\x9d\x95\x98"},
+    {"plussim;", "\xe2\xa8\xa6"},
+    {"nGt;", "\xe2\x89\xab\xe2\x83\x92"},
+    {"oplus;", "\xe2\x8a\x95"},
+    {"OpenCurlyQuote;", "\xe2\x80\x98"},
+    {"ddagger;", "\xe2\x80\xa1"},
+    {"igrave;", "\xc3\xac"},
+    {"ENG;", "\xc5\x8a"},
+    {"scedil;", "\xc5\x9f"},
+    {"emsp;", "\xe2\x80\x83"},
+    {"wedgeq;", "\xe2\x89\x99"},
+    {"Re;", "\xe2\x84\x9c"},
+    {"Igrave;", "\xc3\x8c"},
+    {"Ocirc", "\xc3\x94"},
+    {"SubsetEqual;", "\xe2\x8a\x86"},
+    {"solb;", "\xe2\xa7\x84"},
+    {"jcirc;", "\xc4\xb5"},
+    {"darr;", "\xe2\x86\x93"},
+    {"Kappa;", "\xce\x9a"},
+    {"hellip;", "\xe2\x80\xa6"},
+    {"Uscr;", "\xf0\x9d\x92\xb0"},
+    {"Ograve", "\xc3\x92"},
+    {"quot", "\x22"},
+    {"complement;", "\xe2\x88\x81"},
+    {"epsi;", "\xce\xb5"},
+    {"Ugrave;", "\xc3\x99"},
+    {"ngeqslant;", "\xe2\xa9\xbe\xcc\xb8"},
+    {"nang;", "\xe2\x88\xa0\xe2\x83\x92"},
+    {"GT", "\x3e"},
+    {"csube;", "\xe2\xab\x91"},
+    {"SquareSuperset;", "\xe2\x8a\x90"},
+    {"LeftFloor;", "\xe2\x8c\x8a"},
+    {"cirscir;", "\xe2\xa7\x82"},
+    {"jsercy;", "\xd1\x98"},
+    {"psi;", "\xcf\x88"},
+    {"amp;", "\x26"},
+    {"risingdotseq;", "\xe2\x89\x93"},
+    {"lagran;", "\xe2\x84\x92"},
+    {"uopf;", "\xf0\x9d\x95\xa6"},
+    {"gamma;", "\xce\xb3"},
+    {"nvlArr;", "\xe2\xa4\x82"},
+    {"nisd;", "\xe2\x8b\xba"},
+    {"ltrie;", "\xe2\x8a\xb4"},
+    {"angmsd;", "\xe2\x88\xa1"},
+    {"eqslantgtr;", "\xe2\xaa\x96"},
+    {"ETH;", "\xc3\x90"},
+    {"NotLessTilde;", "\xe2\x89\xb4"},
+    {"mapsto;", "\xe2\x86\xa6"},
+    {"Psi;", "\xce\xa8"},
+    {"nsupE;", "\xe2\xab\x86\xcc\xb8"},
+    {"lharul;", "\xe2\xa5\xaa"},
+    {"downharpoonright;", "\xe2\x87\x82"},
+    {"multimap;", "\xe2\x8a\xb8"},
+    {"plustwo;", "\xe2\xa8\xa7"},
+    {"nlArr;", "\xe2\x87\x8d"},
+    {"pitchfork;", "\xe2\x8b\x94"},
+    {"squf;", "\xe2\x96\xaa"},
+    {"succnsim;", "\xe2\x8b\xa9"},
+    {"wr;", "\xe2\x89\x80"},
+    {"angmsdah;", "\xe2\xa6\xaf"},
+    {"Subset;", "\xe2\x8b\x90"},
+    {"GreaterLess;", "\xe2\x89\xb7"},
+    {"oint;", "\xe2\x88\xae"},
+    {"THORN;", "\xc3\x9e"},
+    {"Hcirc;", "\xc4\xa4"},
+    {"ShortLeftArrow;", "\xe2\x86\x90"},
+    {"jfr;", "\xf0\x9d\x94\xa7"},
+    {"sub;", "\xe2\x8a\x82"},
+    {"lopar;", "\xe2\xa6\x85"},
+    {"lbrkslu;", "\xe2\xa6\x8d"},
+    {"vellip;", "\xe2\x8b\xae"},
+    {"uuml;", "\xc3\xbc"},
+    {"efr;", "\xf0\x9d\x94\xa2"},
+    {"forkv;", "\xe2\xab\x99"},
+    {"triangleright;", "\xe2\x96\xb9"},
+    {"iacute", "\xc3\xad"},
+    {"Odblac;", "\xc5\x90"},
+    {"scnsim;", "\xe2\x8b\xa9"},
+    {"Omega;", "\xce\xa9"},
+    {"acirc", "\xc3\xa2"},
+    {"flat;", "\xe2\x99\xad"},
+    {"Uacute", "\xc3\x9a"},
+    {"Sup;", "\xe2\x8b\x91"},
+    {"it;", "\xe2\x81\xa2"},
+    {"Lcaron;", "\xc4\xbd"},
+    {"napE;", "\xe2\xa9\xb0\xcc\xb8"},
+    {"Cconint;", "\xe2\x88\xb0"},
+    {"vnsub;", "\xe2\x8a\x82\xe2\x83\x92"},
+    {"rarrfs;", "\xe2\xa4\x9e"},
+    {"RightVectorBar;", "\xe2\xa5\x93"},
+    {"nprec;", "\xe2\x8a\x80"},
+    {"geqq;", "\xe2\x89\xa7"},
+    {"telrec;", "\xe2\x8c\x95"},
+    {"rpargt;", "\xe2\xa6\x94"},
+    {"iquest", "\xc2\xbf"},
+    {"Icirc;", "\xc3\x8e"},
+    {"rcedil;", "\xc5\x97"},
+    {"iprod;", "\xe2\xa8\xbc"},
+    {"gEl;", "\xe2\xaa\x8c"},
+    {"LeftTriangleEqual;", "\xe2\x8a\xb4"},
+    {"zscr;", "\xf0\x9d\x93\x8f"},
+    {"nspar;", "\xe2\x88\xa6"},
+    {"ring;", "\xcb\x9a"},
+    {"sbquo;", "\xe2\x80\x9a"},
+    {"phi;", "\xcf\x86"},
+    {"bsemi;", "\xe2\x81\x8f"},
+    {"RightAngleBracket;", "\xe2\x9f\xa9"},
+    {"backsimeq;", "\xe2\x8b\x8d"},
+    {"lozenge;", "\xe2\x97\x8a"},
+    {"lessapprox;", "\xe2\xaa\x85"},
+    {"apE;", "\xe2\xa9\xb0"},
+    {"thorn", "\xc3\xbe"},
+    {"looparrowright;", "\xe2\x86\xac"},
+    {"Euml", "\xc3\x8b"},
+    {"omacr;", "\xc5\x8d"},
+    {"Gamma;", "\xce\x93"},
+    {"oror;", "\xe2\xa9\x96"},
+    {"GreaterEqualLess;", "\xe2\x8b\x9b"},
+    {"vsupne;", "\xe2\x8a\x8b\xef\xb8\x80"},
+    {"trisb;", "\xe2\xa7\x8d"},
+    {"sqsubset;", "\xe2\x8a\x8f"},
+    {"alefsym;", "\xe2\x84\xb5"},
+    {"Rightarrow;", "\xe2\x87\x92"},
+    {"gtcir;", "\xe2\xa9\xba"},
+    {"Mellintrf;", "\xe2\x84\xb3"},
+    {"copysr;", "\xe2\x84\x97"},
+    {"loz;", "\xe2\x97\x8a"},
+    {"frac78;", "\xe2\x85\x9e"},
+    {"phmmat;", "\xe2\x84\xb3"},
+    {"Ccedil;", "\xc3\x87"},
+    {"NotTildeEqual;", "\xe2\x89\x84"},
+    {"bottom;", "\xe2\x8a\xa5"},
+    {"rarrtl;", "\xe2\x86\xa3"},
+    {"cudarrr;", "\xe2\xa4\xb5"},
+    {"NotSucceedsTilde;", "\xe2\x89\xbf\xcc\xb8"},
+    {"vArr;", "\xe2\x87\x95"},
+    {"rightleftarrows;", "\xe2\x87\x84"},
+    {"weierp;", "\xe2\x84\x98"},
+    {"mcy;", "\xd0\xbc"},
+    {"Lambda;", "\xce\x9b"},
+    {"tbrk;", "\xe2\x8e\xb4"},
+    {"rightthreetimes;", "\xe2\x8b\x8c"},
+    {"notinva;", "\xe2\x88\x89"},
+    {"tilde;", "\xcb\x9c"},
+    {"rbrkslu;", "\xe2\xa6\x90"},
+    {"sime;", "\xe2\x89\x83"},
+    {"colon;", "\x3a"},
+    {"Iota;", "\xce\x99"},
+    {"notniva;", "\xe2\x88\x8c"},
+    {"NotNestedLessLess;", "\xe2\xaa\xa1\xcc\xb8"},
+    {"lhblk;", "\xe2\x96\x84"},
+    {"Lsh;", "\xe2\x86\xb0"},
+    {"CenterDot;", "\xc2\xb7"},
+    {"DownLeftTeeVector;", "\xe2\xa5\x9e"},
+    {"rarrbfs;", "\xe2\xa4\xa0"},
+    {"triangleq;", "\xe2\x89\x9c"},
+    {"icy;", "\xd0\xb8"},
+    {"Epsilon;", "\xce\x95"},
+    {"nprcue;", "\xe2\x8b\xa0"},
+    {"smeparsl;", "\xe2\xa7\xa4"},
+    {"nLeftarrow;", "\xe2\x87\x8d"},
+    {"hcirc;", "\xc4\xa5"},
+    {"KHcy;", "\xd0\xa5"},
+    {"boxplus;", "\xe2\x8a\x9e"},
+    {"ShortRightArrow;", "\xe2\x86\x92"},
+    {"Theta;", "\xce\x98"},
+    {"roplus;", "\xe2\xa8\xae"},
+    {"iuml", "\xc3\xaf"},
+    {"Nopf;", "\xe2\x84\x95"},
+    {"Cfr;", "\xe2\x84\xad"},
+    {"lE;", "\xe2\x89\xa6"},
+    {"nvap;", "\xe2\x89\x8d\xe2\x83\x92"},
+    {"scirc;", "\xc5\x9d"},
+    {"ntilde;", "\xc3\xb1"},
+    {"Lopf;", "\xf0\x9d\x95\x83"},
+    {"angsph;", "\xe2\x88\xa2"},
+    {"sigmav;", "\xcf\x82"},
+    {"uarr;", "\xe2\x86\x91"},
+    {"macr;", "\xc2\xaf"},
+    {"supe;", "\xe2\x8a\x87"},
+    {"ncap;", "\xe2\xa9\x83"},
+    {"subE;", "\xe2\xab\x85"},
+    {"RBarr;", "\xe2\xa4\x90"},
+    {"Iscr;", "\xe2\x84\x90"},
+    {"lsquo;", "\xe2\x80\x98"},
+    {"pm;", "\xc2\xb1"},
+    {"nvlt;", "\x3c\xe2\x83\x92"},
+    {"DD;", "\xe2\x85\x85"},
+    {"nldr;", "\xe2\x80\xa5"},
+    {"gbreve;", "\xc4\x9f"},
+    {"Nscr;", "\xf0\x9d\x92\xa9"},
+    {"VerticalSeparator;", "\xe2\x9d\x98"},
+    {"digamma;", "\xcf\x9d"},
+    {"khcy;", "\xd1\x85"},
+    {"LessFullEqual;", "\xe2\x89\xa6"},
+    {"xsqcup;", "\xe2\xa8\x86"},
+    {"lstrok;", "\xc5\x82"},
+    {"kfr;", "\xf0\x9d\x94\xa8"},
+    {"RightUpTeeVector;", "\xe2\xa5\x9c"},
+    {"xvee;", "\xe2\x8b\x81"},
+    {"ac;", "\xe2\x88\xbe"},
+    {"ofcir;", "\xe2\xa6\xbf"},
+    {"preccurlyeq;", "\xe2\x89\xbc"},
+    {"veebar;", "\xe2\x8a\xbb"},
+    {"lat;", "\xe2\xaa\xab"},
+    {"bNot;", "\xe2\xab\xad"},
+    {"DotEqual;", "\xe2\x89\x90"},
+    {"rcy;", "\xd1\x80"},
+    {"boxh;", "\xe2\x94\x80"},
+    {"ncedil;", "\xc5\x86"},
+    {"Ccaron;", "\xc4\x8c"},
+    {"hstrok;", "\xc4\xa7"},
+    {"LeftUpDownVector;", "\xe2\xa5\x91"},
+    {"because;", "\xe2\x88\xb5"},
+    {"NotNestedGreaterGreater;", "\xe2\xaa\xa2\xcc\xb8"},
+    {"gtrdot;", "\xe2\x8b\x97"},
+    {"equest;", "\xe2\x89\x9f"},
+    {"DDotrahd;", "\xe2\xa4\x91"},
+    {"DownLeftVector;", "\xe2\x86\xbd"},
+    {"LeftDoubleBracket;", "\xe2\x9f\xa6"},
+    {"frac56;", "\xe2\x85\x9a"},
+    {"emptyv;", "\xe2\x88\x85"},
+    {"boxVr;", "\xe2\x95\x9f"},
+    {"cire;", "\xe2\x89\x97"},
+    {"tosa;", "\xe2\xa4\xa9"},
+    {"DoubleUpArrow;", "\xe2\x87\x91"},
+    {"frac14;", "\xc2\xbc"},
+    {"varsupsetneqq;", "\xe2\xab\x8c\xef\xb8\x80"},
+    {"cross;", "\xe2\x9c\x97"},
+    {"angrtvb;", "\xe2\x8a\xbe"},
+    {"NotPrecedes;", "\xe2\x8a\x80"},
+    {"MinusPlus;", "\xe2\x88\x93"},
+    {"gg;", "\xe2\x89\xab"},
+    {"CircleTimes;", "\xe2\x8a\x97"},
+    {"Vfr;", "\xf0\x9d\x94\x99"},
+    {"hfr;", "\xf0\x9d\x94\xa5"},
+    {"dlcrop;", "\xe2\x8c\x8d"},
+    {"cupcup;", "\xe2\xa9\x8a"},
+    {"Zcy;", "\xd0\x97"},
+    {"srarr;", "\xe2\x86\x92"},
+    {"urcorner;", "\xe2\x8c\x9d"},
+    {"succapprox;", "\xe2\xaa\xb8"},
+    {"Acirc", "\xc3\x82"},
+    {"supmult;", "\xe2\xab\x82"},
+    {"HorizontalLine;", "\xe2\x94\x80"},
+    {"njcy;", "\xd1\x9a"},
+    {"triangledown;", "\xe2\x96\xbf"},
+    {"notin;", "\xe2\x88\x89"},
+    {"ogon;", "\xcb\x9b"},
+    {"ugrave;", "\xc3\xb9"},
+    {"LongRightArrow;", "\xe2\x9f\xb6"},
+    {"divide", "\xc3\xb7"},
+    {"OpenCurlyDoubleQuote;", "\xe2\x80\x9c"},
+    {"Equilibrium;", "\xe2\x87\x8c"},
+    {"NotSquareSubsetEqual;", "\xe2\x8b\xa2"},
+    {"maltese;", "\xe2\x9c\xa0"},
+    {"xcap;", "\xe2\x8b\x82"},
+    {"eopf;", "\xf0\x9d\x95\x96"},
+    {"DoubleLeftArrow;", "\xe2\x87\x90"},
+    {"rtrif;", "\xe2\x96\xb8"},
+    {"otimesas;", "\xe2\xa8\xb6"},
+    {"isin;", "\xe2\x88\x88"},
+    {"cudarrl;", "\xe2\xa4\xb8"},
+    {"NotLessSlantEqual;", "\xe2\xa9\xbd\xcc\xb8"},
+    {"nsce;", "\xe2\xaa\xb0\xcc\xb8"},
+    {"vsubnE;", "\xe2\xab\x8b\xef\xb8\x80"},
+    {"fcy;", "\xd1\x84"},
+    {"Ntilde", "\xc3\x91"},
+    {"map;", "\xe2\x86\xa6"},
+    {"Upsilon;", "\xce\xa5"},
+    {"isindot;", "\xe2\x8b\xb5"},
+    {"Sigma;", "\xce\xa3"},
+    {"NotTildeTilde;", "\xe2\x89\x89"},
+    {"bigcup;", "\xe2\x8b\x83"},
+    {"swnwar;", "\xe2\xa4\xaa"},
+    {"leftarrowtail;", "\xe2\x86\xa2"},
+    {"nrArr;", "\xe2\x87\x8f"},
+    {"curlyvee;", "\xe2\x8b\x8e"},
+    {"rlhar;", "\xe2\x87\x8c"},
+    {"supedot;", "\xe2\xab\x84"},
+    {"numero;", "\xe2\x84\x96"},
+    {"langle;", "\xe2\x9f\xa8"},
+    {"sup;", "\xe2\x8a\x83"},
+    {"ltimes;", "\xe2\x8b\x89"},
+    {"shy", "\xc2\xad"},
+    {"ecy;", "\xd1\x8d"},
+    {"Vopf;", "\xf0\x9d\x95\x8d"},
+    {"imof;", "\xe2\x8a\xb7"},
+    {"amacr;", "\xc4\x81"},
+    {"colone;", "\xe2\x89\x94"},
+    {"DownRightTeeVector;", "\xe2\xa5\x9f"},
+    {"DownLeftRightVector;", "\xe2\xa5\x90"},
+    {"ee;", "\xe2\x85\x87"},
+    {"orv;", "\xe2\xa9\x9b"},
+    {"geq;", "\xe2\x89\xa5"},
+    {"HumpDownHump;", "\xe2\x89\x8e"},
+    {"ges;", "\xe2\xa9\xbe"},
+    {"frac38;", "\xe2\x85\x9c"},
+    {"nsub;", "\xe2\x8a\x84"},
+    {"nvrArr;", "\xe2\xa4\x83"},
+    {"eqslantless;", "\xe2\xaa\x95"},
+    {"DotDot;", "\xe2\x83\x9c"},
+    {"exist;", "\xe2\x88\x83"},
+    {"harr;", "\xe2\x86\x94"},
+    {"llarr;", "\xe2\x87\x87"},
+    {"angrt;", "\xe2\x88\x9f"},
+    {"OverBar;", "\xe2\x80\xbe"},
+    {"intercal;", "\xe2\x8a\xba"},
+    {"sect;", "\xc2\xa7"},
+    {"natural;", "\xe2\x99\xae"},
+    {"realine;", "\xe2\x84\x9b"},
+    {"zopf;", "\xf0\x9d\x95\xab"},
+    {"UpArrow;", "\xe2\x86\x91"},
+    {"bigoplus;", "\xe2\xa8\x81"},
+    {"dlcorn;", "\xe2\x8c\x9e"},
+    {"lowast;", "\xe2\x88\x97"},
+    {"notnivc;", "\xe2\x8b\xbd"},
+    {"caret;", "\xe2\x81\x81"},
+    {"ClockwiseContourIntegral;", "\xe2\x88\xb2"},
+    {"Cayleys;", "\xe2\x84\xad"},
+    {"rarr;", "\xe2\x86\x92"},
+    {"rpar;", "\x29"},
+    {"NotPrecedesSlantEqual;", "\xe2\x8b\xa0"},
+    {"cupbrcap;", "\xe2\xa9\x88"},
+    {"Or;", "\xe2\xa9\x94"},
+    {"rcaron;", "\xc5\x99"},
+    {"Fouriertrf;", "\xe2\x84\xb1"},
+    {"mho;", "\xe2\x84\xa7"},
+    {"PlusMinus;", "\xc2\xb1"},
+    {"DoubleContourIntegral;", "\xe2\x88\xaf"},
+    {"rcub;", "\x7d"},
+    {"LeftUpVectorBar;", "\xe2\xa5\x98"},
+    {"dcaron;", "\xc4\x8f"},
+    {"dtrif;", "\xe2\x96\xbe"},
+    {"Fcy;", "\xd0\xa4"},
+    {"subne;", "\xe2\x8a\x8a"},
+    {"iiint;", "\xe2\x88\xad"},
+    {"uml;", "\xc2\xa8"},
+    {"Vbar;", "\xe2\xab\xab"},
+    {"frown;", "\xe2\x8c\xa2"},
+    {"NotEqualTilde;", "\xe2\x89\x82\xcc\xb8"},
+    {"gtrarr;", "\xe2\xa5\xb8"},
+    {"rx;", "\xe2\x84\x9e"},
+    {"bigcirc;", "\xe2\x97\xaf"},
+    {"bumpeq;", "\xe2\x89\x8f"},
+    {"dollar;", "\x24"},
+    {"GreaterSlantEqual;", "\xe2\xa9\xbe"},
+    {"oacute", "\xc3\xb3"},
+    {"vangrt;", "\xe2\xa6\x9c"},
+    {"micro;", "\xc2\xb5"},
+    {"InvisibleComma;", "\xe2\x81\xa3"},
+    {"LeftVector;", "\xe2\x86\xbc"},
+    {"trianglerighteq;", "\xe2\x8a\xb5"},
+    {"not;", "\xc2\xac"},
+    {"Icy;", "\xd0\x98"},
+    {"larrsim;", "\xe2\xa5\xb3"},
+    {"utilde;", "\xc5\xa9"},
+    {"zcy;", "\xd0\xb7"},
+    {"zeetrf;", "\xe2\x84\xa8"},
+    {"Aring", "\xc3\x85"},
+    {"brvbar;", "\xc2\xa6"},
+    {"ecirc", "\xc3\xaa"},
+    {"downarrow;", "\xe2\x86\x93"},
+    {"yucy;", "\xd1\x8e"},
+    {"NotGreaterEqual;", "\xe2\x89\xb1"},
+    {"lfloor;", "\xe2\x8c\x8a"},
+    {"para;", "\xc2\xb6"},
+    {"rtimes;", "\xe2\x8b\x8a"},
+    {"bigcap;", "\xe2\x8b\x82"},
+    {"congdot;", "\xe2\xa9\xad"},
+    {"Vcy;", "\xd0\x92"},
+    {"sqsub;", "\xe2\x8a\x8f"},
+    {"lacute;", "\xc4\xba"},
+    {"eacute;", "\xc3\xa9"},
+    {"rmoustache;", "\xe2\x8e\xb1"},
+    {"tscy;", "\xd1\x86"},
+    {"curlyeqprec;", "\xe2\x8b\x9e"},
+    {"LessEqualGreater;", "\xe2\x8b\x9a"},
+    {"ddotseq;", "\xe2\xa9\xb7"},
+    {"strns;", "\xc2\xaf"},
+    {"Cup;", "\xe2\x8b\x93"},
+    {"ulcrop;", "\xe2\x8c\x8f"},
+    {"cup;", "\xe2\x88\xaa"},
+    {"sqcaps;", "\xe2\x8a\x93\xef\xb8\x80"},
+    {"precapprox;", "\xe2\xaa\xb7"},
+    {"dharl;", "\xe2\x87\x83"},
+    {"jscr;", "\xf0\x9d\x92\xbf"},
+    {"filig;", "\xef\xac\x81"},
+    {"nges;", "\xe2\xa9\xbe\xcc\xb8"},
+    {"DownArrowUpArrow;", "\xe2\x87\xb5"},
+    {"GJcy;", "\xd0\x83"},
+    {"ltrif;", "\xe2\x97\x82"},
+    {"Afr;", "\xf0\x9d\x94\x84"},
+    {"Rho;", "\xce\xa1"},
+    {"bigstar;", "\xe2\x98\x85"},
+    {"yacute;", "\xc3\xbd"},
+    {"Sscr;", "\xf0\x9d\x92\xae"},
+    {"acute", "\xc2\xb4"},
+    {"ohm;", "\xce\xa9"},
+    {"sup1;", "\xc2\xb9"},
+    {"square;", "\xe2\x96\xa1"},
+    {"opar;", "\xe2\xa6\xb7"},
+    {"Mscr;", "\xe2\x84\xb3"},
+    {"nGtv;", "\xe2\x89\xab\xcc\xb8"},
+    {"nap;", "\xe2\x89\x89"},
+    {"esim;", "\xe2\x89\x82"},
+    {"qprime;", "\xe2\x81\x97"},
+    {"demptyv;", "\xe2\xa6\xb1"},
+    {"abreve;", "\xc4\x83"},
+    {"gtlPar;", "\xe2\xa6\x95"},
+    {"circledcirc;", "\xe2\x8a\x9a"},
+    {"lesseqgtr;", "\xe2\x8b\x9a"},
+    {"Itilde;", "\xc4\xa8"},
+    {"breve;", "\xcb\x98"},
+    {"Proportional;", "\xe2\x88\x9d"},
+    {"scE;", "\xe2\xaa\xb4"},
+    {"omid;", "\xe2\xa6\xb6"},
+    {"bscr;", "\xf0\x9d\x92\xb7"},
+    {"ThinSpace;", "\xe2\x80\x89"},
+    {"Ascr;", "\xf0\x9d\x92\x9c"},
+    {"rharu;", "\xe2\x87\x80"},
+    {"gtreqqless;", "\xe2\xaa\x8c"},
+    {"cent", "\xc2\xa2"},
+    {"xopf;", "\xf0\x9d\x95\xa9"},
+    {"equals;", "\x3d"},
+    {"boxHd;", "\xe2\x95\xa4"},
+    {"ntrianglelefteq;", "\xe2\x8b\xac"},
+    {"CapitalDifferentialD;", "\xe2\x85\x85"},
+    {"Square;", "\xe2\x96\xa1"},
+    {"npart;", "\xe2\x88\x82\xcc\xb8"},
+    {"nrtrie;", "\xe2\x8b\xad"},
+    {"diam;", "\xe2\x8b\x84"},
+    {"wscr;", "\xf0\x9d\x93\x8c"},
+    {"boxDl;", "\xe2\x95\x96"},
+    {"Uparrow;", "\xe2\x87\x91"},
+    {"udarr;", "\xe2\x87\x85"},
+    {"udhar;", "\xe2\xa5\xae"},
+    {"cdot;", "\xc4\x8b"},
+    {"boxvR;", "\xe2\x95\x9e"},
+    {"Alpha;", "\xce\x91"},
+    {"hookrightarrow;", "\xe2\x86\xaa"},
+    {"vartriangleleft;", "\xe2\x8a\xb2"},
+    {"backprime;", "\xe2\x80\xb5"},
+    {"lobrk;", "\xe2\x9f\xa6"},
+    {"nge;", "\xe2\x89\xb1"},
+    {"uogon;", "\xc5\xb3"},
+    {"DownRightVector;", "\xe2\x87\x81"},
+    {"nleftarrow;", "\xe2\x86\x9a"},
+    {"capand;", "\xe2\xa9\x84"},
+    {"gvnE;", "\xe2\x89\xa9\xef\xb8\x80"},
+    {"curvearrowleft;", "\xe2\x86\xb6"},
+    {"yuml;", "\xc3\xbf"},
+    {"Ll;", "\xe2\x8b\x98"},
+    {"NotVerticalBar;", "\xe2\x88\xa4"},
+    {"latail;", "\xe2\xa4\x99"},
+    {"lArr;", "\xe2\x87\x90"},
+    {"thorn;", "\xc3\xbe"},
+    {"ucy;", "\xd1\x83"},
+    {"bigotimes;", "\xe2\xa8\x82"},
+    {"Delta;", "\xce\x94"},
+    {"ngE;", "\xe2\x89\xa7\xcc\xb8"},
+    {"tcedil;", "\xc5\xa3"},
+    {"diamondsuit;", "\xe2\x99\xa6"},
+    {"nshortparallel;", "\xe2\x88\xa6"},
+    {"npolint;", "\xe2\xa8\x94"},
+    {"rtri;", "\xe2\x96\xb9"},
+    {"searr;", "\xe2\x86\x98"},
+    {"Ubreve;", "\xc5\xac"},
+    {"Breve;", "\xcb\x98"},
+    {"succeq;", "\xe2\xaa\xb0"},
+    {"ropar;", "\xe2\xa6\x86"},
+    {"imagpart;", "\xe2\x84\x91"},
+    {"Aopf;", "\xf0\x9d\x94\xb8"},
+    {"duhar;", "\xe2\xa5\xaf"},
+    {"Efr;", "\xf0\x9d\x94\x88"},
+    {"doteq;", "\xe2\x89\x90"},
+    {"dotplus;", "\xe2\x88\x94"},
+    {"DoubleLeftRightArrow;", "\xe2\x87\x94"},
+    {"lcaron;", "\xc4\xbe"},
+    {"ndash;", "\xe2\x80\x93"},
+    {"gtquest;", "\xe2\xa9\xbc"},
+    {"sdote;", "\xe2\xa9\xa6"},
+    {"DoubleLongLeftRightArrow;", "\xe2\x9f\xba"},
+    {"prnap;", "\xe2\xaa\xb9"},
+    {"prop;", "\xe2\x88\x9d"},
+    {"nhpar;", "\xe2\xab\xb2"},
+    {"real;", "\xe2\x84\x9c"},
+    {"ijlig;", "\xc4\xb3"},
+    {"UpDownArrow;", "\xe2\x86\x95"},
+    {"vnsup;", "\xe2\x8a\x83\xe2\x83\x92"},
+    {"sce;", "\xe2\xaa\xb0"},
+    {"acd;", "\xe2\x88\xbf"},
+    {"Amacr;", "\xc4\x80"},
+    {"Ncedil;", "\xc5\x85"},
+    {"llhard;", "\xe2\xa5\xab"},
+    {"kcedil;", "\xc4\xb7"},
+    {"Zacute;", "\xc5\xb9"},
+    {"mapstoleft;", "\xe2\x86\xa4"},
+    {"top;", "\xe2\x8a\xa4"},
+    {"Topf;", "\xf0\x9d\x95\x8b"},
+    {"wcirc;", "\xc5\xb5"},
+    {"rppolint;", "\xe2\xa8\x92"},
+    {"Mfr;", "\xf0\x9d\x94\x90"},
+    {"Rcedil;", "\xc5\x96"},
+    {"DownLeftVectorBar;", "\xe2\xa5\x96"},
+    {"Barv;", "\xe2\xab\xa7"},
+    {"gnapprox;", "\xe2\xaa\x8a"},
+    {"odsold;", "\xe2\xa6\xbc"},
+    {"Scedil;", "\xc5\x9e"},
+    {"rlarr;", "\xe2\x87\x84"},
+    {"eDot;", "\xe2\x89\x91"},
+    {"iexcl;", "\xc2\xa1"},
+    {"iiota;", "\xe2\x84\xa9"},
+    {"bbrktbrk;", "\xe2\x8e\xb6"},
+    {"NotSuperset;", "\xe2\x8a\x83\xe2\x83\x92"},
+    {"twoheadleftarrow;", "\xe2\x86\x9e"},
+    {"ImaginaryI;", "\xe2\x85\x88"},
+    {"subsetneqq;", "\xe2\xab\x8b"},
+    {"varpropto;", "\xe2\x88\x9d"},
+    {"mp;", "\xe2\x88\x93"},
+    {"ultri;", "\xe2\x97\xb8"},
+    {"TSHcy;", "\xd0\x8b"},
+    {"hopf;", "\xf0\x9d\x95\x99"},
+    {"ccaps;", "\xe2\xa9\x8d"},
+    {"frasl;", "\xe2\x81\x84"},
+    {"SmallCircle;", "\xe2\x88\x98"},
+    {"rsquor;", "\xe2\x80\x99"},
+    {"cfr;", "\xf0\x9d\x94\xa0"},
+    {"NotTildeFullEqual;", "\xe2\x89\x87"},
+    {"minusdu;", "\xe2\xa8\xaa"},
+    {"order;", "\xe2\x84\xb4"},
+    {"Yscr;", "\xf0\x9d\x92\xb4"},
+    {"scnap;", "\xe2\xaa\xba"},
+    {"sim;", "\xe2\x88\xbc"},
+    {"nwArr;", "\xe2\x87\x96"},
+    {"escr;", "\xe2\x84\xaf"},
+    {"uparrow;", "\xe2\x86\x91"},
+    {"tshcy;", "\xd1\x9b"},
+    {"Oopf;", "\xf0\x9d\x95\x86"},
+    {"ovbar;", "\xe2\x8c\xbd"},
+    {"ni;", "\xe2\x88\x8b"},
+    {"aelig", "\xc3\xa6"},
+    {"Lacute;", "\xc4\xb9"},
+    {"bne;", "\x3d\xe2\x83\xa5"},
+    {"ograve", "\xc3\xb2"},
+    {"rdca;", "\xe2\xa4\xb7"},
+    {"Nacute;", "\xc5\x83"},
+    {"rightrightarrows;", "\xe2\x87\x89"},
+    {"succ;", "\xe2\x89\xbb"},
+    {"nis;", "\xe2\x8b\xbc"},
+    {"ldrdhar;", "\xe2\xa5\xa7"},
+    {"boxVl;", "\xe2\x95\xa2"},
+    {"ocirc;", "\xc3\xb4"},
+    {"backcong;", "\xe2\x89\x8c"},
+    {"ZHcy;", "\xd0\x96"},
+    {"rho;", "\xcf\x81"},
+    {"ord;", "\xe2\xa9\x9d"},
+    {"andd;", "\xe2\xa9\x9c"},
+    {"ocir;", "\xe2\x8a\x9a"},
+    {"ncongdot;", "\xe2\xa9\xad\xcc\xb8"},
+    {"supsetneqq;", "\xe2\xab\x8c"},
+    {"lesdot;", "\xe2\xa9\xbf"},
+    {"les;", "\xe2\xa9\xbd"},
+    {"leqslant;", "\xe2\xa9\xbd"},
+    {"mfr;", "\xf0\x9d\x94\xaa"},
+    {"RuleDelayed;", "\xe2\xa7\xb4"},
+    {"TildeFullEqual;", "\xe2\x89\x85"},
+    {"Leftrightarrow;", "\xe2\x87\x94"},
+    {"Vvdash;", "\xe2\x8a\xaa"},
+    {"awconint;", "\xe2\x88\xb3"},
+    {"boxul;", "\xe2\x94\x98"},
+    {"beta;", "\xce\xb2"},
+    {"VeryThinSpace;", "\xe2\x80\x8a"},
+    {"Bfr;", "\xf0\x9d\x94\x85"},
+    {"blacktriangledown;", "\xe2\x96\xbe"},
+    {"nVdash;", "\xe2\x8a\xae"},
+    {"dtdot;", "\xe2\x8b\xb1"},
+    {"not", "\xc2\xac"},
+    {"ReverseUpEquilibrium;", "\xe2\xa5\xaf"},
+    {"rightharpoondown;", "\xe2\x87\x81"},
+    {"angle;", "\xe2\x88\xa0"},
+    {"approx;", "\xe2\x89\x88"},
+    {"supsub;", "\xe2\xab\x94"},
+    {"gnE;", "\xe2\x89\xa9"},
+    {"ContourIntegral;", "\xe2\x88\xae"},
+    {"eparsl;", "\xe2\xa7\xa3"},
+    {"lbrke;", "\xe2\xa6\x8b"},
+    {"nrightarrow;", "\xe2\x86\x9b"},
+    {"sqsup;", "\xe2\x8a\x90"},
+    {"gt", "\x3e"},
+    {"lne;", "\xe2\xaa\x87"},
+    {"lcy;", "\xd0\xbb"},
+    {"rdquo;", "\xe2\x80\x9d"},
+    {"angst;", "\xc3\x85"},
+    {"squ;", "\xe2\x96\xa1"},
+    {"Rcy;", "\xd0\xa0"},
+    {"igrave", "\xc3\xac"},
+    {"nfr;", "\xf0\x9d\x94\xab"},
+    {"bemptyv;", "\xe2\xa6\xb0"},
+    {"iukcy;", "\xd1\x96"},
+    {"elinters;", "\xe2\x8f\xa7"},
+    {"ngtr;", "\xe2\x89\xaf"},
+    {"RightArrowBar;", "\xe2\x87\xa5"},
+    {"Utilde;", "\xc5\xa8"},
+    {"sqsubseteq;", "\xe2\x8a\x91"},
+    {"lsqb;", "\x5b"},
+    {"upsi;", "\xcf\x85"},
+    {"lrhard;", "\xe2\xa5\xad"},
+    {"euml", "\xc3\xab"},
+    {"frac35;", "\xe2\x85\x97"},
+    {"vfr;", "\xf0\x9d\x94\xb3"},
+    {"NonBreakingSpace;", "\xc2\xa0"},
+    {"Conint;", "\xe2\x88\xaf"},
+    {"varr;", "\xe2\x86\x95"},
+    {"sstarf;", "\xe2\x8b\x86"},
+    {"gesdot;", "\xe2\xaa\x80"},
+    {"lozf;", "\xe2\xa7\xab"},
+    {"AElig", "\xc3\x86"},
+    {"RightUpDownVector;", "\xe2\xa5\x8f"},
+    {"rangd;", "\xe2\xa6\x92"},
+    {"Oslash", "\xc3\x98"},
+    {"GreaterGreater;", "\xe2\xaa\xa2"},
+    {"Oslash;", "\xc3\x98"},
+    {"hkswarow;", "\xe2\xa4\xa6"},
+    {"ordm;", "\xc2\xba"},
+    {"Backslash;", "\xe2\x88\x96"},
+    {"Cedilla;", "\xc2\xb8"},
+    {"Lfr;", "\xf0\x9d\x94\x8f"},
+    {"Tcy;", "\xd0\xa2"},
+    {"hksearow;", "\xe2\xa4\xa5"},
+    {"frac16;", "\xe2\x85\x99"},
+    {"succcurlyeq;", "\xe2\x89\xbd"},
+    {"circledR;", "\xc2\xae"},
+    {"block;", "\xe2\x96\x88"},
+    {"div;", "\xc3\xb7"},
+    {"searrow;", "\xe2\x86\x98"},
+    {"euml;", "\xc3\xab"},
+    {"isinsv;", "\xe2\x8b\xb3"},
+    {"DJcy;", "\xd0\x82"},
+    {"fpartint;", "\xe2\xa8\x8d"},
+    {"NotSquareSubset;", "\xe2\x8a\x8f\xcc\xb8"},
+    {"nvHarr;", "\xe2\xa4\x84"},
+    {"NotRightTriangle;", "\xe2\x8b\xab"},
+    {"blacklozenge;", "\xe2\xa7\xab"},
+    {"lfr;", "\xf0\x9d\x94\xa9"},
+    {"supsetneq;", "\xe2\x8a\x8b"},
+    {"cuwed;", "\xe2\x8b\x8f"},
+    {"sdot;", "\xe2\x8b\x85"},
+    {"boxDr;", "\xe2\x95\x93"},
+    {"Superset;", "\xe2\x8a\x83"},
+    {"NotSquareSupersetEqual;", "\xe2\x8b\xa3"},
+    {"LeftAngleBracket;", "\xe2\x9f\xa8"},
+    {"exponentiale;", "\xe2\x85\x87"},
+    {"wfr;", "\xf0\x9d\x94\xb4"},
+    {"uacute", "\xc3\xba"},
+    {"tritime;", "\xe2\xa8\xbb"},
+    {"angmsdad;", "\xe2\xa6\xab"},
+    {"ic;", "\xe2\x81\xa3"},
+    {"RightTriangle;", "\xe2\x8a\xb3"},
+    {"nesim;", "\xe2\x89\x82\xcc\xb8"},
+    {"wopf;", "\xf0\x9d\x95\xa8"},
+    {"Aacute;", "\xc3\x81"},
+    {"odash;", "\xe2\x8a\x9d"},
+    {"nleqq;", "\xe2\x89\xa6\xcc\xb8"},
+    {"frac13;", "\xe2\x85\x93"},
+    {"Uacute;", "\xc3\x9a"},
+    {"Tilde;", "\xe2\x88\xbc"},
+    {"swarrow;", "\xe2\x86\x99"},
+    {"Iacute", "\xc3\x8d"},
+    {"rsqb;", "\x5d"},
+    {"fllig;", "\xef\xac\x82"},
+    {"sscr;", "\xf0\x9d\x93\x88"},
+    {"Pfr;", "\xf0\x9d\x94\x93"},
+    {"lessgtr;", "\xe2\x89\xb6"},
+    {"raquo;", "\xc2\xbb"},
+    {"sigmaf;", "\xcf\x82"},
+    {"cuvee;", "\xe2\x8b\x8e"},
+    {"toea;", "\xe2\xa4\xa8"},
+    {"spadesuit;", "\xe2\x99\xa0"},
+    {"infin;", "\xe2\x88\x9e"},
+    {"zdot;", "\xc5\xbc"},
+    {"bsim;", "\xe2\x88\xbd"},
+    {"SquareSubset;", "\xe2\x8a\x8f"},
+    {"isins;", "\xe2\x8b\xb4"},
+    {"Tcedil;", "\xc5\xa2"},
+    {"lesssim;", "\xe2\x89\xb2"},
+    {"male;", "\xe2\x99\x82"},
+    {"plusdu;", "\xe2\xa8\xa5"},
+    {"kcy;", "\xd0\xba"},
+    {"nvltrie;", "\xe2\x8a\xb4\xe2\x83\x92"},
+    {"isinE;", "\xe2\x8b\xb9"},
+    {"ccedil", "\xc3\xa7"},
+    {"uscr;", "\xf0\x9d\x93\x8a"},
+    {"barwed;", "\xe2\x8c\x85"},
+    {"in;", "\xe2\x88\x88"},
+    {"sup3", "\xc2\xb3"},
+    {"loplus;", "\xe2\xa8\xad"},
+    {"lsimg;", "\xe2\xaa\x8f"},
+    {"sqsupset;", "\xe2\x8a\x90"},
+    {"lvertneqq;", "\xe2\x89\xa8\xef\xb8\x80"},
+    {"softcy;", "\xd1\x8c"},
+    {"REG", "\xc2\xae"},
+    {"otilde", "\xc3\xb5"},
+    {"macr", "\xc2\xaf"},
+    {"COPY", "\xc2\xa9"},
+    {"egrave;", "\xc3\xa8"},
+    {"nsubseteqq;", "\xe2\xab\x85\xcc\xb8"},
+    {"rarrlp;", "\xe2\x86\xac"},
+    {"bigsqcup;", "\xe2\xa8\x86"},
+    {"frac18;", "\xe2\x85\x9b"},
+    {"subsim;", "\xe2\xab\x87"},
+    {"YIcy;", "\xd0\x87"},
+    {"nRightarrow;", "\xe2\x87\x8f"},
+    {"HilbertSpace;", "\xe2\x84\x8b"},
+    {"uuarr;", "\xe2\x87\x88"},
+    {"KJcy;", "\xd0\x8c"},
+    {"leg;", "\xe2\x8b\x9a"},
+    {"lrm;", "\xe2\x80\x8e"},
+    {"DownArrowBar;", "\xe2\xa4\x93"},
+    {"boxuR;", "\xe2\x95\x98"},
+    {"comp;", "\xe2\x88\x81"},
+    {"ngeq;", "\xe2\x89\xb1"},
+    {"trpezium;", "\xe2\x8f\xa2"},
+    {"NotElement;", "\xe2\x88\x89"},
+    {"aring;", "\xc3\xa5"},
+    {"ncup;", "\xe2\xa9\x82"},
+    {"olarr;", "\xe2\x86\xba"},
+    {"mnplus;", "\xe2\x88\x93"},
+    {"uplus;", "\xe2\x8a\x8e"},
+    {"UnionPlus;", "\xe2\x8a\x8e"},
+    {"NegativeMediumSpace;", "\xe2\x80\x8b"},
+    {"midast;", "\x2a"},
+    {"DoubleDot;", "\xc2\xa8"},
+    {"frac12;", "\xc2\xbd"},
+    {"notnivb;", "\xe2\x8b\xbe"},
+    {"frac14", "\xc2\xbc"},
+    {"ang;", "\xe2\x88\xa0"},
+    {"icirc", "\xc3\xae"},
+    {"heartsuit;", "\xe2\x99\xa5"},
+    {"curarr;", "\xe2\x86\xb7"},
+    {"Del;", "\xe2\x88\x87"},
+    {"pluscir;", "\xe2\xa8\xa2"},
+    {"nedot;", "\xe2\x89\x90\xcc\xb8"},
+    {"Tab;", "\x09"},
+    {"rtriltri;", "\xe2\xa7\x8e"},
+    {"Larr;", "\xe2\x86\x9e"},
+    {"Gg;", "\xe2\x8b\x99"},
+    {"pluse;", "\xe2\xa9\xb2"},
+    {"ngeqq;", "\xe2\x89\xa7\xcc\xb8"},
+    {"larrhk;", "\xe2\x86\xa9"},
+    {"rbrack;", "\x5d"},
+    {"times;", "\xc3\x97"},
+    {"lmoustache;", "\xe2\x8e\xb0"},
+    {"Cdot;", "\xc4\x8a"},
+    {"el;", "\xe2\xaa\x99"},
+    {"urcorn;", "\xe2\x8c\x9d"},
+    {"Xscr;", "\xf0\x9d\x92\xb3"},
+    {"SupersetEqual;", "\xe2\x8a\x87"},
+    {"ApplyFunction;", "\xe2\x81\xa1"},
+    {"mu;", "\xce\xbc"},
+    {"looparrowleft;", "\xe2\x86\xab"},
+    {"plusmn", "\xc2\xb1"},
+    {"backsim;", "\xe2\x88\xbd"},
+    {"nparallel;", "\xe2\x88\xa6"},
+    {"coloneq;", "\xe2\x89\x94"},
+    {"ordm", "\xc2\xba"},
+    {"varepsilon;", "\xcf\xb5"},
+    {"rbbrk;", "\xe2\x9d\xb3"},
+    {"nexist;", "\xe2\x88\x84"},
+    {"cacute;", "\xc4\x87"},
+    {"luruhar;", "\xe2\xa5\xa6"},
+    {"popf;", "\xf0\x9d\x95\xa1"},
+    {"LeftTriangleBar;", "\xe2\xa7\x8f"},
+    {"gesl;", "\xe2\x8b\x9b\xef\xb8\x80"},
+    {"LeftVectorBar;", "\xe2\xa5\x92"},
+    {"eogon;", "\xc4\x99"},
+    {"cedil", "\xc2\xb8"},
+    {"boxHU;", "\xe2\x95\xa9"},
+    {"yuml", "\xc3\xbf"},
+    {"forall;", "\xe2\x88\x80"},
+    {"xlArr;", "\xe2\x9f\xb8"},
+    {"gtreqless;", "\xe2\x8b\x9b"},
+    {"triminus;", "\xe2\xa8\xba"},
+    {"Barwed;", "\xe2\x8c\x86"},
+    {"circlearrowright;", "\xe2\x86\xbb"},
+    {"ubrcy;", "\xd1\x9e"},
+    {"NotRightTriangleEqual;", "\xe2\x8b\xad"},
+    {"spades;", "\xe2\x99\xa0"},
+    {"uHar;", "\xe2\xa5\xa3"},
+    {"reg", "\xc2\xae"},
+    {"boxur;", "\xe2\x94\x94"},
+    {"therefore;", "\xe2\x88\xb4"},
+    {"drcrop;", "\xe2\x8c\x8c"},
+    {"DoubleLongLeftArrow;", "\xe2\x9f\xb8"},
+    {"reg;", "\xc2\xae"},
+    {"nbumpe;", "\xe2\x89\x8f\xcc\xb8"},
+    {"rlm;", "\xe2\x80\x8f"},
+    {"lbrksld;", "\xe2\xa6\x8f"},
+    {"bsolb;", "\xe2\xa7\x85"},
+    {"gesles;", "\xe2\xaa\x94"},
+    {"rnmid;", "\xe2\xab\xae"},
+    {"SucceedsEqual;", "\xe2\xaa\xb0"},
+    {"Gcirc;", "\xc4\x9c"},
+    {"Lleftarrow;", "\xe2\x87\x9a"},
+    {"bigtriangledown;", "\xe2\x96\xbd"},
+    {"roarr;", "\xe2\x87\xbe"},
+    {"sqsube;", "\xe2\x8a\x91"},
+    {"subedot;", "\xe2\xab\x83"},
+    {"ffr;", "\xf0\x9d\x94\xa3"},
+    {"COPY;", "\xc2\xa9"},
+    {"lesdotor;", "\xe2\xaa\x83"},
+    {"VerticalTilde;", "\xe2\x89\x80"},
+    {"sfr;", "\xf0\x9d\x94\xb0"},
+    {"prsim;", "\xe2\x89\xbe"},
+    {"suplarr;", "\xe2\xa5\xbb"},
+    {"apid;", "\xe2\x89\x8b"},
+    {"SOFTcy;", "\xd0\xac"},
+    {"bumpE;", "\xe2\xaa\xae"},
+    {"Ubrcy;", "\xd0\x8e"},
+    {"brvbar", "\xc2\xa6"},
+    {"mid;", "\xe2\x88\xa3"},
+    {"divideontimes;", "\xe2\x8b\x87"},
+    {"boxHD;", "\xe2\x95\xa6"},
+    {"lneqq;", "\xe2\x89\xa8"},
+    {"varnothing;", "\xe2\x88\x85"},
+    {"Kscr;", "\xf0\x9d\x92\xa6"},
+    {"sqsupseteq;", "\xe2\x8a\x92"},
+    {"NotGreaterFullEqual;", "\xe2\x89\xa7\xcc\xb8"},
+    {"plusmn;", "\xc2\xb1"},
+    {"eacute", "\xc3\xa9"},
+    {"Tscr;", "\xf0\x9d\x92\xaf"},
+    {"rbarr;", "\xe2\xa4\x8d"},
+    {"Beta;", "\xce\x92"},
+    {"primes;", "\xe2\x84\x99"},
+    {"Dstrok;", "\xc4\x90"},
+    {"NoBreak;", "\xe2\x81\xa0"},
+    {"vBarv;", "\xe2\xab\xa9"},
+    {"nsqsube;", "\xe2\x8b\xa2"},
+    {"trade;", "\xe2\x84\xa2"},
+    {"Xopf;", "\xf0\x9d\x95\x8f"},
+    {"setminus;", "\xe2\x88\x96"},
+    {"esdot;", "\xe2\x89\x90"},
+    {"malt;", "\xe2\x9c\xa0"},
+    {"mscr;", "\xf0\x9d\x93\x82"},
+    {"thicksim;", "\xe2\x88\xbc"},
+    {"larrtl;", "\xe2\x86\xa2"},
+    {"SuchThat;", "\xe2\x88\x8b"},
+    {"Igrave", "\xc3\x8c"},
+    {"nLeftrightarrow;", "\xe2\x87\x8e"},
+    {"succsim;", "\xe2\x89\xbf"},
+    {"acirc;", "\xc3\xa2"},
+    {"divide;", "\xc3\xb7"},
+    {"NotGreater;", "\xe2\x89\xaf"},
+    {"circlearrowleft;", "\xe2\x86\xba"},
+    {"NotSubset;", "\xe2\x8a\x82\xe2\x83\x92"},
+    {"period;", "\x2e"},
+    {"Ufr;", "\xf0\x9d\x94\x98"},
+    {"zeta;", "\xce\xb6"},
+    {"ll;", "\xe2\x89\xaa"},
+    {"cwint;", "\xe2\x88\xb1"},
+    {"FilledVerySmallSquare;", "\xe2\x96\xaa"},
+    {"Rarr;", "\xe2\x86\xa0"},
+    {"bigodot;", "\xe2\xa8\x80"},
+    {"varsigma;", "\xcf\x82"},
+    {"odblac;", "\xc5\x91"},
+    {"lambda;", "\xce\xbb"},
+    {"larrpl;", "\xe2\xa4\xb9"},
+    {"topcir;", "\xe2\xab\xb1"},
+    {"nrarr;", "\xe2\x86\x9b"},
+    {"iquest;", "\xc2\xbf"},
+    {"fopf;", "\xf0\x9d\x95\x97"},
+    {"nLtv;", "\xe2\x89\xaa\xcc\xb8"},
+    {"nLl;", "\xe2\x8b\x98\xcc\xb8"},
+    {"Dagger;", "\xe2\x80\xa1"},
+    {"ast;", "\x2a"},
+    {"diams;", "\xe2\x99\xa6"},
+    {"gt;", "\x3e"},
+    {"range;", "\xe2\xa6\xa5"},
+    {"OverBracket;", "\xe2\x8e\xb4"},
+    {"RightDownVectorBar;", "\xe2\xa5\x95"},
+    {"RightTeeArrow;", "\xe2\x86\xa6"},
+    {"lotimes;", "\xe2\xa8\xb4"},
+    {"notinvb;", "\xe2\x8b\xb7"},
+    {"aleph;", "\xe2\x84\xb5"},
+    {"rhov;", "\xcf\xb1"},
+    {"lparlt;", "\xe2\xa6\x93"},
+    {"Cacute;", "\xc4\x86"},
+    {"Qopf;", "\xe2\x84\x9a"},
+    {"Sum;", "\xe2\x88\x91"},
+    {"Bernoullis;", "\xe2\x84\xac"},
+    {"thetasym;", "\xcf\x91"},
+    {"erarr;", "\xe2\xa5\xb1"},
+    {"nwarhk;", "\xe2\xa4\xa3"},
+    {"ssetmn;", "\xe2\x88\x96"},
+    {"kopf;", "\xf0\x9d\x95\x9c"},
+    {"frac34;", "\xc2\xbe"},
+    {"NotTilde;", "\xe2\x89\x81"},
+    {"lurdshar;", "\xe2\xa5\x8a"},
+    {"nrarrc;", "\xe2\xa4\xb3\xcc\xb8"},
+    {"Hat;", "\x5e"},
+    {"Vdash;", "\xe2\x8a\xa9"},
+    {"boxtimes;", "\xe2\x8a\xa0"},
+    {"shortmid;", "\xe2\x88\xa3"},
+    {"ufisht;", "\xe2\xa5\xbe"},
+    {"barwedge;", "\xe2\x8c\x85"},
+    {"lneq;", "\xe2\xaa\x87"},
+    {"dwangle;", "\xe2\xa6\xa6"},
+    {"Fopf;", "\xf0\x9d\x94\xbd"},
+    {"slarr;", "\xe2\x86\x90"},
+    {"angmsdae;", "\xe2\xa6\xac"},
+    {"triangle;", "\xe2\x96\xb5"},
+    {"Yopf;", "\xf0\x9d\x95\x90"},
+    {"iacute;", "\xc3\xad"},
+    {"oslash", "\xc3\xb8"},
+    {"preceq;", "\xe2\xaa\xaf"},
+    {"PartialD;", "\xe2\x88\x82"},
+    {"bull;", "\xe2\x80\xa2"},
+    {"wedbar;", "\xe2\xa9\x9f"},
+    {"CloseCurlyQuote;", "\xe2\x80\x99"},
+    {"omega;", "\xcf\x89"},
+    {"egs;", "\xe2\xaa\x96"},
+    {"homtht;", "\xe2\x88\xbb"},
+    {"Oacute;", "\xc3\x93"},
+    {"eDDot;", "\xe2\xa9\xb7"},
+    {"lesseqqgtr;", "\xe2\xaa\x8b"},
+    {"olcir;", "\xe2\xa6\xbe"},
+    {"lAtail;", "\xe2\xa4\x9b"},
+    {"scaron;", "\xc5\xa1"},
+    {"DScy;", "\xd0\x85"},
+    {"Yfr;", "\xf0\x9d\x94\x9c"},
+    {"rdldhar;", "\xe2\xa5\xa9"},
+    {"cularrp;", "\xe2\xa4\xbd"},
+    {"divonx;", "\xe2\x8b\x87"},
+    {"blacktriangleleft;", "\xe2\x97\x82"},
+    {"uharr;", "\xe2\x86\xbe"},
+    {"Wopf;", "\xf0\x9d\x95\x8e"},
+    {"Longrightarrow;", "\xe2\x9f\xb9"},
+    {"prod;", "\xe2\x88\x8f"},
+    {"questeq;", "\xe2\x89\x9f"},
+    {"ldquo;", "\xe2\x80\x9c"},
+    {"eth", "\xc3\xb0"},
+    {"ropf;", "\xf0\x9d\x95\xa3"},
+    {"Chi;", "\xce\xa7"},
+    {"copy", "\xc2\xa9"},
+    {"nleq;", "\xe2\x89\xb0"},
+    {"circ;", "\xcb\x86"},
+    {"gescc;", "\xe2\xaa\xa9"},
+    {"image;", "\xe2\x84\x91"},
+    {"pi;", "\xcf\x80"},
+    {"twoheadrightarrow;", "\xe2\x86\xa0"},
+    {"numsp;", "\xe2\x80\x87"},
+    {"eg;", "\xe2\xaa\x9a"},
+    {"boxDR;", "\xe2\x95\x94"},
+    {"subnE;", "\xe2\xab\x8b"},
+    {"fltns;", "\xe2\x96\xb1"},
+    {"NotSucceeds;", "\xe2\x8a\x81"},
+    {"napid;", "\xe2\x89\x8b\xcc\xb8"},
+    {"Bscr;", "\xe2\x84\xac"},
+    {"hamilt;", "\xe2\x84\x8b"},
+    {"aopf;", "\xf0\x9d\x95\x92"},
+    {"Verbar;", "\xe2\x80\x96"},
+    {"And;", "\xe2\xa9\x93"},
+    {"equiv;", "\xe2\x89\xa1"},
+    {"shcy;", "\xd1\x88"},
+    {"LeftDownVector;", "\xe2\x87\x83"},
+    {"nscr;", "\xf0\x9d\x93\x83"},
+    {"frac23;", "\xe2\x85\x94"},
+    {"dotsquare;", "\xe2\x8a\xa1"},
+    {"Star;", "\xe2\x8b\x86"},
+    {"kappav;", "\xcf\xb0"},
+    {"nbsp", "\xc2\xa0"},
+    {"rHar;", "\xe2\xa5\xa4"},
+    {"lthree;", "\xe2\x8b\x8b"},
+    {"cirmid;", "\xe2\xab\xaf"},
+    {"LeftArrowBar;", "\xe2\x87\xa4"},
+    {"Jscr;", "\xf0\x9d\x92\xa5"},
+    {"LessSlantEqual;", "\xe2\xa9\xbd"},
+    {"eth;", "\xc3\xb0"},
+    {"part;", "\xe2\x88\x82"},
+    {"Gbreve;", "\xc4\x9e"},
+    {"infintie;", "\xe2\xa7\x9d"},
+    {"REG;", "\xc2\xae"},
+    {"fflig;", "\xef\xac\x80"},
+    {"boxuL;", "\xe2\x95\x9b"},
+    {"integers;", "\xe2\x84\xa4"},
+    {"nvDash;", "\xe2\x8a\xad"},
+    {"pfr;", "\xf0\x9d\x94\xad"},
+    {"copy;", "\xc2\xa9"},
+    {"TRADE;", "\xe2\x84\xa2"},
+    {"thinsp;", "\xe2\x80\x89"},
+    {"subrarr;", "\xe2\xa5\xb9"},
+    {"af;", "\xe2\x81\xa1"},
+    {"Lt;", "\xe2\x89\xaa"},
+    {"circledast;", "\xe2\x8a\x9b"},
+    {"ntrianglerighteq;", "\xe2\x8b\xad"},
+    {"ltquest;", "\xe2\xa9\xbb"},
+    {"gtcc;", "\xe2\xaa\xa7"},
+    {"zacute;", "\xc5\xba"},
+    {"Kcedil;", "\xc4\xb6"},
+    {"angmsdaf;", "\xe2\xa6\xad"},
+    {"UpTeeArrow;", "\xe2\x86\xa5"},
+    {"bsime;", "\xe2\x8b\x8d"},
+    {"Egrave", "\xc3\x88"},
+    {"hercon;", "\xe2\x8a\xb9"},
+    {"Ecirc", "\xc3\x8a"},
+    {"emptyset;", "\xe2\x88\x85"},
+    {"profsurf;", "\xe2\x8c\x93"},
+    {"sext;", "\xe2\x9c\xb6"},
+    {"ap;", "\xe2\x89\x88"},
+    {"aacute;", "\xc3\xa1"},
+    {"loang;", "\xe2\x9f\xac"},
+    {"lvnE;", "\xe2\x89\xa8\xef\xb8\x80"},
+    {"bcong;", "\xe2\x89\x8c"},
+    {"Iacute;", "\xc3\x8d"},
+    {"caps;", "\xe2\x88\xa9\xef\xb8\x80"},
+    {"rsaquo;", "\xe2\x80\xba"},
+    {"lBarr;", "\xe2\xa4\x8e"},
+    {"xmap;", "\xe2\x9f\xbc"},
+    {"ReverseElement;", "\xe2\x88\x8b"},
+    {"minusb;", "\xe2\x8a\x9f"},
+    {"LT", "\x3c"},
+    {"nless;", "\xe2\x89\xae"},
+    {"GreaterFullEqual;", "\xe2\x89\xa7"},
+    {"cirfnint;", "\xe2\xa8\x90"},
+    {"supseteqq;", "\xe2\xab\x86"},
+    {"boxvl;", "\xe2\x94\xa4"},
+    {"ape;", "\xe2\x89\x8a"},
+    {"Abreve;", "\xc4\x82"},
+    {"pertenk;", "\xe2\x80\xb1"},
+    {"gap;", "\xe2\xaa\x86"},
+    {"naturals;", "\xe2\x84\x95"},
+    {"ifr;", "\xf0\x9d\x94\xa6"},
+    {"mapstoup;", "\xe2\x86\xa5"},
+    {"Tcaron;", "\xc5\xa4"},
+    {"boxdL;", "\xe2\x95\x95"},
+    {"nsqsupe;", "\xe2\x8b\xa3"},
+    {"oS;", "\xe2\x93\x88"},
+    {"nsimeq;", "\xe2\x89\x84"},
+    {"SHCHcy;", "\xd0\xa9"},
+    {"lharu;", "\xe2\x86\xbc"},
+    {"varsubsetneq;", "\xe2\x8a\x8a\xef\xb8\x80"},
+    {"boxhU;", "\xe2\x95\xa8"},
+    {"prcue;", "\xe2\x89\xbc"},
+    {"Ecy;", "\xd0\xad"},
+    {"UnderBrace;", "\xe2\x8f\x9f"},
+    {"Yuml;", "\xc5\xb8"},
+    {"yacy;", "\xd1\x8f"},
+    {"gel;", "\xe2\x8b\x9b"},
+    {"precnapprox;", "\xe2\xaa\xb9"},
+    {"ograve;", "\xc3\xb2"},
+    {"Int;", "\xe2\x88\xac"},
+    {"ctdot;", "\xe2\x8b\xaf"},
+    {"scy;", "\xd1\x81"},
+    {"RightTee;", "\xe2\x8a\xa2"},
+    {"Atilde", "\xc3\x83"},
+    {"EqualTilde;", "\xe2\x89\x82"},
+    {"Uuml;", "\xc3\x9c"},
+    {"rightharpoonup;", "\xe2\x87\x80"},
+    {"leftarrow;", "\xe2\x86\x90"},
+    {"LongLeftRightArrow;", "\xe2\x9f\xb7"},
+    {"topf;", "\xf0\x9d\x95\xa5"},
+    {"SquareSubsetEqual;", "\xe2\x8a\x91"},
+    {"subsup;", "\xe2\xab\x93"},
+    {"csub;", "\xe2\xab\x8f"},
+    {"rarrpl;", "\xe2\xa5\x85"},
+    {"Rarrtl;", "\xe2\xa4\x96"},
+    {"dagger;", "\xe2\x80\xa0"},
+    {"Agrave", "\xc3\x80"},
+    {"cupor;", "\xe2\xa9\x85"},
+    {"cups;", "\xe2\x88\xaa\xef\xb8\x80"},
+    {"eqcolon;", "\xe2\x89\x95"},
+    {"wreath;", "\xe2\x89\x80"},
+    {"curren", "\xc2\xa4"},
+    {"delta;", "\xce\xb4"},
+    {"smile;", "\xe2\x8c\xa3"},
+    {"zigrarr;", "\xe2\x87\x9d"},
+    {"ldquor;", "\xe2\x80\x9e"},
+    {"tcy;", "\xd1\x82"},
+    {"boxdR;", "\xe2\x95\x92"},
+    {"nvgt;", "\x3e\xe2\x83\x92"},
+    {"percnt;", "\x25"},
+    {"varphi;", "\xcf\x95"},
+    {"race;", "\xe2\x88\xbd\xcc\xb1"},
+    {"Hstrok;", "\xc4\xa6"},
+    {"seswar;", "\xe2\xa4\xa9"},
+    {"simne;", "\xe2\x89\x86"},
+    {"lt;", "\x3c"},
+    {"frac34", "\xc2\xbe"},
+    {"tscr;", "\xf0\x9d\x93\x89"},
+    {"nvle;", "\xe2\x89\xa4\xe2\x83\x92"},
+    {"uml", "\xc2\xa8"},
+    {"emsp13;", "\xe2\x80\x84"},
+    {"NotLeftTriangleBar;", "\xe2\xa7\x8f\xcc\xb8"},
+    {"vsupnE;", "\xe2\xab\x8c\xef\xb8\x80"},
+    {"equivDD;", "\xe2\xa9\xb8"},
+    {"Lcy;", "\xd0\x9b"},
+    {"nsubset;", "\xe2\x8a\x82\xe2\x83\x92"},
+    {"jopf;", "\xf0\x9d\x95\x9b"},
+    {"vsubne;", "\xe2\x8a\x8a\xef\xb8\x80"},
+    {"Ffr;", "\xf0\x9d\x94\x89"},
+    {"nVDash;", "\xe2\x8a\xaf"},
+    {"gimel;", "\xe2\x84\xb7"},
+    {"eqcirc;", "\xe2\x89\x96"},
+    {"tau;", "\xcf\x84"},
+    {"ufr;", "\xf0\x9d\x94\xb2"},
+    {"piv;", "\xcf\x96"},
+    {"dstrok;", "\xc4\x91"},
+    {"Popf;", "\xe2\x84\x99"},
+    {"nsmid;", "\xe2\x88\xa4"},
+    {"sect", "\xc2\xa7"},
+    {"seArr;", "\xe2\x87\x98"},
+    {"Uarrocir;", "\xe2\xa5\x89"},
+    {"Uogon;", "\xc5\xb2"},
+    {"nsc;", "\xe2\x8a\x81"},
+    {"planckh;", "\xe2\x84\x8e"},
+    {"nle;", "\xe2\x89\xb0"},
+    {"nsube;", "\xe2\x8a\x88"},
+    {"check;", "\xe2\x9c\x93"},
+    {"Oacute", "\xc3\x93"},
+    {"Sqrt;", "\xe2\x88\x9a"},
+    {"cap;", "\xe2\x88\xa9"},
+    {"CloseCurlyDoubleQuote;", "\xe2\x80\x9d"},
+    {"UpArrowDownArrow;", "\xe2\x87\x85"},
+    {"DoubleLeftTee;", "\xe2\xab\xa4"},
+    {"LessLess;", "\xe2\xaa\xa1"},
+    {"upharpoonright;", "\xe2\x86\xbe"},
+    {"Zdot;", "\xc5\xbb"},
+    {"nsupe;", "\xe2\x8a\x89"},
+    {"updownarrow;", "\xe2\x86\x95"},
+    {"ncong;", "\xe2\x89\x87"},
+    {"quaternions;", "\xe2\x84\x8d"},
+    {"circeq;", "\xe2\x89\x97"},
+    {"frac12", "\xc2\xbd"},
+    {"IEcy;", "\xd0\x95"},
+    {"nhArr;", "\xe2\x87\x8e"},
+};
+
+#endif // HTML_ENTITY_TABLE_H
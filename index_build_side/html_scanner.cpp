@@ -0,0 +1,122 @@
+#include "html_scanner.h"
+
+#include <atomic>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+using ScanFunction = size_t (*)(const char*, size_t, char, char, char);
+
+static size_t scanScalar(const char* data, size_t size, char a, char b, char c) {
+    for (size_t i = 0; i < size; ++i) {
+        char ch = data[i];
+        if (ch == a || ch == b || ch == c) return i;
+    }
+    return size;
+}
+
+#ifdef HAVE_X86_SIMD
+// The functions below are compiled for their instruction set whatever the
+// build flags say; they only run once the CPU is known to support it.
+
+__attribute__((target("sse2")))
+static size_t scanSse2(const char* data, size_t size, char a, char b, char c) {
+    const __m128i va = _mm_set1_epi8(a);
+    const __m128i vb = _mm_set1_epi8(b);
+    const __m128i vc = _mm_set1_epi8(c);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, va), _mm_cmpeq_epi8(chunk, vb)),
+                                    _mm_cmpeq_epi8(chunk, vc));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+    return i + scanScalar(data + i, size - i, a, b, c);
+}
+
+__attribute__((target("avx2")))
+static size_t scanAvx2(const char* data, size_t size, char a, char b, char c) {
+    // Markup is dense (a stop every couple of dozen bytes on typical pages),
+    // so try a 16 byte step before committing to 32
+    size_t i = 0;
+    if (size >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(a)), _mm_cmpeq_epi8(chunk, _mm_set1_epi8(b))),
+                                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8(c)));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        if (mask != 0) return __builtin_ctz(mask);
+        i = 16;
+    }
+
+    const __m256i va = _mm256_set1_epi8(a);
+    const __m256i vb = _mm256_set1_epi8(b);
+    const __m256i vc = _mm256_set1_epi8(c);
+    for (; i + 32 <= size; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i hits = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, va), _mm256_cmpeq_epi8(chunk, vb)),
+                                       _mm256_cmpeq_epi8(chunk, vc));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hits));
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+    return i + scanSse2(data + i, size - i, a, b, c);
+}
+#endif
+
+ScanLevel supportedScanLevel() {
+#ifdef HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return ScanLevel::Avx2;
+    if (__builtin_cpu_supports("sse2")) return ScanLevel::Sse2;
+#endif
+    return ScanLevel::Scalar;
+}
+
+// Helper function to map a level to its implementation
+static ScanFunction scannerFor(ScanLevel level) {
+    switch (level) {
+#ifdef HAVE_X86_SIMD
+        case ScanLevel::Avx2: return scanAvx2;
+        case ScanLevel::Sse2: return scanSse2;
+#endif
+        default: return scanScalar;
+    }
+}
+
+// Chosen on the first scan; crawl threads may race to set it, all to the same value
+static std::atomic<ScanFunction> activeScanner{nullptr};
+static std::atomic<ScanLevel> activeLevel{ScanLevel::Scalar};
+
+size_t scanForAny(const char* data, size_t size, char a, char b, char c) {
+    ScanFunction scanner = activeScanner.load(std::memory_order_relaxed);
+    if (!scanner) {
+        setScanLevel(supportedScanLevel());
+        scanner = activeScanner.load(std::memory_order_relaxed);
+    }
+    return scanner(data, size, a, b, c);
+}
+
+ScanLevel scanLevel() {
+    if (!activeScanner.load(std::memory_order_relaxed)) {
+        setScanLevel(supportedScanLevel());
+    }
+    return activeLevel.load(std::memory_order_relaxed);
+}
+
+void setScanLevel(ScanLevel level) {
+    ScanLevel supported = supportedScanLevel();
+    if (static_cast<int>(level) > static_cast<int>(supported)) level = supported;
+    activeLevel.store(level, std::memory_order_relaxed);
+    activeScanner.store(scannerFor(level), std::memory_order_relaxed);
+}
+
+const char* scanLevelName(ScanLevel level) {
+    switch (level) {
+        case ScanLevel::Scalar: return "scalar";
+        case ScanLevel::Sse2: return "sse2";
+        case ScanLevel::Avx2: return "avx2";
+    }
+    return "unknown";
+}
@@ -0,0 +1,36 @@
+#ifndef HTML_SCANNER_H
+#define HTML_SCANNER_H
+
+#include <cstddef>
+
+// Byte scanning for the HTML tokenizer: finds the next byte that can change
+// its state ('<', '>', '&', a quote, ...) so the plain bytes before it are
+// copied as one run instead of one char at a time.
+//
+// The scan compares 32 (AVX2) or 16 (SSE2) bytes per step. The widest
+// version the CPU supports is picked at first use; other CPUs get a scalar
+// loop. All versions return the same offsets.
+
+// Implementations, narrowest first
+enum class ScanLevel {
+    Scalar,
+    Sse2,
+    Avx2
+};
+
+// Offset of the first byte in data equal to a, b or c; size if there is none.
+// Pass the same byte more than once to look for fewer.
+size_t scanForAny(const char* data, size_t size, char a, char b, char c);
+
+// Widest implementation this CPU supports
+ScanLevel supportedScanLevel();
+
+// Implementation scanForAny() uses. setScanLevel() forces one (capped at
+// supportedScanLevel()), for tests and benchmarks comparing them.
+ScanLevel scanLevel();
+void setScanLevel(ScanLevel level);
+
+// Short name of a level (e.g. "avx2")
+const char* scanLevelName(ScanLevel level);
+
+#endif // HTML_SCANNER_H
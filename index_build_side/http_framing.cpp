@@ -0,0 +1,163 @@
+#include "http_framing.h"
+
+#include <algorithm>
+
+// Largest chunk size accepted before the framing is treated as corrupt
+#define MAX_CHUNK_SIZE (size_t(1) << 40)
+
+static int hexValue(char ch) {
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    return -1;
+}
+
+void BodyFramer::reset(BodyFraming framing, size_t contentLength) {
+    framing_ = framing;
+    remaining_ = contentLength;
+    sawDigit_ = false;
+
+    switch (framing) {
+        case BodyFraming::None:
+            state_ = State::Done;
+            break;
+        case BodyFraming::ContentLength:
+            state_ = contentLength == 0 ? State::Done : State::Body;
+            break;
+        case BodyFraming::Chunked:
+            state_ = State::ChunkSize;
+            remaining_ = 0;
+            break;
+        case BodyFraming::UntilClose:
+            state_ = State::Body;
+            break;
+    }
+}
+
+size_t BodyFramer::directBytes() const {
+    if (state_ == State::ChunkData) return remaining_;
+    if (state_ != State::Body) return 0;
+    return framing_ == BodyFraming::ContentLength ? remaining_ : SIZE_MAX;
+}
+
+void BodyFramer::commitDirect(size_t size) {
+    if (state_ == State::ChunkData) {
+        remaining_ -= size;
+        if (remaining_ == 0) state_ = State::ChunkDataCR;
+    } else if (state_ == State::Body && framing_ == BodyFraming::ContentLength) {
+        remaining_ -= size;
+        if (remaining_ == 0) state_ = State::Done;
+    }
+}
+
+size_t BodyFramer::feed(const char* data, size_t size, std::string& out) {
+    size_t i = 0;
+    while (i < size && state_ != State::Done && state_ != State::Error) {
+        char ch = data[i];
+        switch (state_) {
+            case State::Body: {
+                size_t take = size - i;
+                if (framing_ == BodyFraming::ContentLength) {
+                    take = std::min(take, remaining_);
+                    remaining_ -= take;
+                    if (remaining_ == 0) state_ = State::Done;
+                }
+                out.append(data + i, take);
+                i += take;
+                continue;
+            }
+
+            case State::ChunkSize: {
+                int digit = hexValue(ch);
+                if (digit >= 0) {
+                    if (remaining_ > MAX_CHUNK_SIZE) {
+                        state_ = State::Error;
+                        break;
+                    }
+                    remaining_ = remaining_ * 16 + digit;
+                    sawDigit_ = true;
+                } else if (!sawDigit_) {
+                    state_ = State::Error;
+                } else if (ch == ';' || ch == ' ' || ch == '\t') {
+                    state_ = State::ChunkExt;
+                } else if (ch == '\r') {
+                    state_ = State::ChunkSizeLF;
+                } else if (ch == '\n') {
+                    state_ = remaining_ == 0 ? State::TrailerStart : State::ChunkData;
+                } else {
+                    state_ = State::Error;
+                }
+                break;
+            }
+
+            case State::ChunkExt:
+                if (ch == '\r') {
+                    state_ = State::ChunkSizeLF;
+                } else if (ch == '\n') {
+                    state_ = remaining_ == 0 ? State::TrailerStart : State::ChunkData;
+                }
+                break;
+
+            case State::ChunkSizeLF:
+                if (ch != '\n') {
+                    state_ = State::Error;
+                    break;
+                }
+                state_ = remaining_ == 0 ? State::TrailerStart : State::ChunkData;
+                break;
+
+            case State::ChunkData: {
+                size_t take = std::min(size - i, remaining_);
+                out.append(data + i, take);
+                remaining_ -= take;
+                i += take;
+                if (remaining_ == 0) state_ = State::ChunkDataCR;
+                continue;
+            }
+
+            case State::ChunkDataCR:
+                if (ch == '\r') {
+                    state_ = State::ChunkDataLF;
+                } else if (ch == '\n') {
+                    state_ = State::ChunkSize;
+                    sawDigit_ = false;
+                } else {
+                    state_ = State::Error;
+                }
+                break;
+
+            case State::ChunkDataLF:
+                if (ch != '\n') {
+                    state_ = State::Error;
+                    break;
+                }
+                state_ = State::ChunkSize;
+                sawDigit_ = false;
+                break;
+
+            case State::TrailerStart:
+                if (ch == '\r') {
+                    state_ = State::TrailerEndLF;
+                } else if (ch == '\n') {
+                    state_ = State::Done;
+                } else {
+                    state_ = State::Trailer;
+                }
+                break;
+
+            case State::Trailer:
+                if (ch == '\n') state_ = State::TrailerStart;
+                break;
+
+            case State::TrailerEndLF:
+                state_ = ch == '\n' ? State::Done : State::Error;
+                break;
+
+            case State::Done:
+            case State::Error:
+                break;
+        }
+        ++i;
+    }
+    return i;
+}
@@ -0,0 +1,58 @@
+#ifndef HTTP_FRAMING_H
+#define HTTP_FRAMING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// How the end of a response body is delimited (RFC 9112 section 6.3)
+enum class BodyFraming {
+    None,          // No body (HEAD, 1xx, 204, 304)
+    ContentLength, // Exactly Content-Length bytes follow the header
+    Chunked,       // Transfer-Encoding: chunked
+    UntilClose     // Body runs until the server closes the connection
+};
+
+// Incremental decoder for one response body. Bytes are fed as they arrive,
+// chunk framing is removed on the fly and the payload is appended to out.
+class BodyFramer {
+public:
+    void reset(BodyFraming framing, size_t contentLength = 0);
+
+    // Consume up to size bytes and return how many belonged to this body.
+    // Anything left over already belongs to the next response on the connection.
+    size_t feed(const char* data, size_t size, std::string& out);
+
+    // Payload bytes that come next with no framing in between (the rest of a
+    // Content-Length body or of the current chunk); the caller may read these
+    // straight into the body and report them with commitDirect()
+    size_t directBytes() const;
+    void commitDirect(size_t size);
+
+    bool done() const { return state_ == State::Done; }
+    bool failed() const { return state_ == State::Error; }
+    BodyFraming framing() const { return framing_; }
+
+private:
+    enum class State {
+        Body,          // Content-Length or until-close payload
+        ChunkSize,     // Hex digits of the chunk size
+        ChunkExt,      // Chunk extension up to CRLF
+        ChunkSizeLF,   // LF ending the chunk size line
+        ChunkData,     // Chunk payload
+        ChunkDataCR,   // CR after the chunk payload
+        ChunkDataLF,   // LF after the chunk payload
+        TrailerStart,  // Start of a trailer line (or the final CRLF)
+        Trailer,       // Inside a trailer field line
+        TrailerEndLF,  // LF of the final CRLF
+        Done,
+        Error
+    };
+
+    BodyFraming framing_ = BodyFraming::None;
+    State state_ = State::Done;
+    size_t remaining_ = 0; // Bytes left in the body or current chunk
+    bool sawDigit_ = false;
+};
+
+#endif // HTTP_FRAMING_H
@@ -0,0 +1,211 @@
+#include "http_header_parser.h"
+#include "url.h"
+
+#include <cstring>
+
+// Lookup table of the characters allowed in a header field name (RFC 9110 tchar)
+struct TokenTable {
+    bool allowed[256] = {};
+
+    constexpr TokenTable() {
+        for (int ch = '0'; ch <= '9'; ++ch) allowed[ch] = true;
+        for (int ch = 'a'; ch <= 'z'; ++ch) allowed[ch] = true;
+        for (int ch = 'A'; ch <= 'Z'; ++ch) allowed[ch] = true;
+        for (const char* symbol = "!#$%&'*+-.^_`|~"; *symbol; ++symbol) {
+            allowed[static_cast<unsigned char>(*symbol)] = true;
+        }
+    }
+};
+
+static constexpr TokenTable TOKEN_TABLE;
+
+static bool isTokenChar(unsigned char ch) {
+    return TOKEN_TABLE.allowed[ch];
+}
+
+void HttpHeaderParser::reset() {
+    state_ = State::Version;
+    pos_ = 0;
+    mark_ = 0;
+    continuation_ = false;
+    statusDigits_ = 0;
+    status_ = 0;
+    versionMinor_ = 0;
+    headerSize_ = 0;
+    base_ = nullptr;
+    fieldCount_ = 0;
+}
+
+HeaderParseStatus HttpHeaderParser::fail() {
+    state_ = State::Error;
+    return HeaderParseStatus::Error;
+}
+
+HeaderParseStatus HttpHeaderParser::parse(const char* data, size_t size) {
+    base_ = data;
+    if (state_ == State::Done) return HeaderParseStatus::Complete;
+    if (state_ == State::Error) return HeaderParseStatus::Error;
+
+    size_t i = pos_;
+    while (i < size) {
+        char ch = data[i];
+        switch (state_) {
+            case State::Version:
+                if (ch == ' ') {
+                    // Exactly "HTTP/1.x"
+                    if (i - mark_ != 8 || std::memcmp(data + mark_, "HTTP/1.", 7) != 0 ||
+                        data[mark_ + 7] < '0' || data[mark_ + 7] > '9') {
+                        return fail();
+                    }
+                    versionMinor_ = data[mark_ + 7] - '0';
+                    state_ = State::StatusCode;
+                } else if (i - mark_ >= 8) {
+                    return fail();
+                }
+                ++i;
+                break;
+
+            case State::StatusCode:
+                if (ch >= '0' && ch <= '9' && statusDigits_ < 3) {
+                    status_ = status_ * 10 + (ch - '0');
+                    ++statusDigits_;
+                    ++i;
+                } else if (statusDigits_ == 3 && (ch == ' ' || ch == '\r' || ch == '\n')) {
+                    state_ = State::Reason;
+                } else {
+                    return fail();
+                }
+                break;
+
+            case State::Reason: {
+                const void* lf = std::memchr(data + i, '\n', size - i);
+                if (!lf) {
+                    i = size;
+                    break;
+                }
+                i = static_cast<const char*>(lf) - data + 1;
+                state_ = State::FieldStart;
+                break;
+            }
+
+            case State::FieldStart:
+                if (ch == '\r') {
+                    state_ = State::FinalLF;
+                    ++i;
+                } else if (ch == '\n') {
+                    headerSize_ = i + 1;
+                    state_ = State::Done;
+                    pos_ = headerSize_;
+                    return HeaderParseStatus::Complete;
+                } else if (ch == ' ' || ch == '\t') {
+                    // Obsolete line folding continues the previous value
+                    if (fieldCount_ == 0) return fail();
+                    continuation_ = true;
+                    state_ = State::ValueStart;
+                } else if (isTokenChar(static_cast<unsigned char>(ch))) {
+                    if (fieldCount_ == MAX_HEADER_FIELDS) return fail();
+                    mark_ = i;
+                    state_ = State::Name;
+                    ++i;
+                } else {
+                    return fail();
+                }
+                break;
+
+            case State::Name:
+                while (i < size && isTokenChar(static_cast<unsigned char>(data[i]))) ++i;
+                if (i == size) break;
+                if (data[i] != ':' || i == mark_) return fail();
+                nameOffset_ = static_cast<uint32_t>(mark_);
+                nameLength_ = static_cast<uint32_t>(i - mark_);
+                state_ = State::ValueStart;
+                ++i;
+                break;
+
+            case State::ValueStart:
+                if (ch == ' ' || ch == '\t') {
+                    ++i;
+                } else {
+                    mark_ = i;
+                    state_ = State::Value;
+                }
+                break;
+
+            case State::Value: {
+                const void* lf = std::memchr(data + i, '\n', size - i);
+                if (!lf) {
+                    i = size;
+                    break;
+                }
+                size_t lineEnd = static_cast<const char*>(lf) - data;
+                size_t end = lineEnd;
+                while (end > mark_ && (data[end - 1] == '\r' || data[end - 1] == ' ' || data[end - 1] == '\t')) {
+                    --end;
+                }
+
+                if (continuation_) {
+                    HeaderField& field = fields_[fieldCount_ - 1];
+                    if (end > mark_) {
+                        field.valueLength = static_cast<uint32_t>(end - field.valueOffset);
+                    }
+                    continuation_ = false;
+                } else {
+                    HeaderField& field = fields_[fieldCount_++];
+                    field.nameOffset = nameOffset_;
+                    field.nameLength = nameLength_;
+                    field.valueOffset = static_cast<uint32_t>(mark_);
+                    field.valueLength = static_cast<uint32_t>(end - mark_);
+                }
+                i = lineEnd + 1;
+                state_ = State::FieldStart;
+                break;
+            }
+
+            case State::FinalLF:
+                if (ch != '\n') return fail();
+                headerSize_ = i + 1;
+                state_ = State::Done;
+                pos_ = headerSize_;
+                return HeaderParseStatus::Complete;
+
+            case State::Done:
+            case State::Error:
+                break;
+        }
+    }
+
+    pos_ = i;
+    if (size > MAX_HEADER_SIZE) return fail();
+    return HeaderParseStatus::Incomplete;
+}
+
+std::string_view HttpHeaderParser::name(size_t index) const {
+    const HeaderField& field = fields_[index];
+    return std::string_view(base_ + field.nameOffset, field.nameLength);
+}
+
+std::string_view HttpHeaderParser::value(size_t index) const {
+    const HeaderField& field = fields_[index];
+    return std::string_view(base_ + field.valueOffset, field.valueLength);
+}
+
+std::string_view HttpHeaderParser::find(std::string_view fieldName) const {
+    for (size_t i = 0; i < fieldCount_; ++i) {
+        if (equalsIgnoreCase(name(i), fieldName)) {
+            return value(i);
+        }
+    }
+    return std::string_view();
+}
+
+long long HttpHeaderParser::contentLength() const {
+    std::string_view text = find("Content-Length");
+    if (text.empty()) return -1;
+
+    long long length = 0;
+    for (char ch : text) {
+        if (ch < '0' || ch > '9' || length > (1LL << 50)) return -1;
+        length = length * 10 + (ch - '0');
+    }
+    return length;
+}
@@ -0,0 +1,94 @@
+#ifndef HTTP_HEADER_PARSER_H
+#define HTTP_HEADER_PARSER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Most header fields kept per response; more is treated as malformed
+#define MAX_HEADER_FIELDS 100
+// Largest status line + header block accepted
+#define MAX_HEADER_SIZE (64 * 1024)
+
+// Result of feeding bytes to an HttpHeaderParser
+enum class HeaderParseStatus {
+    Incomplete, // Need more bytes
+    Complete,   // Blank line seen; headerSize() bytes belong to the header
+    Error       // Not a valid HTTP/1.x response header
+};
+
+// One header field as offsets into the caller's buffer. Left uninitialised
+// so a parser on the stack costs nothing until fields are recorded.
+struct HeaderField {
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t valueOffset;   // Leading and trailing whitespace excluded
+    uint32_t valueLength;
+};
+
+// Resumable HTTP/1.x response header parser. It never allocates: every field
+// is recorded as offsets into the buffer being parsed, so the caller keeps
+// the header bytes and passes the same (possibly grown or moved) buffer on
+// each call. Parsing resumes where the previous call stopped.
+class HttpHeaderParser {
+public:
+    void reset();
+
+    // Parse data[0, size), which starts at the first byte of the status line
+    HeaderParseStatus parse(const char* data, size_t size);
+
+    size_t headerSize() const { return headerSize_; }
+    int status() const { return status_; }
+    int versionMinor() const { return versionMinor_; } // 1 for HTTP/1.1, 0 for HTTP/1.0
+
+    // All fields in the order received; views point into the last buffer passed to parse()
+    size_t fieldCount() const { return fieldCount_; }
+    std::string_view name(size_t index) const;
+    std::string_view value(size_t index) const;
+
+    // Value of the first field called name (case-insensitive), empty if absent
+    std::string_view find(std::string_view name) const;
+
+    std::string_view contentType() const { return find("Content-Type"); }
+    std::string_view contentEncoding() const { return find("Content-Encoding"); }
+    std::string_view transferEncoding() const { return find("Transfer-Encoding"); }
+    std::string_view location() const { return find("Location"); }
+    std::string_view etag() const { return find("ETag"); }
+    std::string_view lastModified() const { return find("Last-Modified"); }
+    std::string_view connection() const { return find("Connection"); }
+
+    // Content-Length as a number, -1 if absent or invalid
+    long long contentLength() const;
+
+private:
+    enum class State {
+        Version,     // "HTTP/1.x"
+        StatusCode,  // Three digits
+        Reason,      // Reason phrase up to LF
+        FieldStart,  // Start of a field line, or the blank line
+        Name,        // Field name up to ':'
+        ValueStart,  // Whitespace before the value
+        Value,       // Value up to LF
+        FinalLF,     // LF of the blank line
+        Done,
+        Error
+    };
+
+    HeaderParseStatus fail();
+
+    State state_ = State::Version;
+    size_t pos_ = 0;           // Next byte to look at
+    size_t mark_ = 0;          // Start of the token being read
+    uint32_t nameOffset_ = 0;  // Name of the field whose value is being read
+    uint32_t nameLength_ = 0;
+    bool continuation_ = false; // Value line is an obsolete fold of the previous field
+    int statusDigits_ = 0;
+    int status_ = 0;
+    int versionMinor_ = 0;
+    size_t headerSize_ = 0;
+    const char* base_ = nullptr;
+    size_t fieldCount_ = 0;
+    HeaderField fields_[MAX_HEADER_FIELDS];
+};
+
+#endif // HTTP_HEADER_PARSER_H
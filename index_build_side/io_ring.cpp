@@ -0,0 +1,238 @@
+#include "io_ring.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Buffer group the receive buffers are registered under
+#define BUFFER_GROUP 0
+
+// Helper function to read a ring index the kernel writes
+static unsigned loadAcquire(const unsigned* index) {
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+}
+
+// Helper function to publish a ring index the kernel reads
+static void storeRelease(unsigned* index, unsigned value) {
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+}
+
+// Helper function to map one of the ring regions shared with the kernel
+static void* mapRing(int fd, size_t size, off_t offset) {
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    return memory == MAP_FAILED ? nullptr : memory;
+}
+
+IoRing::~IoRing() {
+    if (fd_ != -1) close(fd_);
+    if (bufferRing_) munmap(bufferRing_, bufferRingSize_);
+    if (buffers_) munmap(buffers_, buffersSize_);
+    if (sqes_) munmap(sqes_, sqesSize_);
+    if (cqRing_ && cqRing_ != sqRing_) munmap(cqRing_, cqRingSize_);
+    if (sqRing_) munmap(sqRing_, sqRingSize_);
+}
+
+bool IoRing::init(unsigned entries, unsigned bufferCount, unsigned bufferSize) {
+    io_uring_params params{};
+    params.flags = IORING_SETUP_COOP_TASKRUN; // No interrupts to run completions; we always enter to reap them
+    fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd_ < 0 && errno == EINVAL) {
+        params = io_uring_params{};
+        fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    }
+    if (fd_ < 0) {
+        error_ = std::string("io_uring_setup: ") + std::strerror(errno);
+        fd_ = -1;
+        return false;
+    }
+    // Timed waits need EXT_ARG (5.11); older kernels take the epoll path
+    if (!(params.features & IORING_FEAT_EXT_ARG)) {
+        error_ = "kernel lacks IORING_FEAT_EXT_ARG";
+        return false;
+    }
+
+    sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+    }
+    sqRing_ = mapRing(fd_, sqRingSize_, IORING_OFF_SQ_RING);
+    cqRing_ = (params.features & IORING_FEAT_SINGLE_MMAP) ? sqRing_ : mapRing(fd_, cqRingSize_, IORING_OFF_CQ_RING);
+    sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = static_cast<io_uring_sqe*>(mapRing(fd_, sqesSize_, IORING_OFF_SQES));
+    if (!sqRing_ || !cqRing_ || !sqes_) {
+        error_ = std::string("mmap: ") + std::strerror(errno);
+        return false;
+    }
+
+    char* sq = static_cast<char*>(sqRing_);
+    sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sqMask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sqEntries_ = params.sq_entries;
+    sqLocalTail_ = sqSubmitted_ = *sqTail_;
+    // Slot i of the indirection array always names entry i
+    unsigned* array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    for (unsigned i = 0; i < sqEntries_; ++i) array[i] = i;
+
+    char* cq = static_cast<char*>(cqRing_);
+    cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cqMask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    // Provided buffer ring (5.19): the ring of descriptors must be page aligned
+    bufferCount_ = bufferCount;
+    bufferSize_ = bufferSize;
+    bufferRingSize_ = bufferCount * sizeof(io_uring_buf);
+    buffersSize_ = static_cast<size_t>(bufferCount) * bufferSize;
+    void* ring = mmap(nullptr, bufferRingSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    void* buffers = mmap(nullptr, buffersSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    bufferRing_ = ring == MAP_FAILED ? nullptr : static_cast<io_uring_buf_ring*>(ring);
+    buffers_ = buffers == MAP_FAILED ? nullptr : static_cast<char*>(buffers);
+    if (!bufferRing_ || !buffers_) {
+        error_ = std::string("mmap: ") + std::strerror(errno);
+        return false;
+    }
+
+    io_uring_buf_reg registration{};
+    registration.ring_addr = reinterpret_cast<uint64_t>(bufferRing_);
+    registration.ring_entries = bufferCount;
+    registration.bgid = BUFFER_GROUP;
+    if (syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PBUF_RING, &registration, 1) != 0) {
+        error_ = std::string("buffer ring registration: ") + std::strerror(errno);
+        return false;
+    }
+    for (unsigned i = 0; i < bufferCount; ++i) {
+        provide(static_cast<uint16_t>(i));
+    }
+    publishBuffers();
+    return true;
+}
+
+// Claim the next submission entry, flushing the queue to the kernel if it is full
+io_uring_sqe* IoRing::nextSqe() {
+    if (sqLocalTail_ - loadAcquire(sqHead_) >= sqEntries_) {
+        enter(sqLocalTail_ - sqSubmitted_, 0, 0, nullptr, 0);
+    }
+    io_uring_sqe* sqe = &sqes_[sqLocalTail_ & sqMask_];
+    std::memset(sqe, 0, sizeof(*sqe));
+    ++sqLocalTail_;
+    return sqe;
+}
+
+void IoRing::prepConnect(int fd, const sockaddr* address, socklen_t length, uint64_t userData) {
+    io_uring_sqe* sqe = nextSqe();
+    sqe->opcode = IORING_OP_CONNECT;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(address);
+    sqe->off = length;
+    sqe->user_data = userData;
+}
+
+void IoRing::prepSend(int fd, const char* data, size_t size, uint64_t userData) {
+    io_uring_sqe* sqe = nextSqe();
+    sqe->opcode = IORING_OP_SEND;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(data);
+    sqe->len = static_cast<uint32_t>(size);
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = userData;
+}
+
+void IoRing::prepRecv(int fd, uint64_t userData) {
+    io_uring_sqe* sqe = nextSqe();
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->len = bufferSize_;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = BUFFER_GROUP;
+    sqe->user_data = userData;
+}
+
+void IoRing::prepPollIn(int fd, uint64_t userData) {
+    io_uring_sqe* sqe = nextSqe();
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data = userData;
+}
+
+int IoRing::enter(unsigned toSubmit, unsigned minComplete, unsigned flags, const void* arg, size_t argSize) {
+    storeRelease(sqTail_, sqLocalTail_);
+    int rc = static_cast<int>(syscall(__NR_io_uring_enter, fd_, toSubmit, minComplete, flags, arg, argSize));
+    ++stats_.enters;
+    if (rc > 0) {
+        sqSubmitted_ += rc;
+        stats_.submissions += rc;
+    }
+    return rc;
+}
+
+void IoRing::submitAndWait(int timeoutMs) {
+    unsigned toSubmit = sqLocalTail_ - sqSubmitted_;
+    bool ready = loadAcquire(cqTail_) != *cqHead_;
+    if (ready || timeoutMs == 0) {
+        // GETEVENTS without a minimum still runs completions the kernel deferred
+        if (toSubmit > 0 || !ready) enter(toSubmit, 0, IORING_ENTER_GETEVENTS, nullptr, 0);
+        return;
+    }
+
+    if (timeoutMs < 0) {
+        enter(toSubmit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+        return;
+    }
+    __kernel_timespec timeout{};
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_nsec = static_cast<long long>(timeoutMs % 1000) * 1000000;
+    io_uring_getevents_arg arg{};
+    arg.ts = reinterpret_cast<uint64_t>(&timeout);
+    enter(toSubmit, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+}
+
+bool IoRing::nextCompletion(IoCompletion& completion) {
+    unsigned head = *cqHead_;
+    if (head == loadAcquire(cqTail_)) {
+        return false;
+    }
+    const io_uring_cqe& cqe = cqes_[head & cqMask_];
+    completion.userData = cqe.user_data;
+    completion.result = cqe.res;
+    completion.flags = cqe.flags;
+    storeRelease(cqHead_, head + 1);
+    ++stats_.completions;
+    if (completion.result == -ENOBUFS) ++stats_.bufferShortages;
+    return true;
+}
+
+const char* IoRing::buffer(const IoCompletion& completion) const {
+    if (!(completion.flags & IORING_CQE_F_BUFFER)) return nullptr;
+    return buffers_ + static_cast<size_t>(completion.flags >> IORING_CQE_BUFFER_SHIFT) * bufferSize_;
+}
+
+void IoRing::recycle(const IoCompletion& completion) {
+    if (!(completion.flags & IORING_CQE_F_BUFFER)) return;
+    provide(static_cast<uint16_t>(completion.flags >> IORING_CQE_BUFFER_SHIFT));
+    publishBuffers();
+}
+
+// Put a buffer in the next free descriptor; the kernel sees it once published.
+// Descriptors are indexed from the ring base: the header's flexible array
+// member lands at offset 8 when compiled as C++, not at 0 where the kernel reads.
+void IoRing::provide(uint16_t bufferId) {
+    io_uring_buf* descriptors = reinterpret_cast<io_uring_buf*>(bufferRing_);
+    io_uring_buf& descriptor = descriptors[bufferTail_ & (bufferCount_ - 1)];
+    descriptor.addr = reinterpret_cast<uint64_t>(buffers_ + static_cast<size_t>(bufferId) * bufferSize_);
+    descriptor.len = bufferSize_;
+    descriptor.bid = bufferId;
+    ++bufferTail_;
+}
+
+void IoRing::publishBuffers() {
+    __atomic_store_n(&bufferRing_->tail, bufferTail_, __ATOMIC_RELEASE);
+}
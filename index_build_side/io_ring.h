@@ -0,0 +1,108 @@
+#ifndef IO_RING_H
+#define IO_RING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <sys/socket.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+
+// One finished submission
+struct IoCompletion {
+    uint64_t userData = 0;
+    int result = 0;      // Byte count, 0, or -errno
+    uint32_t flags = 0;
+};
+
+// Counters of an IoRing; submissions per enter shows how well work is batched
+struct IoRingStats {
+    unsigned long long submissions = 0;
+    unsigned long long enters = 0;      // io_uring_enter system calls
+    unsigned long long completions = 0;
+    unsigned long long bufferShortages = 0; // Receives that found the buffer ring empty
+};
+
+// Thin wrapper over the io_uring system calls (no liburing): a submission
+// and completion queue pair plus a ring of provided buffers that receives
+// pick from when data arrives, so an idle connection holds no buffer.
+//
+// prep*() only fills submission entries; nothing reaches the kernel until
+// submitAndWait(), which hands over everything queued in one system call.
+class IoRing {
+public:
+    IoRing() = default;
+    ~IoRing();
+
+    IoRing(const IoRing&) = delete;
+    IoRing& operator=(const IoRing&) = delete;
+
+    // Set up the rings and bufferCount (a power of two) receive buffers of
+    // bufferSize bytes. Returns false, with a reason in error(), on kernels
+    // without io_uring or without the features used here.
+    bool init(unsigned entries, unsigned bufferCount, unsigned bufferSize);
+    const std::string& error() const { return error_; }
+
+    void prepConnect(int fd, const sockaddr* address, socklen_t length, uint64_t userData);
+    void prepSend(int fd, const char* data, size_t size, uint64_t userData);
+    void prepRecv(int fd, uint64_t userData); // Buffer taken from the ring when data arrives
+    void prepPollIn(int fd, uint64_t userData);
+
+    // Submit everything queued and wait up to timeoutMs (-1 = forever,
+    // 0 = not at all) for a completion
+    void submitAndWait(int timeoutMs);
+
+    // Take the next completion; false when there is none
+    bool nextCompletion(IoCompletion& completion);
+
+    // The buffer a receive completion filled, or nullptr if it has none
+    const char* buffer(const IoCompletion& completion) const;
+
+    // Give a completion's buffer back to the ring
+    void recycle(const IoCompletion& completion);
+
+    const IoRingStats& stats() const { return stats_; }
+
+private:
+    io_uring_sqe* nextSqe();
+    void provide(uint16_t bufferId);
+    void publishBuffers();
+    int enter(unsigned toSubmit, unsigned minComplete, unsigned flags, const void* arg, size_t argSize);
+
+    int fd_ = -1;
+    std::string error_;
+    IoRingStats stats_;
+
+    // Submission queue
+    void* sqRing_ = nullptr;
+    size_t sqRingSize_ = 0;
+    unsigned* sqHead_ = nullptr;
+    unsigned* sqTail_ = nullptr;
+    unsigned sqMask_ = 0;
+    unsigned sqEntries_ = 0;
+    unsigned sqLocalTail_ = 0;    // Entries filled, published or not
+    unsigned sqSubmitted_ = 0;    // Entries handed to the kernel
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sqesSize_ = 0;
+
+    // Completion queue
+    void* cqRing_ = nullptr;      // Same mapping as sqRing_ when the kernel allows it
+    size_t cqRingSize_ = 0;
+    unsigned* cqHead_ = nullptr;
+    unsigned* cqTail_ = nullptr;
+    unsigned cqMask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+
+    // Provided buffers
+    io_uring_buf_ring* bufferRing_ = nullptr;
+    size_t bufferRingSize_ = 0;
+    char* buffers_ = nullptr;
+    size_t buffersSize_ = 0;
+    unsigned bufferCount_ = 0;
+    unsigned bufferSize_ = 0;
+    uint16_t bufferTail_ = 0;
+};
+
+#endif // IO_RING_H
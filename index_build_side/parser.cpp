@@ -1,166 +1,433 @@
 #include "parser.h"
+#include "html_entities.h"
+#include "html_scanner.h"
+#include "url.h"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <cstring>
 #include <iostream>
-#include <regex>
+#include <string_view>
 
-// Helper function to decode common HTML entities
-std::string decodeHTMLEntities(const std::string& text) {
-    std::string decoded;
-    decoded.reserve(text.size());
+// Byte classes for the word splitter: 0 for a byte that separates words,
+// otherwise the byte lowercased. ASCII only, like isalnum() in the C locale.
+static constexpr std::array<char, 256> makeWordChars() {
+    std::array<char, 256> table{};
+    for (int ch = '0'; ch <= '9'; ++ch) table[ch] = static_cast<char>(ch);
+    for (int ch = 'a'; ch <= 'z'; ++ch) {
+        table[ch] = static_cast<char>(ch);
+        table[ch - 'a' + 'A'] = static_cast<char>(ch);
+    }
+    return table;
+}
+static constexpr std::array<char, 256> WORD_CHARS = makeWordChars();
+
+// Helper function to find the value of a tag's href attribute (quoted or
+// not) without copying the tag. Returns false if the tag has none.
+static bool findHref(std::string_view tag, std::string_view& value) {
     size_t i = 0;
-    while (i < text.size()) {
-        if (text[i] == '&') {
-            if (text.compare(i, 4, "&lt;") == 0) {
-                decoded += '<';
-                i += 4;
-            }
-            else if (text.compare(i, 4, "&gt;") == 0) {
-                decoded += '>';
-                i += 4;
-            }
-            else if (text.compare(i, 5, "&amp;") == 0) {
-                decoded += '&';
-                i += 5;
-            }
-            // Add more entities as needed
-            else {
-                decoded += text[i];
-                i++;
-            }
+    while ((i = tag.find_first_of("hH", i)) != std::string_view::npos) {
+        bool atName = i > 0 && std::isspace(static_cast<unsigned char>(tag[i - 1]));
+        if (!atName || !equalsIgnoreCase(tag.substr(i, 4), "href")) {
+            ++i;
+            continue;
+        }
+        size_t pos = i + 4;
+        while (pos < tag.size() && std::isspace(static_cast<unsigned char>(tag[pos]))) ++pos;
+        if (pos == tag.size() || tag[pos] != '=') {
+            i = pos;
+            continue;
         }
-        else {
-            decoded += text[i];
-            i++;
+        ++pos;
+        while (pos < tag.size() && std::isspace(static_cast<unsigned char>(tag[pos]))) ++pos;
+        if (pos == tag.size()) return false;
+
+        size_t end;
+        if (tag[pos] == '"' || tag[pos] == '\'') {
+            end = tag.find(tag[pos], pos + 1);
+            if (end == std::string_view::npos) return false;
+            ++pos;
+        } else {
+            end = pos;
+            while (end < tag.size() && !std::isspace(static_cast<unsigned char>(tag[end]))) ++end;
         }
+        value = tag.substr(pos, end - pos);
+        return !value.empty();
     }
-    return decoded;
+    return false;
 }
 
+// Helper function to build the absolute link of an anchor tag into link,
+// reusing its memory. Returns false if the tag has no usable href.
+static bool handleAnchorTag(const std::string& baseUrl, const std::string& tagContent, std::string& link) {
+    link.clear();
+    std::string_view href;
+    if (!findHref(tagContent, href)) {
+        return false;
+    }
+
+    // If the href is already an absolute URL, return it
+    if (href.compare(0, 7, "http://") == 0 || href.compare(0, 8, "https://") == 0) {
+        link.append(href);
+        return true;
+    }
+
+    UrlParts base;
+    if (!parseUrl(baseUrl, base)) {
+        return false; // Hostname extraction failed
+    }
 
-// Helper function to convert a string to lowercase
-std::string toLower(const std::string& str) {
-    std::string lowerStr;
-    lowerStr.reserve(str.size());
-    for (char ch : str) {
-        lowerStr += static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    // Relative links are taken as https on the same host. A non-default
+    // port only makes sense with the scheme it was given for, so it keeps both.
+    if (base.port.empty()) {
+        link += "https:";
+    } else {
+        link.append(base.scheme);
+        link += ':';
+    }
+    if (href.compare(0, 2, "//") == 0) {
+        link.append(href); // Protocol-relative: names its own host
+        return true;
     }
-    return lowerStr;
+    link += "//";
+    link.append(base.host);
+    if (!base.port.empty()) {
+        link += ':';
+        link.append(base.port);
+    }
+    if (href.front() != '/') link += '/';
+    link.append(href);
+    return true;
 }
 
-std::string getHostname(const std::string& url) {
-    // Extract the hostname from the URL
-    std::regex urlRegex(R"(^(https?://)?([^/]+))");
-    std::smatch match;
-    if (std::regex_search(url, match, urlRegex)) {
-        return match[2].str(); // Return the hostname
+HtmlStreamParser::HtmlStreamParser(const std::string& url, WordViewCallback onWord, LinkCallback onLink)
+    : url_(url), onWord_(std::move(onWord)), onLink_(std::move(onLink)) {
+    tagBuffer_.reserve(64);
+    currentWord_.reserve(16);
+}
+
+HtmlStreamParser::HtmlStreamParser(const std::string& url, WordCallback onWord, LinkCallback onLink)
+    : HtmlStreamParser(url, WordViewCallback(), std::move(onLink)) {
+    if (onWord) {
+        onWord_ = [onWord = std::move(onWord)](std::string_view word) { onWord(std::string(word)); };
     }
-    return ""; // Return empty string if no match
 }
 
-std::string handleAnchorTag(const std::string& baseUrl, const std::string& tagContent) {
-    std::regex hrefRegex(R"(href\s*=\s*["']([^"']+)["'])");
-    std::smatch match;
+// Helper function for the whitespace that separates a tag's name and attributes
+static bool isTagSpace(char ch) {
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == '\f';
+}
 
-    if (std::regex_search(tagContent, match, hrefRegex)) {
-        std::string href = match[1].str();
+// Helper function to check whether a quote at the end of a tag so far opens
+// an attribute value: only right after '=' (title=it's has no quoted value)
+static bool opensValue(const std::string& tag) {
+    size_t last = tag.size();
+    while (last > 0 && isTagSpace(tag[last - 1])) --last;
+    return last > 0 && tag[last - 1] == '=';
+}
 
-        // If the href is already an absolute URL, return it
-        if (href.find("http://") == 0 || href.find("https://") == 0) {
-            return href;
-        }
+// Strip tags, comments and raw text, reporting anchor links, and hand each
+// run of text to consumeText(). Each state either consumes the character or
+// leaves it to be looked at again in the state it switched to. Text and tags
+// are scanned for the next byte that matters and handled a run at a time.
+void HtmlStreamParser::feed(const char* data, size_t size) {
+    size_t i = 0;
+    while (i < size) {
+        char ch = data[i];
+        switch (state_) {
+            case State::Text: {
+                size_t run = scanForAny(data + i, size - i, '<', '<', '<');
+                consumeText(data + i, run);
+                i += run;
+                if (i < size) {
+                    // A reference never runs into markup: "&am<b>p;" is not "&amp;"
+                    while (!entityCarry_.empty()) resolveEntity(true);
+                    state_ = State::TagOpen;
+                    ++i;
+                }
+                break;
+            }
 
-        // Extract the hostname from the base URL
-        std::string hostname = getHostname(baseUrl);
-        if (hostname.empty()) {
-            return ""; // Return empty string if hostname extraction fails
-        }
+            case State::TagOpen:
+                if (std::isalpha(static_cast<unsigned char>(ch)) || ch == '/') {
+                    state_ = State::Tag;
+                    tagBuffer_.clear();
+                    quote_ = 0;
+                } else if (ch == '!') {
+                    state_ = State::Declaration;
+                    markup_.clear();
+                    ++i;
+                } else if (ch == '?') {
+                    state_ = State::Bogus;
+                    ++i;
+                } else {
+                    // "a < b": the '<' was text after all
+                    consumeText("<", 1);
+                    state_ = State::Text;
+                }
+                break;
 
-        // Convert relative URL to absolute URL
-        if (href.front() == '/') {
-            return "https://" + hostname + href;
-        } else {
-            return "https://" + hostname + '/' + href;
+            case State::Tag: {
+                if (quote_ != 0) {
+                    // Inside a quoted value only the closing quote matters
+                    size_t run = scanForAny(data + i, size - i, quote_, quote_, quote_);
+                    if (run < size - i) {
+                        quote_ = 0;
+                        ++run;
+                    }
+                    tagBuffer_.append(data + i, run);
+                    i += run;
+                    break;
+                }
+                size_t run = scanForAny(data + i, size - i, '>', '"', '\'');
+                tagBuffer_.append(data + i, run);
+                i += run;
+                if (i == size) break;
+                ch = data[i++];
+                if (ch == '>') {
+                    endTag();
+                    break;
+                }
+                if (opensValue(tagBuffer_)) quote_ = ch;
+                tagBuffer_ += ch;
+                break;
+            }
+
+            case State::Declaration: {
+                markup_ += ch;
+                static const std::string COMMENT_OPEN = "--";
+                static const std::string CDATA_OPEN = "[CDATA[";
+                if (markup_ == COMMENT_OPEN) {
+                    state_ = State::Comment;
+                    matched_ = 2; // The opening dashes count, so "<!-->" is an empty comment
+                } else if (markup_ == CDATA_OPEN) {
+                    state_ = State::Cdata;
+                    matched_ = 0;
+                } else if (COMMENT_OPEN.compare(0, markup_.size(), markup_) != 0 &&
+                           CDATA_OPEN.compare(0, markup_.size(), markup_) != 0) {
+                    state_ = State::Bogus; // "<!DOCTYPE html>" and the like
+                    break;                 // The character may be its '>'
+                }
+                ++i;
+                break;
+            }
+
+            case State::Comment:
+                if (matched_ == 0) {
+                    // Only a dash can start the end of a comment
+                    const void* dash = std::memchr(data + i, '-', size - i);
+                    if (dash) {
+                        matched_ = 1;
+                        i = static_cast<const char*>(dash) - data + 1;
+                    } else {
+                        i = size;
+                    }
+                    break;
+                }
+                if (ch == '-') {
+                    ++matched_;
+                } else if (ch == '>' && matched_ >= 2) {
+                    state_ = State::Text;
+                } else {
+                    matched_ = 0;
+                }
+                ++i;
+                break;
+
+            case State::Cdata:
+                if (ch == ']') {
+                    if (matched_ == 2) consumeText("]", 1); // "]]]": the first one is text
+                    else ++matched_;
+                } else if (ch == '>' && matched_ == 2) {
+                    state_ = State::Text;
+                } else {
+                    consumeText("]]", matched_);
+                    matched_ = 0;
+                    consumeText(&ch, 1);
+                }
+                ++i;
+                break;
+
+            case State::Bogus: {
+                const void* close = std::memchr(data + i, '>', size - i);
+                if (close) {
+                    state_ = State::Text;
+                    i = static_cast<const char*>(close) - data + 1;
+                } else {
+                    i = size;
+                }
+                break;
+            }
+
+            case State::RawText:
+                if (matched_ == rawTextEnd_.size()) {
+                    // "</script" ends the raw text only as a whole tag name
+                    if (isTagSpace(ch) || ch == '/' || ch == '>') {
+                        state_ = State::Tag;
+                        tagBuffer_.assign(rawTextEnd_, 1, std::string::npos);
+                        quote_ = 0;
+                    } else {
+                        matched_ = 0;
+                    }
+                    break;
+                }
+                if (matched_ == 0) {
+                    const void* open = std::memchr(data + i, '<', size - i);
+                    if (!open) {
+                        i = size;
+                        break;
+                    }
+                    i = static_cast<const char*>(open) - data;
+                    ch = '<';
+                }
+                if (std::tolower(static_cast<unsigned char>(ch)) == rawTextEnd_[matched_]) {
+                    ++matched_;
+                } else {
+                    matched_ = ch == '<' ? 1 : 0;
+                }
+                ++i;
+                break;
         }
     }
+}
+
+// A tag is complete: report an anchor's link, or enter the raw text of a
+// <script> or <style> element
+void HtmlStreamParser::endTag() {
+    state_ = State::Text;
+
+    // Process the full tag content
+    size_t nameEnd = 0;
+    while (nameEnd < tagBuffer_.size() && !isTagSpace(tagBuffer_[nameEnd]) &&
+           (tagBuffer_[nameEnd] != '/' || nameEnd == 0)) {
+        ++nameEnd;
+    }
+    std::string_view name(tagBuffer_.data(), nameEnd);
 
-    // Return an empty string if no href is found
-    return "";
+    // Check if it's an anchor tag
+    if (equalsIgnoreCase(name, "a")) {
+        if (handleAnchorTag(url_, tagBuffer_, linkBuffer_) && onLink_) {
+            onLink_(linkBuffer_);
+        }
+    } else if (equalsIgnoreCase(name, "script") || equalsIgnoreCase(name, "style")) {
+        state_ = State::RawText;
+        rawTextEnd_ = "</";
+        for (char ch : name) rawTextEnd_ += static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+        matched_ = 0;
+    }
 }
 
-std::string stripHTMLTags(const std::string& url, const std::string& html, std::vector<std::string>& links) {
-    std::string result;
-    bool insideTag = false;
-    std::string tagBuffer;
-    result.reserve(html.size());
+// Decode character references, split words and lowercase them in one go. Word bytes are
+// appended to the current word through WORD_CHARS; every other byte ends it.
+// An entity that runs past the end of data waits in entityCarry_ for the
+// next piece of text; feed() settles it as it stands at the next '<'.
+void HtmlStreamParser::consumeText(const char* data, size_t size) {
+    size_t i = 0;
+    while (!entityCarry_.empty() && i < size) {
+        entityCarry_ += data[i++];
+        resolveEntity(false);
+    }
 
-    for (char ch : html) {
-        if (ch == '<') {
-            insideTag = true;
-            tagBuffer.clear();
+    while (i < size) {
+        char lower = WORD_CHARS[static_cast<unsigned char>(data[i])];
+        if (lower != 0) {
+            currentWord_ += lower;
+            ++i;
             continue;
         }
-        if (ch == '>') {
-            insideTag = false;
-
-            // Process the full tag content
-            if (!tagBuffer.empty()) {
-                // Check if it's an anchor tag
-                if (tagBuffer.find("a ") == 0 || tagBuffer == "a") {
-                    std::string fullAnchor = "<" + tagBuffer + ">";
-                    std::string absoluteUrl = handleAnchorTag(url, fullAnchor);
-                    if (!absoluteUrl.empty()) {
-                        links.push_back(absoluteUrl);
-                    }
-                }
-            }
+        if (data[i] != '&') {
+            endWord();
+            ++i;
             continue;
         }
-        if (insideTag) {
-            tagBuffer += ch;
-        } else {
-            result += ch; // Append non-tag content to the result
+
+        char decoded[MAX_REFERENCE_UTF8];
+        size_t decodedSize;
+        size_t length = decodeCharacterReference(std::string_view(data + i, size - i), false, decoded, decodedSize);
+        if (length == REFERENCE_INCOMPLETE) {
+            entityCarry_.assign(data + i, size - i);
+            return;
+        }
+        if (length == 0) {
+            // Not a reference: the '&' separates words like any other symbol
+            endWord();
+            ++i;
+            continue;
         }
+        pushDecoded(decoded, decodedSize);
+        i += length;
     }
+}
 
-    // Decode HTML entities in the resultant text
-    result = decodeHTMLEntities(result);
-    return result;
+// Split a decoded reference like text, without decoding it again. Only ASCII
+// letters and digits make words, so "&nbsp;" and other non-ASCII characters
+// separate them.
+void HtmlStreamParser::pushDecoded(const char* decoded, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        char lower = WORD_CHARS[static_cast<unsigned char>(decoded[i])];
+        if (lower != 0) currentWord_ += lower;
+        else endWord();
+    }
 }
 
-std::vector<std::string> splitIntoWords(const std::string& text) {
-    std::vector<std::string> words;
-    std::string currentWord;
-    currentWord.reserve(16);
+// Settle the carried "&..." once it is a whole entity or cannot become one
+// (or the page ends). Whatever follows the entity, or the '&' that turned
+// out not to start one, goes back through consumeText().
+void HtmlStreamParser::resolveEntity(bool atEnd) {
+    char decoded[MAX_REFERENCE_UTF8];
+    size_t decodedSize;
+    size_t length = decodeCharacterReference(entityCarry_, atEnd, decoded, decodedSize);
+    if (length == REFERENCE_INCOMPLETE) return;
 
-    for (char ch : text) {
-        if (std::isalnum(static_cast<unsigned char>(ch))) {
-            currentWord += ch;
-        } else {
-            if (!currentWord.empty()) {
-                words.push_back(toLower(currentWord));
-                currentWord.clear();
-            }
-        }
+    if (length == 0) {
+        endWord();
+        length = 1;
+    } else {
+        pushDecoded(decoded, decodedSize);
     }
+    std::string rest = entityCarry_.substr(length);
+    entityCarry_.clear();
+    consumeText(rest.data(), rest.size());
+}
 
-    if (!currentWord.empty()) {
-        words.push_back(toLower(currentWord));
-    }
+// Hand over the word being built, if there is one
+void HtmlStreamParser::endWord() {
+    if (currentWord_.empty()) return;
+    if (onWord_) onWord_(currentWord_);
+    currentWord_.clear();
+}
 
-    return words;
+void HtmlStreamParser::finish() {
+    while (!entityCarry_.empty()) resolveEntity(true);
+    endWord();
 }
 
 // The main parser function
 ParsedData parseHTML(const std::string& url, const std::string& html) {
-    std::vector<std::string> links;
-    
-    // Step 1: Strip HTML tags and collect links
-    std::string text = stripHTMLTags(url, html, links);
+    ParsedData parsed{url, {}, {}};
+
+    // Strip tags, collect links and split words in a single streaming pass
+    HtmlStreamParser parser(
+        url,
+        [&parsed](std::string&& word) { parsed.words.push_back(std::move(word)); },
+        [&parsed](const std::string& link) { parsed.links.push_back(link); });
+    parser.feed(html.data(), html.size());
+    parser.finish();
+
+    return parsed;
+}
 
-    // Step 2: Split text into words
-    std::vector<std::string> extractedWords = splitIntoWords(text);
+// The arena-backed parser: words go from the parser's buffer straight into the arena
+void parseHTML(const std::string& url, const std::string& html, TokenArena& arena, ParsedPage& page) {
+    page.clear();
+    page.url = arena.store(url);
 
-    return {url, extractedWords, links};
+    HtmlStreamParser parser(
+        url,
+        HtmlStreamParser::WordViewCallback(
+            [&page, &arena](std::string_view word) { page.words.push_back(arena.store(word)); }),
+        [&page, &arena](const std::string& link) { page.links.push_back(arena.store(link)); });
+    parser.feed(html.data(), html.size());
+    parser.finish();
 }
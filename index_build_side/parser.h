@@ -1,10 +1,14 @@
 #ifndef PARSER_H
 #define PARSER_H
 
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <utility>
+#include "token_arena.h"
 
 struct ParsedData {
     std::string url;                     // The URL of the parsed page
@@ -14,4 +18,89 @@ struct ParsedData {
 
 ParsedData parseHTML(const std::string& url, const std::string& html);
 
+// ParsedData without a heap string per token: words and links are views
+// into a TokenArena and stay valid until it is reset. Clearing a ParsedPage
+// and resetting its arena between pages reuses all of their memory.
+struct ParsedPage {
+    std::string_view url;                  // The URL of the parsed page
+    std::vector<std::string_view> words;   // Words extracted from the page
+    std::vector<std::string_view> links;   // Links found on the page
+
+    void clear() {
+        url = std::string_view();
+        words.clear();
+        links.clear();
+    }
+};
+
+// Parse html into page, storing its tokens (and the URL) in arena
+void parseHTML(const std::string& url, const std::string& html, TokenArena& arena, ParsedPage& page);
+
+// Push-style version of parseHTML for bodies that arrive in pieces. Each
+// piece is handled straight away; the little state needed across pieces
+// (an open tag, a split entity, a split word) is carried over. Words and
+// links are handed to the callbacks as soon as they are complete.
+//
+// Text is not collected anywhere: each run between tags goes through one
+// loop that decodes entities, splits words and lowercases them through a
+// lookup table, so a text byte is only written once, into the word it
+// belongs to.
+//
+// Tags are stripped by a state machine modelled on the WHATWG tokenizer:
+// comments, CDATA sections, doctypes and processing instructions are told
+// apart, a '>' inside a quoted attribute value does not end its tag, and
+// the contents of <script> and <style> are skipped up to their end tag, so
+// none of them reach the word stream.
+class HtmlStreamParser {
+public:
+    using WordCallback = std::function<void(std::string&& word)>;
+    using WordViewCallback = std::function<void(std::string_view word)>;
+    using LinkCallback = std::function<void(const std::string& link)>;
+
+    HtmlStreamParser(const std::string& url, WordCallback onWord, LinkCallback onLink);
+
+    // Words are handed over as views of the parser's own buffer, valid only
+    // during the call, so nothing is allocated per word. Wrap the lambda in
+    // a WordViewCallback, as it would fit either constructor.
+    HtmlStreamParser(const std::string& url, WordViewCallback onWord, LinkCallback onLink);
+
+    // Parse the next piece of the page
+    void feed(const char* data, size_t size);
+
+    // Flush whatever is still held back at the end of the page
+    void finish();
+
+private:
+    // Where the tokenizer is in the markup
+    enum class State {
+        Text,        // Character data
+        TagOpen,     // Just after '<'
+        Tag,         // Inside a start or end tag
+        Declaration, // After "<!", telling a comment from CDATA or a doctype
+        Comment,     // Inside "<!-- -->"
+        Cdata,       // Inside "<![CDATA[ ]]>"; the content is text
+        Bogus,       // Doctype, "<?...>" or other markup, skipped up to '>'
+        RawText      // Content of <script> or <style>, skipped up to the end tag
+    };
+
+    void endTag();
+    void consumeText(const char* data, size_t size);
+    void resolveEntity(bool atEnd);
+    void pushDecoded(const char* decoded, size_t size);
+    void endWord();
+
+    std::string url_;
+    WordViewCallback onWord_;
+    LinkCallback onLink_;
+    State state_ = State::Text;
+    char quote_ = 0;           // Quote around the attribute value being read, if any
+    std::string markup_;       // Characters after "<!" so far
+    std::string rawTextEnd_;   // "</script" or "</style" while in raw text
+    size_t matched_ = 0;       // Progress through the terminator of the current comment, CDATA section or raw text
+    std::string tagBuffer_;    // Content of the current (or last) tag
+    std::string linkBuffer_;   // Link of the last anchor, rebuilt in place
+    std::string entityCarry_;  // "&..." read so far that may still become an entity
+    std::string currentWord_;  // Lowercased word being built, possibly across pieces
+};
+
 #endif
@@ -0,0 +1,154 @@
+#include "redirect_map.h"
+#include "url.h"
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <unordered_set>
+#include <vector>
+
+// Helper function to check for a "scheme:" prefix (RFC 3986 section 3.1)
+static bool hasScheme(const std::string& reference) {
+    if (reference.empty() || !std::isalpha(static_cast<unsigned char>(reference[0]))) {
+        return false;
+    }
+    for (char ch : reference) {
+        if (ch == ':') return true;
+        if (!std::isalnum(static_cast<unsigned char>(ch)) && ch != '+' && ch != '-' && ch != '.') {
+            return false;
+        }
+    }
+    return false;
+}
+
+// Helper function to resolve "." and ".." segments in a path
+static std::string removeDotSegments(const std::string& path) {
+    std::vector<std::string> segments;
+    size_t start = 1; // Paths handled here always begin with '/'
+    while (start <= path.size()) {
+        size_t end = path.find('/', start);
+        if (end == std::string::npos) end = path.size();
+        std::string segment = path.substr(start, end - start);
+
+        bool last = end == path.size();
+        if (segment == "..") {
+            if (!segments.empty()) segments.pop_back();
+            if (last) segments.emplace_back();
+        } else if (segment == ".") {
+            if (last) segments.emplace_back();
+        } else {
+            segments.push_back(segment);
+        }
+        start = end + 1;
+    }
+
+    std::string result;
+    for (const std::string& segment : segments) {
+        result += '/';
+        result += segment;
+    }
+    return result.empty() ? "/" : result;
+}
+
+std::string resolveLocation(const std::string& baseUrl, const std::string& location) {
+    std::string reference = location;
+    reference.erase(0, reference.find_first_not_of(" \t"));
+    reference.erase(reference.find_last_not_of(" \t") + 1);
+    size_t fragment = reference.find('#');
+    if (fragment != std::string::npos) reference.erase(fragment);
+
+    UrlParts base;
+    if (!parseUrl(baseUrl, base) || base.scheme.empty()) {
+        return "";
+    }
+
+    if (hasScheme(reference)) {
+        size_t colon = reference.find(':');
+        std::string_view scheme(reference.data(), colon);
+        if (equalsIgnoreCase(scheme, "http")) return "http" + reference.substr(colon);
+        if (equalsIgnoreCase(scheme, "https")) return "https" + reference.substr(colon);
+        return "";
+    }
+    if (reference.compare(0, 2, "//") == 0) {
+        return std::string(base.scheme) + ":" + reference;
+    }
+
+    // The origin (scheme://host[:port]) is everything before the base's path
+    std::string origin = baseUrl.substr(0, base.path.data() - baseUrl.data());
+    std::string basePath = base.path.empty() ? "/" : std::string(base.path);
+
+    if (reference.empty()) {
+        return baseUrl.substr(0, baseUrl.find('#'));
+    }
+    if (reference[0] == '?') {
+        return origin + basePath + reference;
+    }
+
+    size_t queryStart = reference.find('?');
+    std::string path = reference.substr(0, queryStart);
+    std::string query = queryStart == std::string::npos ? "" : reference.substr(queryStart);
+    if (path[0] != '/') {
+        path = basePath.substr(0, basePath.rfind('/') + 1) + path;
+    }
+    return origin + removeDotSegments(path) + query;
+}
+
+void RedirectMap::learn(const std::string& url, const std::string& target) {
+    if (url == target || target.empty()) return;
+    if (url.find_first_of("\t\r\n") != std::string::npos || target.find_first_of("\t\r\n") != std::string::npos) return;
+    targets_[url] = target;
+}
+
+std::string RedirectMap::resolve(const std::string& url) const {
+    std::string current = url;
+    std::unordered_set<std::string> seen{url};
+    for (int hop = 0; hop < MAX_LEARNED_HOPS; ++hop) {
+        auto it = targets_.find(current);
+        if (it == targets_.end() || !seen.insert(it->second).second) {
+            break;
+        }
+        current = it->second;
+    }
+    return current;
+}
+
+void RedirectMap::forget(const std::string& url) {
+    targets_.erase(url);
+}
+
+bool RedirectMap::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t tab = line.find('\t');
+        if (tab == std::string::npos) {
+            std::cerr << "Skipping malformed redirect line in " << path << std::endl;
+            continue;
+        }
+        learn(line.substr(0, tab), line.substr(tab + 1));
+    }
+    return true;
+}
+
+bool RedirectMap::save(const std::string& path) const {
+    // Write a temporary file first so a crash never leaves a truncated map
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        for (const auto& entry : targets_) {
+            file << entry.first << '\t' << entry.second << '\n';
+        }
+        if (!file) {
+            return false;
+        }
+    }
+    return std::rename(temporary.c_str(), path.c_str()) == 0;
+}
@@ -0,0 +1,38 @@
+#ifndef REDIRECT_MAP_H
+#define REDIRECT_MAP_H
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+// Most known redirects followed when resolving a URL
+#define MAX_LEARNED_HOPS 10
+
+// Resolve a Location header against the URL that sent it.
+// Returns an empty string for targets that are not http(s).
+std::string resolveLocation(const std::string& baseUrl, const std::string& location);
+
+// Learned permanent redirects (301 / 308). Once a URL is known to move,
+// later links to it go straight to the final target instead of paying a
+// round trip for the redirect again.
+class RedirectMap {
+public:
+    // Remember that url permanently redirects to target
+    void learn(const std::string& url, const std::string& target);
+
+    // Final target of url after following known redirects (url itself if none).
+    // Chains are followed up to MAX_LEARNED_HOPS; a loop stops at the last new URL.
+    std::string resolve(const std::string& url) const;
+
+    void forget(const std::string& url);
+    size_t size() const { return targets_.size(); }
+
+    // One "url\ttarget" line per redirect
+    bool load(const std::string& path);
+    bool save(const std::string& path) const;
+
+private:
+    std::unordered_map<std::string, std::string> targets_;
+};
+
+#endif // REDIRECT_MAP_H
@@ -0,0 +1,368 @@
+#include "resolver.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstring>
+#include <iterator>
+#include <netdb.h>
+#include <resolv.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <arpa/nameser.h>
+#include <netinet/in.h>
+#include <sys/eventfd.h>
+
+// Size of the buffer for a raw DNS answer
+#define DNS_ANSWER_SIZE 4096
+// Shortest time an answer is cached, whatever the TTL options say, so the
+// fetches waiting on a lookup find its answer instead of queueing another
+#define MIN_CACHE_TTL_SECONDS 1
+
+// Parse an IPv4 or IPv6 literal (the latter with or without the brackets
+// it carries in URLs) without touching the network
+static bool parseNumericHost(const std::string& hostname, ResolvedHost& result) {
+    HostAddress address;
+    auto* v4 = reinterpret_cast<sockaddr_in*>(&address.addr);
+    auto* v6 = reinterpret_cast<sockaddr_in6*>(&address.addr);
+    std::string literal = hostname;
+    if (literal.size() > 2 && literal.front() == '[' && literal.back() == ']') {
+        literal = literal.substr(1, literal.size() - 2);
+    }
+
+    if (inet_pton(AF_INET, literal.c_str(), &v4->sin_addr) == 1) {
+        v4->sin_family = AF_INET;
+        address.length = sizeof(sockaddr_in);
+    } else if (inet_pton(AF_INET6, literal.c_str(), &v6->sin6_addr) == 1) {
+        v6->sin6_family = AF_INET6;
+        address.length = sizeof(sockaddr_in6);
+    } else {
+        return false;
+    }
+    result.found = true;
+    result.addresses.push_back(address);
+    return true;
+}
+
+// Query DNS for one record type (A or AAAA) directly so the answer's TTL is known.
+// Returns the smallest record TTL, or -1 if DNS gave no usable answer.
+static int queryRecords(res_state state, const std::string& hostname, int type, ResolvedHost& result) {
+    unsigned char answer[DNS_ANSWER_SIZE];
+    int length = res_nquery(state, hostname.c_str(), ns_c_in, type, answer, sizeof(answer));
+    if (length < 0) {
+        return -1;
+    }
+
+    ns_msg message;
+    if (ns_initparse(answer, length, &message) != 0) {
+        return -1;
+    }
+
+    int ttl = INT_MAX;
+    unsigned size = type == ns_t_aaaa ? 16 : 4;
+    int count = ns_msg_count(message, ns_s_an);
+    for (int i = 0; i < count; ++i) {
+        ns_rr record;
+        if (ns_parserr(&message, ns_s_an, i, &record) != 0) continue;
+        if (ns_rr_type(record) != type || ns_rr_rdlen(record) != size) continue;
+
+        HostAddress address;
+        if (type == ns_t_aaaa) {
+            auto* v6 = reinterpret_cast<sockaddr_in6*>(&address.addr);
+            v6->sin6_family = AF_INET6;
+            std::memcpy(&v6->sin6_addr, ns_rr_rdata(record), 16);
+            address.length = sizeof(sockaddr_in6);
+        } else {
+            auto* v4 = reinterpret_cast<sockaddr_in*>(&address.addr);
+            v4->sin_family = AF_INET;
+            std::memcpy(&v4->sin_addr, ns_rr_rdata(record), 4);
+            address.length = sizeof(sockaddr_in);
+        }
+        result.addresses.push_back(address);
+        ttl = std::min(ttl, static_cast<int>(ns_rr_ttl(record)));
+    }
+    return ttl == INT_MAX ? -1 : ttl;
+}
+
+// Query DNS for AAAA (optionally) and A records. IPv6 addresses come first,
+// as RFC 6724 prefers them; the connecting side interleaves the families.
+// Returns the smallest TTL of both answers, or -1 if neither was usable.
+static int queryDns(res_state state, const std::string& hostname, bool ipv6, ResolvedHost& result) {
+    int ttl = -1;
+    if (ipv6) {
+        ttl = queryRecords(state, hostname, ns_t_aaaa, result);
+        // No such name at all: the A query would say the same
+        if (ttl < 0 && state->res_h_errno == HOST_NOT_FOUND) {
+            return -1;
+        }
+    }
+    int v4Ttl = queryRecords(state, hostname, ns_t_a, result);
+    if (v4Ttl >= 0) {
+        ttl = ttl < 0 ? v4Ttl : std::min(ttl, v4Ttl);
+    }
+
+    if (result.addresses.empty()) {
+        return -1;
+    }
+    result.found = true;
+    return ttl;
+}
+
+// Fall back to the system resolver, which also consults /etc/hosts
+static bool querySystem(const std::string& hostname, bool ipv6, ResolvedHost& result) {
+    struct addrinfo hints{}, *list;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = ipv6 ? AF_UNSPEC : AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+
+    if (getaddrinfo(hostname.c_str(), nullptr, &hints, &list) != 0) {
+        return false;
+    }
+    for (struct addrinfo* entry = list; entry; entry = entry->ai_next) {
+        HostAddress address;
+        std::memcpy(&address.addr, entry->ai_addr, entry->ai_addrlen);
+        address.length = entry->ai_addrlen;
+        result.addresses.push_back(address);
+    }
+    freeaddrinfo(list);
+
+    result.found = !result.addresses.empty();
+    return result.found;
+}
+
+Resolver::Resolver(const ResolverOptions& options)
+    : options_(options), eventFd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+    if (options_.threads == 0) options_.threads = 1;
+}
+
+Resolver::~Resolver() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wakeWorkers_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+    if (eventFd_ != -1) close(eventFd_);
+}
+
+bool Resolver::lookupCached(const std::string& hostname, ResolvedHost& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (findOverride(hostname, result)) {
+        ++stats_.cacheHits;
+        return true;
+    }
+    auto it = cache_.find(hostname);
+    if (it == cache_.end()) {
+        ++stats_.cacheMisses;
+        return false;
+    }
+    if (it->second.expires <= Clock::now()) {
+        cache_.erase(it);
+        ++stats_.cacheMisses;
+        return false;
+    }
+
+    ++stats_.cacheHits;
+    result = it->second.result;
+    return true;
+}
+
+void Resolver::resolve(const std::string& hostname, ResolveCallback callback) {
+    ResolvedHost fixed;
+    bool isFixed = parseNumericHost(hostname, fixed);
+    if (!isFixed) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isFixed = findOverride(hostname, fixed);
+    }
+    if (isFixed) {
+        // Literals and overrides never expire, so they go straight into the cache
+        std::lock_guard<std::mutex> lock(mutex_);
+        CacheEntry& entry = cache_[hostname];
+        entry.result = fixed;
+        entry.expires = Clock::time_point::max();
+        done_.emplace_back(hostname, fixed);
+        auto& callbacks = inFlight_[hostname];
+        if (callback) callbacks.push_back(std::move(callback));
+        uint64_t one = 1;
+        if (write(eventFd_, &one, sizeof(one)) < 0) {
+            // Counter saturated; the fd is readable anyway
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = inFlight_.find(hostname);
+        if (it != inFlight_.end()) {
+            if (callback) it->second.push_back(std::move(callback));
+            return;
+        }
+
+        auto& callbacks = inFlight_[hostname];
+        if (callback) callbacks.push_back(std::move(callback));
+        jobs_.push_back(hostname);
+        if (workers_.empty()) startWorkers();
+    }
+    wakeWorkers_.notify_one();
+}
+
+bool Resolver::addOverride(const std::string& hostname, const std::string& address) {
+    ResolvedHost result;
+    for (size_t start = 0; start <= address.size();) {
+        size_t comma = std::min(address.find(',', start), address.size());
+        if (!parseNumericHost(address.substr(start, comma - start), result)) {
+            return false;
+        }
+        start = comma + 1;
+    }
+    if (hostname.empty()) {
+        return false;
+    }
+    std::string key = hostname;
+    for (char& ch : key) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    overrides_[key] = result;
+    return true;
+}
+
+// Exact override for hostname, else the one for its closest "*.suffix".
+// The caller holds mutex_.
+bool Resolver::findOverride(const std::string& hostname, ResolvedHost& result) const {
+    if (overrides_.empty()) {
+        return false;
+    }
+    std::string key = hostname;
+    for (char& ch : key) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+
+    auto it = overrides_.find(key);
+    for (size_t dot = key.find('.'); it == overrides_.end() && dot != std::string::npos; dot = key.find('.', dot + 1)) {
+        it = overrides_.find("*" + key.substr(dot));
+    }
+    if (it == overrides_.end()) {
+        return false;
+    }
+    result = it->second;
+    return true;
+}
+
+void Resolver::prefetch(const std::string& hostname) {
+    if (hostname.empty()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (inFlight_.count(hostname)) return;
+        auto it = cache_.find(hostname);
+        if (it != cache_.end() && it->second.expires > Clock::now()) return;
+        ++stats_.prefetches;
+    }
+    resolve(hostname, nullptr);
+}
+
+size_t Resolver::dispatchCompletions() {
+    uint64_t counter;
+    while (read(eventFd_, &counter, sizeof(counter)) > 0) {
+        // Drain the notification counter
+    }
+
+    std::vector<std::pair<std::string, ResolvedHost>> finished;
+    std::vector<std::vector<ResolveCallback>> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished.swap(done_);
+        for (auto& entry : finished) {
+            auto it = inFlight_.find(entry.first);
+            if (it == inFlight_.end()) {
+                callbacks.emplace_back();
+                continue;
+            }
+            callbacks.push_back(std::move(it->second));
+            inFlight_.erase(it);
+        }
+    }
+
+    for (size_t i = 0; i < finished.size(); ++i) {
+        for (ResolveCallback& callback : callbacks[i]) {
+            callback(finished[i].first, finished[i].second);
+        }
+    }
+    return finished.size();
+}
+
+size_t Resolver::pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return inFlight_.size();
+}
+
+ResolverStats Resolver::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+// Must be called with mutex_ held
+void Resolver::startWorkers() {
+    for (size_t i = 0; i < options_.threads; ++i) {
+        workers_.emplace_back(&Resolver::workerLoop, this);
+    }
+}
+
+// Must be called with mutex_ held
+void Resolver::store(const std::string& hostname, const ResolvedHost& result, int ttlSeconds) {
+    if (cache_.size() >= options_.maxEntries) {
+        // Drop expired entries first, then arbitrary ones, to stay bounded
+        Clock::time_point now = Clock::now();
+        for (auto it = cache_.begin(); it != cache_.end();) {
+            it = it->second.expires <= now ? cache_.erase(it) : std::next(it);
+        }
+        while (cache_.size() >= options_.maxEntries) {
+            cache_.erase(cache_.begin());
+        }
+    }
+
+    CacheEntry& entry = cache_[hostname];
+    entry.result = result;
+    entry.expires = Clock::now() + std::chrono::seconds(std::max(ttlSeconds, MIN_CACHE_TTL_SECONDS));
+}
+
+void Resolver::workerLoop() {
+    struct __res_state state;
+    std::memset(&state, 0, sizeof(state));
+    bool haveState = res_ninit(&state) == 0;
+
+    while (true) {
+        std::string hostname;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeWorkers_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+            if (stopping_) break;
+            hostname = std::move(jobs_.front());
+            jobs_.pop_front();
+            ++stats_.lookups;
+        }
+
+        ResolvedHost result;
+        int ttl = haveState ? queryDns(&state, hostname, options_.ipv6, result) : -1;
+        if (ttl >= 0) {
+            ttl = std::max(options_.minTtlSeconds, std::min(options_.maxTtlSeconds, ttl));
+        } else {
+            result = ResolvedHost{};
+            ttl = querySystem(hostname, options_.ipv6, result) ? options_.defaultTtlSeconds : options_.negativeTtlSeconds;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!result.found) ++stats_.failures;
+            store(hostname, result, ttl);
+            done_.emplace_back(hostname, std::move(result));
+        }
+
+        uint64_t one = 1;
+        if (write(eventFd_, &one, sizeof(one)) < 0) {
+            // Counter saturated; the fd is readable anyway
+        }
+    }
+
+    if (haveState) res_nclose(&state);
+}
@@ -0,0 +1,120 @@
+#ifndef RESOLVER_H
+#define RESOLVER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <sys/socket.h>
+
+// One IPv4 or IPv6 address a hostname resolved to (the port is filled in at connect time)
+struct HostAddress {
+    sockaddr_storage addr{};
+    socklen_t length = 0;
+};
+
+// Outcome of a hostname lookup
+struct ResolvedHost {
+    bool found = false;               // False for NXDOMAIN / lookup failure (cached negatively)
+    std::vector<HostAddress> addresses;
+};
+
+// Callback invoked from dispatchCompletions() once a lookup finishes
+using ResolveCallback = std::function<void(const std::string& hostname, const ResolvedHost& result)>;
+
+// Tunables for a Resolver
+struct ResolverOptions {
+    size_t threads = 8;            // Concurrent blocking lookups
+    int minTtlSeconds = 30;        // Floor for record TTLs, so hot hosts are not re-resolved constantly (at least 1 s applies)
+    int maxTtlSeconds = 3600;      // Ceiling for record TTLs
+    int defaultTtlSeconds = 300;   // TTL when the answer did not come from DNS (e.g. /etc/hosts)
+    int negativeTtlSeconds = 60;   // How long failed lookups are remembered
+    size_t maxEntries = 100000;    // Cached hostnames before expired / old entries are dropped
+    bool ipv6 = true;              // Also ask for AAAA records
+};
+
+// Lookup counters
+struct ResolverStats {
+    unsigned long cacheHits = 0;
+    unsigned long cacheMisses = 0;
+    unsigned long lookups = 0;     // Lookups actually sent to the system resolver
+    unsigned long failures = 0;
+    unsigned long prefetches = 0;
+};
+
+// Caching asynchronous DNS resolver. Lookups run on a small pool of worker
+// threads; answers are cached for their DNS TTL (failures for a short
+// negative TTL) so a crawl resolves each host roughly once.
+//
+// The owner thread polls notifyFd() (e.g. in its epoll set) and calls
+// dispatchCompletions() to run the callbacks of finished lookups.
+class Resolver {
+public:
+    explicit Resolver(const ResolverOptions& options = ResolverOptions());
+    ~Resolver();
+
+    Resolver(const Resolver&) = delete;
+    Resolver& operator=(const Resolver&) = delete;
+
+    // Fresh cached answer for hostname, if any. Never blocks on the network.
+    bool lookupCached(const std::string& hostname, ResolvedHost& result);
+
+    // Resolve hostname in the background; callback runs from dispatchCompletions().
+    // Lookups for a host already being resolved are merged into one.
+    void resolve(const std::string& hostname, ResolveCallback callback);
+
+    // Warm the cache for a host that is likely to be fetched soon
+    void prefetch(const std::string& hostname);
+
+    // Answer hostname with fixed addresses instead of asking DNS (like an
+    // /etc/hosts entry). address is an IPv4 or IPv6 literal, or several
+    // separated by commas; "*.example.com" covers every subdomain.
+    // Returns false if any of them is not a literal.
+    bool addOverride(const std::string& hostname, const std::string& address);
+
+    // Becomes readable while finished lookups wait for dispatchCompletions()
+    int notifyFd() const { return eventFd_; }
+
+    // Run the callbacks of finished lookups; returns how many hosts completed
+    size_t dispatchCompletions();
+
+    // Lookups queued or running
+    size_t pending() const;
+
+    ResolverStats stats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct CacheEntry {
+        ResolvedHost result;
+        Clock::time_point expires;
+    };
+
+    void startWorkers();
+    void workerLoop();
+    void store(const std::string& hostname, const ResolvedHost& result, int ttlSeconds);
+    bool findOverride(const std::string& hostname, ResolvedHost& result) const;
+
+    ResolverOptions options_;
+    int eventFd_;
+    mutable std::mutex mutex_;
+    std::condition_variable wakeWorkers_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+    std::deque<std::string> jobs_;
+    std::vector<std::pair<std::string, ResolvedHost>> done_;
+    std::unordered_map<std::string, std::vector<ResolveCallback>> inFlight_;
+    std::unordered_map<std::string, CacheEntry> cache_;
+    std::unordered_map<std::string, ResolvedHost> overrides_; // Keyed by lowercase name or "*.suffix"
+    ResolverStats stats_;
+};
+
+#endif // RESOLVER_H
@@ -0,0 +1,274 @@
+#include "robots.h"
+#include "url.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+
+// Helper function to lowercase a string in place
+static void lowercase(std::string& text) {
+    for (char& ch : text) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+}
+
+// Helper function to trim spaces and tabs from both ends
+static std::string trim(const std::string& text) {
+    size_t start = text.find_first_not_of(" \t");
+    if (start == std::string::npos) return "";
+    size_t end = text.find_last_not_of(" \t");
+    return text.substr(start, end - start + 1);
+}
+
+// Helper function to reduce a user agent to its lowercase product token ("MyBot/2.1" -> "mybot")
+static std::string productToken(const std::string& userAgent) {
+    std::string token = trim(userAgent);
+    token = token.substr(0, token.find_first_of("/ \t"));
+    lowercase(token);
+    return token;
+}
+
+// Helper function to split a URL into its lowercase scheme://host[:port]
+// and the path with query it is requested with
+static bool splitUrl(const std::string& url, std::string& hostKey, std::string& pathAndQuery) {
+    UrlParts parts;
+    if (!parseUrl(url, parts) || parts.scheme.empty()) return false;
+
+    hostKey.assign(parts.scheme).append("://").append(parts.host);
+    if (!parts.port.empty()) hostKey.append(":").append(parts.port);
+    lowercase(hostKey);
+
+    pathAndQuery.clear();
+    appendRequestTarget(parts, pathAndQuery);
+    return true;
+}
+
+RobotsRules RobotsRules::parse(const std::string& content, const std::string& userAgent) {
+    const std::string agent = productToken(userAgent);
+
+    // Rules of the groups naming our agent, and of the "*" groups as a fallback
+    RobotsRules specific;
+    RobotsRules wildcard;
+    bool specificSeen = false;
+
+    bool groupForUs = false;
+    bool groupForAll = false;
+    bool inRules = false; // A rule line ended the run of User-agent lines
+
+    std::istringstream stream(content.size() > ROBOTS_MAX_SIZE ? content.substr(0, ROBOTS_MAX_SIZE) : content);
+    std::string line;
+    bool firstLine = true;
+    while (std::getline(stream, line)) {
+        if (firstLine && line.compare(0, 3, "\xEF\xBB\xBF") == 0) line.erase(0, 3);
+        firstLine = false;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) continue;
+
+        std::string key = trim(line.substr(0, colon));
+        std::string value = trim(line.substr(colon + 1));
+        lowercase(key);
+
+        if (key == "user-agent") {
+            if (inRules) {
+                groupForUs = groupForAll = false;
+                inRules = false;
+            }
+            std::string name = productToken(value);
+            if (name == "*") {
+                groupForAll = true;
+            } else if (!name.empty() && name == agent) {
+                groupForUs = true;
+                specificSeen = true;
+            }
+            continue;
+        }
+
+        bool rule = key == "allow" || key == "disallow";
+        if (!rule && key != "crawl-delay") continue; // Sitemap and unknown lines
+        inRules = true;
+        if (!groupForUs && !groupForAll) continue;
+        RobotsRules& target = groupForUs ? specific : wildcard;
+
+        if (rule) {
+            target.addRule(value, key == "allow");
+        } else {
+            char* end = nullptr;
+            double delay = std::strtod(value.c_str(), &end);
+            if (end != value.c_str() && delay > 0) target.crawlDelay_ = delay;
+        }
+    }
+
+    RobotsRules& result = specificSeen ? specific : wildcard;
+    std::stable_sort(result.rules_.begin(), result.rules_.end(), [](const Rule& a, const Rule& b) {
+        if (a.specificity != b.specificity) return a.specificity > b.specificity;
+        return a.allow && !b.allow;
+    });
+    return result;
+}
+
+RobotsRules RobotsRules::disallowAll() {
+    RobotsRules rules;
+    rules.addRule("/", false);
+    return rules;
+}
+
+// Compile one Allow / Disallow pattern into its literal pieces
+void RobotsRules::addRule(const std::string& pattern, bool allow) {
+    if (pattern.empty()) {
+        return; // "Disallow:" with no path allows everything
+    }
+
+    Rule rule;
+    rule.allow = allow;
+    rule.specificity = pattern.size();
+
+    std::string text = pattern;
+    if (text.back() == '$') {
+        rule.anchored = true;
+        text.pop_back();
+    }
+    if (text.empty() || (text[0] != '/' && text[0] != '*')) {
+        text.insert(0, "/");
+    }
+
+    size_t start = 0;
+    while (true) {
+        size_t star = text.find('*', start);
+        std::string piece = text.substr(start, star == std::string::npos ? std::string::npos : star - start);
+        // Runs of '*' collapse; the first piece is kept even when empty as it anchors the start
+        if (!piece.empty() || rule.pieces.empty() || star == std::string::npos) {
+            rule.pieces.push_back(piece);
+        }
+        if (star == std::string::npos) break;
+        start = star + 1;
+    }
+    rules_.push_back(std::move(rule));
+}
+
+// Match a compiled pattern: the first piece is a prefix, the others are found
+// left to right, and an anchored pattern must end exactly at the last piece
+bool RobotsRules::matches(const Rule& rule, const std::string& path) {
+    const std::vector<std::string>& pieces = rule.pieces;
+    if (path.compare(0, pieces[0].size(), pieces[0]) != 0) {
+        return false;
+    }
+    size_t pos = pieces[0].size();
+    if (pieces.size() == 1) {
+        return !rule.anchored || pos == path.size();
+    }
+
+    for (size_t i = 1; i + 1 < pieces.size(); ++i) {
+        pos = path.find(pieces[i], pos);
+        if (pos == std::string::npos) return false;
+        pos += pieces[i].size();
+    }
+
+    const std::string& last = pieces.back();
+    if (rule.anchored) {
+        return path.size() >= pos + last.size() &&
+               path.compare(path.size() - last.size(), last.size(), last) == 0;
+    }
+    return path.find(last, pos) != std::string::npos;
+}
+
+bool RobotsRules::allowed(const std::string& pathAndQuery) const {
+    if (pathAndQuery == "/robots.txt") {
+        return true;
+    }
+    for (const Rule& rule : rules_) {
+        if (matches(rule, pathAndQuery)) {
+            return rule.allow;
+        }
+    }
+    return true;
+}
+
+RobotsCache::RobotsCache(const std::string& userAgent) : agent_(productToken(userAgent)) {}
+
+std::string RobotsCache::robotsUrlFor(const std::string& url) {
+    std::string hostKey, path;
+    if (!splitUrl(url, hostKey, path)) {
+        return "";
+    }
+    return hostKey + "/robots.txt";
+}
+
+RobotsVerdict RobotsCache::check(const std::string& url, std::string& robotsUrl, Clock::time_point now) {
+    robotsUrl.clear();
+    std::string hostKey, path;
+    if (!splitUrl(url, hostKey, path)) {
+        return RobotsVerdict::Allowed; // Leave malformed URLs to the fetch to reject
+    }
+
+    HostRules& host = hosts_[hostKey];
+    if (host.known && now < host.expires) {
+        if (host.rules.allowed(path)) {
+            ++stats_.allowed;
+            return RobotsVerdict::Allowed;
+        }
+        ++stats_.disallowed;
+        return RobotsVerdict::Disallowed;
+    }
+
+    host.parked.push_back(url);
+    ++stats_.parked;
+    if (!host.fetching) {
+        host.fetching = true;
+        robotsUrl = hostKey + "/robots.txt";
+    }
+    return RobotsVerdict::Pending;
+}
+
+std::vector<std::string> RobotsCache::store(const std::string& robotsUrl, const Response& response, Clock::time_point now) {
+    std::string hostKey, path;
+    if (!splitUrl(robotsUrl, hostKey, path)) {
+        return {};
+    }
+
+    HostRules& host = hosts_[hostKey];
+    host.fetching = false;
+    host.known = true;
+    host.expires = now + std::chrono::seconds(ROBOTS_TTL_SECONDS);
+    ++stats_.fetched;
+
+    int status = response.header.status;
+    bool unreachable = (response.error != FetchError::None && response.error != FetchError::Redirect &&
+                        response.error != FetchError::Rejected) || status >= 500;
+    if (unreachable) {
+        // RFC 9309: assume a complete disallow until robots.txt can be read
+        host.rules = RobotsRules::disallowAll();
+        host.expires = now + std::chrono::seconds(ROBOTS_ERROR_TTL_SECONDS);
+    } else if (response.error == FetchError::None && status >= 200 && status < 300) {
+        host.rules = RobotsRules::parse(response.body, agent_);
+    } else {
+        // Missing (4xx), too many redirects or refused: no restrictions
+        host.rules = RobotsRules();
+    }
+
+    std::vector<std::string> released;
+    for (std::string& url : host.parked) {
+        std::string parkedHost, parkedPath;
+        splitUrl(url, parkedHost, parkedPath);
+        if (host.rules.allowed(parkedPath)) {
+            ++stats_.allowed;
+            released.push_back(std::move(url));
+        } else {
+            ++stats_.disallowed;
+        }
+    }
+    host.parked.clear();
+    host.parked.shrink_to_fit();
+    return released;
+}
+
+const RobotsRules* RobotsCache::rulesFor(const std::string& url) const {
+    std::string hostKey, path;
+    if (!splitUrl(url, hostKey, path)) {
+        return nullptr;
+    }
+    auto it = hosts_.find(hostKey);
+    return it != hosts_.end() && it->second.known ? &it->second.rules : nullptr;
+}
@@ -0,0 +1,112 @@
+#ifndef ROBOTS_H
+#define ROBOTS_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "downloader.h"
+
+// How long fetched rules stay valid (RFC 9309 asks for at most 24 hours)
+#define ROBOTS_TTL_SECONDS (24 * 60 * 60)
+// How long an unreachable robots.txt blocks its host before it is tried again
+#define ROBOTS_ERROR_TTL_SECONDS (10 * 60)
+// Largest robots.txt body that is parsed (RFC 9309 section 2.5)
+#define ROBOTS_MAX_SIZE (500 * 1024)
+
+// Allow / Disallow rules from one robots.txt, compiled for the groups that
+// apply to one user agent. Each pattern is split at its '*' wildcards into
+// literal pieces once, and the rules are ordered so the first that matches
+// is also the most specific one; checking a URL never builds a regex.
+class RobotsRules {
+public:
+    // Rules that allow everything (no robots.txt, or a 4xx for it)
+    RobotsRules() = default;
+
+    // Parse robots.txt content for userAgent's product token (e.g. "mybot").
+    // Groups naming the token win over "*"; unknown lines are ignored.
+    static RobotsRules parse(const std::string& content, const std::string& userAgent);
+
+    // Rules that refuse everything (robots.txt unreachable)
+    static RobotsRules disallowAll();
+
+    // Check a path with its query ("/a/b?c=d") against the rules
+    bool allowed(const std::string& pathAndQuery) const;
+
+    // Crawl-delay from the matching group, in seconds (0 if none)
+    double crawlDelay() const { return crawlDelay_; }
+    size_t ruleCount() const { return rules_.size(); }
+
+private:
+    struct Rule {
+        std::vector<std::string> pieces; // Literal text between the '*' wildcards
+        bool anchored = false;           // Pattern ended in '$'
+        bool allow = false;
+        size_t specificity = 0;          // Pattern length; the longest match wins
+    };
+
+    static bool matches(const Rule& rule, const std::string& path);
+    void addRule(const std::string& pattern, bool allow);
+
+    std::vector<Rule> rules_; // Most specific first, Allow ahead of Disallow on ties
+    double crawlDelay_ = 0;
+};
+
+// What the crawl may do with a URL right now
+enum class RobotsVerdict {
+    Allowed,
+    Disallowed,
+    Pending  // Rules for the host are not known yet; the URL was parked
+};
+
+// Counters for a RobotsCache
+struct RobotsStats {
+    unsigned long fetched = 0;    // robots.txt responses stored
+    unsigned long allowed = 0;
+    unsigned long disallowed = 0;
+    unsigned long parked = 0;     // URLs that waited for their host's robots.txt
+};
+
+// Compiled robots.txt rules shared by every URL of a host (scheme://host[:port]),
+// kept until they expire. URLs of a host whose rules are missing or stale are
+// parked while its robots.txt is fetched once, then released or dropped.
+class RobotsCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // userAgent as sent in requests ("name/version"); its name picks the robots.txt group
+    explicit RobotsCache(const std::string& userAgent);
+
+    // Decide on url. Pending means the URL was parked; if robotsUrl is set
+    // on return, the caller should fetch it and pass the response to store().
+    RobotsVerdict check(const std::string& url, std::string& robotsUrl, Clock::time_point now = Clock::now());
+
+    // Compile a fetched robots.txt and return the parked URLs of its host that are allowed
+    std::vector<std::string> store(const std::string& robotsUrl, const Response& response, Clock::time_point now = Clock::now());
+
+    // Rules for the host of url, if they are known
+    const RobotsRules* rulesFor(const std::string& url) const;
+
+    // robots.txt URL for the host of url ("" for a URL without scheme://host)
+    static std::string robotsUrlFor(const std::string& url);
+
+    size_t hosts() const { return hosts_.size(); }
+    const RobotsStats& stats() const { return stats_; }
+
+private:
+    struct HostRules {
+        RobotsRules rules;
+        Clock::time_point expires;
+        bool known = false;                 // rules came from a finished fetch
+        bool fetching = false;              // robots.txt requested, not stored yet
+        std::vector<std::string> parked;    // URLs waiting for the rules
+    };
+
+    std::string agent_; // Lowercase product token
+    std::unordered_map<std::string, HostRules> hosts_; // Keyed by scheme://host[:port]
+    RobotsStats stats_;
+};
+
+#endif // ROBOTS_H
@@ -0,0 +1,521 @@
+#include "local_server.h"
+
+#include <cctype>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+#include <zlib.h>
+
+// Largest request header accepted before the connection is dropped
+#define MAX_REQUEST_SIZE (64 * 1024)
+#define LISTEN_BACKLOG 1024
+
+// Words that page text is drawn from
+static const char* const VOCABULARY[] = {
+    "search", "engine", "crawler", "index", "query", "document", "network", "server",
+    "client", "request", "response", "header", "content", "page", "link", "anchor",
+    "parser", "token", "stream", "buffer", "socket", "thread", "cache", "memory",
+    "latency", "throughput", "bandwidth", "protocol", "secure", "session", "handshake", "certificate",
+    "compress", "decode", "encode", "entity", "market", "garden", "river", "mountain",
+    "history", "science", "music", "travel", "kitchen", "weather", "library", "museum",
+    "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "morning",
+    "evening", "winter", "summer", "autumn", "spring", "ocean", "forest", "desert",
+};
+static const size_t VOCABULARY_SIZE = sizeof(VOCABULARY) / sizeof(VOCABULARY[0]);
+
+// Helper function for the splitmix64 finalizer, a cheap well-mixed hash
+static uint64_t mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Helper function to parse the N of "<prefix>N<suffix>"; returns false if text has another shape
+static bool parseNumbered(const std::string& text, const std::string& prefix, const std::string& suffix, size_t& number) {
+    if (text.size() <= prefix.size() + suffix.size() || text.compare(0, prefix.size(), prefix) != 0 ||
+        text.compare(text.size() - suffix.size(), suffix.size(), suffix) != 0) {
+        return false;
+    }
+    number = 0;
+    for (size_t i = prefix.size(); i < text.size() - suffix.size(); ++i) {
+        if (!std::isdigit(static_cast<unsigned char>(text[i])) || number > 1000000000) return false;
+        number = number * 10 + (text[i] - '0');
+    }
+    return true;
+}
+
+// Helper function to name a status code for the status line
+static const char* reasonPhrase(int status) {
+    switch (status) {
+        case 200: return "OK";
+        case 301: return "Moved Permanently";
+        case 302: return "Found";
+        case 304: return "Not Modified";
+        case 404: return "Not Found";
+        case 500: return "Internal Server Error";
+        default: return "Unknown";
+    }
+}
+
+SyntheticWeb::SyntheticWeb(const SyntheticWebOptions& options) : options_(options) {
+    if (options_.hosts == 0) options_.hosts = 1;
+    if (options_.pagesPerHost == 0) options_.pagesPerHost = 1;
+}
+
+std::string SyntheticWeb::hostName(size_t index) {
+    return "site" + std::to_string(index) + ".test";
+}
+
+uint64_t SyntheticWeb::hash(uint64_t host, uint64_t page, uint64_t salt) const {
+    return mix(options_.seed ^ mix(host ^ mix(page ^ mix(salt))));
+}
+
+// Uniform value in [0, 1) for a page and purpose
+double SyntheticWeb::chance(uint64_t host, uint64_t page, uint64_t salt) const {
+    return static_cast<double>(hash(host, page, salt) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Helper function to build an absolute link on the given virtual host
+static std::string link(size_t host, const std::string& path, const std::string& scheme, uint16_t port) {
+    return scheme + "://" + SyntheticWeb::hostName(host) + ":" + std::to_string(port) + path;
+}
+
+std::string SyntheticWeb::index(size_t host, const std::string& scheme, uint16_t port) const {
+    std::string html = "<!DOCTYPE html>\n<html><head><title>" + hostName(host) + "</title></head><body>\n";
+    html += "<h1>Welcome to " + hostName(host) + "</h1>\n";
+    html += "<a href=\"" + link(host, "/page/0.html", scheme, port) + "\">first page</a>\n";
+    html += "<a href=\"" + link((host + 1) % options_.hosts, "/", scheme, port) + "\">next site</a>\n";
+    html += "</body></html>\n";
+    return html;
+}
+
+std::string SyntheticWeb::page(size_t host, size_t number, const std::string& scheme, uint16_t port) const {
+    std::string html;
+    html.reserve(options_.pageBytes + 512);
+    html += "<!DOCTYPE html>\n<html><head><title>" + hostName(host) + " page " + std::to_string(number) + "</title></head><body>\n";
+    html += "<h1>Page " + std::to_string(number) + "</h1>\n";
+
+    size_t next = (number + 1) % options_.pagesPerHost;
+    html += "<a href=\"" + link(host, "/page/" + std::to_string(next) + ".html", scheme, port) + "\">next</a>\n";
+    for (size_t i = 0; i < options_.linksPerPage; ++i) {
+        size_t targetHost = host;
+        if (options_.hosts > 1 && chance(host, number, 100 + i) < options_.crossHostLinks) {
+            targetHost = hash(host, number, 200 + i) % options_.hosts;
+        }
+        size_t targetPage = hash(host, number, 300 + i) % options_.pagesPerHost;
+        html += "<a href=\"" + link(targetHost, "/page/" + std::to_string(targetPage) + ".html", scheme, port) + "\">" +
+                VOCABULARY[hash(host, number, 400 + i) % VOCABULARY_SIZE] + "</a>\n";
+    }
+
+    // Fill up to the requested size with paragraphs of words
+    uint64_t state = hash(host, number, 500);
+    while (html.size() < options_.pageBytes) {
+        html += "<p>";
+        for (int word = 0; word < 12; ++word) {
+            state = mix(state);
+            if (word > 0) html += ' ';
+            html += VOCABULARY[state % VOCABULARY_SIZE];
+        }
+        html += ".</p>\n";
+    }
+    html += "</body></html>\n";
+    return html;
+}
+
+// Helper function to gzip BOMB_SIZE zero bytes, once, a block at a time so
+// the server never holds the inflated size itself
+static const std::string& gzipBomb() {
+    static const std::string bomb = [] {
+        std::string zeros(64 * 1024, '\0');
+        std::string out;
+        char buffer[16 * 1024];
+        z_stream stream{};
+        deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+        for (size_t fed = 0; fed < BOMB_SIZE; fed += zeros.size()) {
+            int flush = fed + zeros.size() < BOMB_SIZE ? Z_NO_FLUSH : Z_FINISH;
+            stream.next_in = reinterpret_cast<Bytef*>(&zeros[0]);
+            stream.avail_in = zeros.size();
+            do {
+                stream.next_out = reinterpret_cast<Bytef*>(buffer);
+                stream.avail_out = sizeof(buffer);
+                deflate(&stream, flush);
+                out.append(buffer, sizeof(buffer) - stream.avail_out);
+            } while (stream.avail_out == 0);
+        }
+        deflateEnd(&stream);
+        return out;
+    }();
+    return bomb;
+}
+
+SyntheticResponse SyntheticWeb::respond(const std::string& host, const std::string& path,
+                                        const std::string& scheme, uint16_t port) const {
+    SyntheticResponse response;
+    size_t hostIndex = 0;
+    std::string name = host;
+    for (char& ch : name) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    if (!parseNumbered(name, "site", ".test", hostIndex) || hostIndex >= options_.hosts) {
+        hostIndex = 0;
+    }
+
+    std::string target = path.substr(0, path.find('?'));
+    size_t number = 0;
+    if (target.empty() || target == "/") {
+        response.body = index(hostIndex, scheme, port);
+    } else if (target == "/redirect") {
+        response.status = 302;
+        response.location = "/";
+    } else if (target == "/tarpit/stall") {
+        response.stall = true;
+    } else if (target == "/unchanged") {
+        response.status = 304;
+        response.declaredLength = LARGE_DECLARED_LENGTH;
+    } else if (target == "/moved-large") {
+        response.status = 301;
+        response.location = "/";
+        response.body = "<html><body>Moved</body></html>\n";
+        response.declaredLength = LARGE_DECLARED_LENGTH;
+    } else if (target == "/notes.txt") {
+        response.contentType = "text/plain";
+        response.body = "Plain text\n";
+    } else if (target == "/bomb") {
+        response.contentEncoding = "gzip";
+        response.body = gzipBomb();
+    } else if (target == "/interim") {
+        response.body = "<html><body>After continue</body></html>\n";
+        response.interim = true;
+    } else if (target == "/tarpit/trickle") {
+        response.body = "<html><body>Slow</body></html>\n";
+        response.trickleMs = TARPIT_TRICKLE_MS;
+    } else if (parseNumbered(target, "/page/", ".html", number) && number < options_.pagesPerHost) {
+        if (chance(hostIndex, number, 1) < options_.errorRate) {
+            response.status = 500;
+            response.body = "<html><body>Internal error</body></html>\n";
+        } else if (chance(hostIndex, number, 2) < options_.redirectRate) {
+            response.status = 301;
+            response.location = link(hostIndex, "/moved/" + std::to_string(number) + ".html", scheme, port);
+        } else {
+            response.body = page(hostIndex, number, scheme, port);
+        }
+    } else if (parseNumbered(target, "/moved/", ".html", number) && number < options_.pagesPerHost) {
+        response.body = page(hostIndex, number, scheme, port);
+    } else {
+        response.status = 404;
+        response.body = "<html><body>Not found</body></html>\n";
+    }
+    return response;
+}
+
+LocalServer::LocalServer(const SyntheticWebOptions& web, const LocalServerOptions& options)
+    : web_(web), options_(options) {}
+
+LocalServer::~LocalServer() {
+    stop();
+}
+
+// Bind a listening socket on 127.0.0.1; boundPort receives the actual port
+int LocalServer::listen(uint16_t port, uint16_t& boundPort) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd == -1) {
+        std::cerr << "socket: " << std::strerror(errno) << std::endl;
+        return -1;
+    }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(addr);
+    if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(fd, LISTEN_BACKLOG) != 0 ||
+        getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &length) != 0) {
+        std::cerr << "Failed to listen on port " << port << ": " << std::strerror(errno) << std::endl;
+        close(fd);
+        return -1;
+    }
+    boundPort = ntohs(addr.sin_port);
+    return fd;
+}
+
+// Create the server context with a fresh self-signed certificate, so no key
+// material has to live in the repository
+bool LocalServer::setUpTls() {
+    EVP_PKEY* key = EVP_EC_gen("P-256");
+    X509* cert = X509_new();
+    SSL_CTX* ctx = SSL_CTX_new(TLS_server_method());
+    bool ok = key && cert && ctx;
+
+    if (ok) {
+        X509_set_version(cert, 2);
+        ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+        X509_gmtime_adj(X509_getm_notBefore(cert), -3600);
+        X509_gmtime_adj(X509_getm_notAfter(cert), 7 * 24 * 3600);
+        X509_set_pubkey(cert, key);
+        X509_NAME* name = X509_get_subject_name(cert);
+        X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+        X509_set_issuer_name(cert, name);
+
+        X509V3_CTX v3;
+        X509V3_set_ctx(&v3, cert, cert, nullptr, nullptr, 0);
+        X509_EXTENSION* san = X509V3_EXT_conf_nid(nullptr, &v3, NID_subject_alt_name,
+                                                  "DNS:localhost,DNS:*.test,IP:127.0.0.1");
+        ok = san && X509_add_ext(cert, san, -1) == 1;
+        X509_EXTENSION_free(san);
+
+        ok = ok && X509_sign(cert, key, EVP_sha256()) > 0 && SSL_CTX_use_certificate(ctx, cert) == 1 &&
+             SSL_CTX_use_PrivateKey(ctx, key) == 1;
+    }
+
+    X509_free(cert);
+    EVP_PKEY_free(key);
+    if (!ok) {
+        std::cerr << "Failed to create the TLS certificate" << std::endl;
+        SSL_CTX_free(ctx);
+        return false;
+    }
+    tls_ = ctx;
+    return true;
+}
+
+bool LocalServer::start() {
+    if (running_) return true;
+    std::signal(SIGPIPE, SIG_IGN);
+
+    httpFd_ = listen(options_.httpPort, httpPort_);
+    if (httpFd_ == -1) return false;
+    if (options_.https) {
+        httpsFd_ = setUpTls() ? listen(options_.httpsPort, httpsPort_) : -1;
+        if (httpsFd_ == -1) {
+            close(httpFd_);
+            httpFd_ = -1;
+            return false;
+        }
+    }
+
+    stopFd_ = eventfd(0, EFD_CLOEXEC);
+    running_ = true;
+    acceptor_ = std::thread(&LocalServer::acceptLoop, this);
+    return true;
+}
+
+void LocalServer::stop() {
+    if (!running_) return;
+    running_ = false;
+
+    uint64_t one = 1;
+    if (write(stopFd_, &one, sizeof(one)) < 0) {
+        // The accept loop also sees running_ on its next wakeup
+    }
+    acceptor_.join();
+    close(httpFd_);
+    if (httpsFd_ != -1) close(httpsFd_);
+    close(stopFd_);
+    httpFd_ = httpsFd_ = stopFd_ = -1;
+
+    // Wake connection threads blocked in reads, then wait for them to finish
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (int fd : open_) shutdown(fd, SHUT_RDWR);
+    drained_.wait(lock, [this] { return active_ == 0; });
+    lock.unlock();
+
+    SSL_CTX_free(tls_);
+    tls_ = nullptr;
+}
+
+void LocalServer::acceptLoop() {
+    pollfd fds[3] = {{stopFd_, POLLIN, 0}, {httpFd_, POLLIN, 0}, {httpsFd_, POLLIN, 0}};
+    nfds_t count = httpsFd_ == -1 ? 2 : 3;
+
+    while (running_) {
+        if (poll(fds, count, -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        if (fds[0].revents) break;
+
+        for (nfds_t i = 1; i < count; ++i) {
+            if (!(fds[i].revents & POLLIN)) continue;
+            int fd = accept4(fds[i].fd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (fd == -1) continue;
+
+            bool https = fds[i].fd == httpsFd_;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++active_;
+                ++stats_.connections;
+                open_.insert(fd);
+            }
+            std::thread([this, fd, https] {
+                serve(fd, https);
+                std::lock_guard<std::mutex> lock(mutex_);
+                open_.erase(fd);
+                close(fd);
+                --active_;
+                drained_.notify_all();
+            }).detach();
+        }
+    }
+}
+
+// Answer requests on one connection until the client or the server ends it
+void LocalServer::serve(int fd, bool https) {
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    SSL* ssl = nullptr;
+    if (https) {
+        ssl = SSL_new(tls_);
+        if (!ssl) return;
+        SSL_set_fd(ssl, fd);
+        if (SSL_accept(ssl) != 1) {
+            SSL_free(ssl);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.tlsHandshakes;
+    }
+
+    auto readSome = [&](char* buffer, size_t size) -> ssize_t {
+        return ssl ? SSL_read(ssl, buffer, static_cast<int>(size)) : recv(fd, buffer, size, 0);
+    };
+    auto writeAll = [&](const std::string& data) -> bool {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            ssize_t n = ssl ? SSL_write(ssl, data.data() + sent, static_cast<int>(data.size() - sent))
+                            : send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) return false;
+            sent += n;
+        }
+        return true;
+    };
+
+    const std::string scheme = https ? "https" : "http";
+    const uint16_t port = https ? httpsPort_ : httpPort_;
+    std::string pending;
+    char buffer[16384];
+    size_t served = 0;
+
+    while (running_) {
+        size_t headerEnd;
+        while ((headerEnd = pending.find("\r\n\r\n")) == std::string::npos) {
+            if (pending.size() > MAX_REQUEST_SIZE) break;
+            ssize_t n = readSome(buffer, sizeof(buffer));
+            if (n <= 0) break;
+            pending.append(buffer, n);
+        }
+        if (headerEnd == std::string::npos) break;
+
+        // Request line and the two headers that matter here
+        std::string head = pending.substr(0, headerEnd + 2);
+        pending.erase(0, headerEnd + 4);
+        size_t lineEnd = head.find("\r\n");
+        std::string requestLine = head.substr(0, lineEnd);
+        size_t firstSpace = requestLine.find(' ');
+        size_t secondSpace = requestLine.find(' ', firstSpace + 1);
+        if (firstSpace == std::string::npos || secondSpace == std::string::npos) break;
+        std::string method = requestLine.substr(0, firstSpace);
+        std::string target = requestLine.substr(firstSpace + 1, secondSpace - firstSpace - 1);
+        bool http10 = requestLine.compare(secondSpace + 1, std::string::npos, "HTTP/1.0") == 0;
+
+        std::string host;
+        bool clientClose = http10;
+        for (size_t start = lineEnd + 2; start < head.size();) {
+            size_t end = head.find("\r\n", start);
+            std::string line = head.substr(start, end - start);
+            start = end + 2;
+            size_t colon = line.find(':');
+            if (colon == std::string::npos) continue;
+            std::string name = line.substr(0, colon);
+            for (char& ch : name) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+            std::string value = line.substr(colon + 1);
+            value.erase(0, value.find_first_not_of(" \t"));
+            if (name == "host") {
+                host = value.substr(0, value.rfind(':') == std::string::npos ? value.size() : value.rfind(':'));
+            } else if (name == "connection") {
+                for (char& ch : value) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+                clientClose = value.find("close") != std::string::npos ||
+                              (http10 && value.find("keep-alive") == std::string::npos);
+            }
+        }
+        if (host.empty() && ssl) {
+            const char* sni = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+            if (sni) host = sni;
+        }
+        size_t schemeEnd = target.find("://");
+        if (schemeEnd != std::string::npos) {
+            size_t pathStart = target.find('/', schemeEnd + 3);
+            target = pathStart == std::string::npos ? "/" : target.substr(pathStart);
+        }
+
+        if (web_.options().latencyMs > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(web_.options().latencyMs));
+        }
+        SyntheticResponse response = web_.respond(host, target, scheme, port);
+        if (response.stall) {
+            // Hold the connection until the client gives up or the server stops
+            while (readSome(buffer, sizeof(buffer)) > 0) {}
+            break;
+        }
+        ++served;
+        bool closing = clientClose || !running_ ||
+                       (options_.maxRequestsPerConnection > 0 && served >= options_.maxRequestsPerConnection);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++stats_.requests;
+            if (response.status >= 400) ++stats_.errors;
+        }
+
+        std::string out = "HTTP/1.1 " + std::to_string(response.status) + " " + reasonPhrase(response.status) + "\r\n";
+        out += "Content-Type: " + response.contentType + "\r\n";
+        long long length = response.declaredLength >= 0 ? response.declaredLength : static_cast<long long>(response.body.size());
+        out += "Content-Length: " + std::to_string(length) + "\r\n";
+        if (!response.location.empty()) out += "Location: " + response.location + "\r\n";
+        if (!response.contentEncoding.empty()) out += "Content-Encoding: " + response.contentEncoding + "\r\n";
+        if (closing) out += "Connection: close\r\n";
+        out += "\r\n";
+        if (method != "HEAD") out += response.body;
+        if (response.interim) {
+            // The client must keep the half header it read after the interim one
+            size_t split = out.find("\r\n") + 2;
+            if (!writeAll("HTTP/1.1 100 Continue\r\n\r\n" + out.substr(0, split))) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            out.erase(0, split);
+        }
+        if (response.trickleMs > 0) {
+            size_t sent = 0;
+            while (running_ && sent < out.size() && writeAll(out.substr(sent, 1))) {
+                ++sent;
+                std::this_thread::sleep_for(std::chrono::milliseconds(response.trickleMs));
+            }
+            break;
+        }
+        if (!writeAll(out) || closing) break;
+    }
+
+    if (ssl) {
+        SSL_shutdown(ssl);
+        SSL_free(ssl);
+    }
+}
+
+std::string LocalServer::url(bool https, const std::string& host, const std::string& path) const {
+    return std::string(https ? "https://" : "http://") + host + ":" +
+           std::to_string(https ? httpsPort_ : httpPort_) + path;
+}
+
+LocalServerStats LocalServer::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
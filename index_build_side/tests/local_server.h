@@ -0,0 +1,153 @@
+#ifndef LOCAL_SERVER_H
+#define LOCAL_SERVER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+struct ssl_ctx_st;
+
+// Gap between the bytes of /tarpit/trickle
+#define TARPIT_TRICKLE_MS 100
+// Content-Length declared by /unchanged and /moved-large
+#define LARGE_DECLARED_LENGTH (64LL * 1024 * 1024)
+// Inflated size of /bomb, which is sent gzipped in well under 100 KB
+#define BOMB_SIZE (64 * 1024 * 1024)
+
+// Shape of a generated web. Every page is derived from the seed, so the same
+// options always give the same pages, links and failures.
+struct SyntheticWebOptions {
+    size_t hosts = 4;            // site0.test, site1.test, ...
+    size_t pagesPerHost = 100;   // /page/0.html ... on each host
+    size_t pageBytes = 8192;     // Approximate size of a page
+    size_t linksPerPage = 8;     // Links on each page besides the "next page" link
+    double crossHostLinks = 0.2; // Share of links that point at another host
+    double redirectRate = 0.0;   // Share of pages answering 301 to /moved/N.html
+    double errorRate = 0.0;      // Share of pages answering 500
+    int latencyMs = 0;           // Delay before every response
+    uint64_t seed = 1;
+};
+
+// One generated answer
+struct SyntheticResponse {
+    int status = 200;
+    std::string contentType = "text/html";
+    std::string location;
+    std::string contentEncoding; // Sent as Content-Encoding when set; body is already encoded
+    std::string body;
+    long long declaredLength = -1; // Sent as Content-Length in place of the body's size when set
+    bool stall = false;          // Read the request, then never answer
+    int trickleMs = 0;           // Send the answer one byte at a time, this far apart
+    bool interim = false;        // Send "100 Continue" and half the header in one write, the rest later
+};
+
+// Deterministic web of HTML pages spread over virtual hosts. Each host's
+// "/" links to its first page and to the next host's "/", and every page
+// links to the next one, so a crawl from site0.test reaches everything.
+// Links are absolute and carry the scheme and port they were served on.
+//
+// Besides pages, every host serves /redirect (302 to "/"), /notes.txt
+// (text/plain), /unchanged (304) and /moved-large (301), the last two
+// declaring a Content-Length of LARGE_DECLARED_LENGTH, and answers
+// /robots.txt and unknown paths with 404. Two tarpits stand in for hosts
+// that tie up a crawler: /tarpit/stall never answers, and /tarpit/trickle
+// sends a small page one byte every TARPIT_TRICKLE_MS. /interim answers
+// with a 100 Continue ahead of a final header that arrives in two reads,
+// and /bomb is a gzip body of BOMB_SIZE zero bytes.
+class SyntheticWeb {
+public:
+    explicit SyntheticWeb(const SyntheticWebOptions& options = SyntheticWebOptions());
+
+    // Answer GET path on host (the Host header or SNI name, port stripped).
+    // Unknown hosts (e.g. "127.0.0.1") are served as site0.test.
+    SyntheticResponse respond(const std::string& host, const std::string& path,
+                              const std::string& scheme, uint16_t port) const;
+
+    static std::string hostName(size_t index); // "site<index>.test"
+    size_t pageCount() const { return options_.hosts * options_.pagesPerHost; }
+    const SyntheticWebOptions& options() const { return options_; }
+
+private:
+    uint64_t hash(uint64_t host, uint64_t page, uint64_t salt) const;
+    double chance(uint64_t host, uint64_t page, uint64_t salt) const;
+    std::string page(size_t host, size_t page, const std::string& scheme, uint16_t port) const;
+    std::string index(size_t host, const std::string& scheme, uint16_t port) const;
+
+    SyntheticWebOptions options_;
+};
+
+// Request counters of a LocalServer
+struct LocalServerStats {
+    unsigned long connections = 0;
+    unsigned long tlsHandshakes = 0;
+    unsigned long requests = 0;
+    unsigned long errors = 0;   // 4xx and 5xx answers
+};
+
+// Tunables for a LocalServer
+struct LocalServerOptions {
+    uint16_t httpPort = 0;             // 0 picks a free port
+    uint16_t httpsPort = 0;            // 0 picks a free port
+    bool https = true;                 // Also serve TLS, with a self-signed certificate made at start()
+    size_t maxRequestsPerConnection = 0; // Close after this many responses (0 = keep alive)
+};
+
+// HTTP/1.1 server on 127.0.0.1 serving a SyntheticWeb, for tests and
+// benchmarks that must not leave the machine. Plain and TLS listeners run
+// side by side; each connection gets its own thread and keep-alive is
+// supported. Virtual hosts come from the Host header, or the SNI name when
+// a TLS request has none.
+class LocalServer {
+public:
+    explicit LocalServer(const SyntheticWebOptions& web = SyntheticWebOptions(),
+                         const LocalServerOptions& options = LocalServerOptions());
+    ~LocalServer();
+
+    LocalServer(const LocalServer&) = delete;
+    LocalServer& operator=(const LocalServer&) = delete;
+
+    // Bind the listeners and start accepting; returns false on failure
+    bool start();
+
+    // Close every socket and wait for the server threads
+    void stop();
+
+    uint16_t httpPort() const { return httpPort_; }
+    uint16_t httpsPort() const { return httpsPort_; }
+
+    // Absolute URL on this server, e.g. url(false, "site0.test", "/")
+    std::string url(bool https, const std::string& host, const std::string& path) const;
+
+    const SyntheticWeb& web() const { return web_; }
+    LocalServerStats stats() const;
+
+private:
+    int listen(uint16_t port, uint16_t& boundPort);
+    void acceptLoop();
+    void serve(int fd, bool https);
+    bool setUpTls();
+
+    SyntheticWeb web_;
+    LocalServerOptions options_;
+    int httpFd_ = -1;
+    int httpsFd_ = -1;
+    int stopFd_ = -1;                // eventfd that wakes the accept loop
+    uint16_t httpPort_ = 0;
+    uint16_t httpsPort_ = 0;
+    ssl_ctx_st* tls_ = nullptr;
+    std::atomic<bool> running_{false};
+    std::thread acceptor_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable drained_;
+    size_t active_ = 0;              // Connection threads still running
+    std::unordered_set<int> open_;   // Connection sockets, shut down by stop()
+    LocalServerStats stats_;
+};
+
+#endif // LOCAL_SERVER_H
@@ -0,0 +1,77 @@
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include "local_server.h"
+
+static volatile std::sig_atomic_t stopRequested = 0;
+
+static void onSignal(int) {
+    stopRequested = 1;
+}
+
+// Serve a synthetic web on 127.0.0.1 until interrupted, so the crawler can be
+// run end to end without touching the network:
+//   ./local_server --hosts 8 --pages 500
+//   ../crawler http://site0.test:PORT/ --resolve '*.test:127.0.0.1' --quiet
+int main(int argc, char** argv) {
+    SyntheticWebOptions web;
+    LocalServerOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            arg = "--help";
+        }
+        if (arg == "--hosts") {
+            web.hosts = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--pages") {
+            web.pagesPerHost = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--page-bytes") {
+            web.pageBytes = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--links") {
+            web.linksPerPage = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--cross-host") {
+            web.crossHostLinks = std::atof(argv[++i]);
+        } else if (arg == "--redirects") {
+            web.redirectRate = std::atof(argv[++i]);
+        } else if (arg == "--errors") {
+            web.errorRate = std::atof(argv[++i]);
+        } else if (arg == "--latency") {
+            web.latencyMs = std::atoi(argv[++i]);
+        } else if (arg == "--seed") {
+            web.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--http-port") {
+            options.httpPort = static_cast<uint16_t>(std::atoi(argv[++i]));
+        } else if (arg == "--https-port") {
+            options.httpsPort = static_cast<uint16_t>(std::atoi(argv[++i]));
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--hosts N] [--pages N] [--page-bytes N] [--links N]"
+                      << " [--cross-host RATE] [--redirects RATE] [--errors RATE] [--latency MS] [--seed N]"
+                      << " [--http-port PORT] [--https-port PORT]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    LocalServer server(web, options);
+    if (!server.start()) {
+        return EXIT_FAILURE;
+    }
+
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+    std::cout << "Serving " << server.web().pageCount() << " pages on " << web.hosts << " hosts" << std::endl;
+    std::cout << "HTTP port: " << server.httpPort() << ", HTTPS port: " << server.httpsPort() << std::endl;
+    std::cout << "Start URL: " << server.url(false, SyntheticWeb::hostName(0), "/") << std::endl;
+    std::cout << "Resolve hosts with: --resolve '*.test:127.0.0.1'" << std::endl;
+
+    while (!stopRequested) {
+        pause();
+    }
+
+    server.stop();
+    LocalServerStats stats = server.stats();
+    std::cout << "Served " << stats.requests << " requests on " << stats.connections << " connections ("
+              << stats.tlsHandshakes << " TLS handshakes, " << stats.errors << " errors)" << std::endl;
+    return EXIT_SUCCESS;
+}
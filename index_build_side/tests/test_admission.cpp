@@ -0,0 +1,79 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include "../admission.h"
+
+// Helper function to build a response header for the admission check
+static ResponseHeader headerWith(int status, const std::string& contentType, long long contentLength) {
+    ResponseHeader header;
+    header.status = status;
+    header.contentType = contentType;
+    header.contentLength = contentLength;
+    return header;
+}
+
+// Test Case 1: HTML is admitted by default, other types are refused
+void testContentType() {
+    AdmissionPolicy policy;
+    size_t budget = 0;
+
+    assert(policy.check(headerWith(200, "text/html", -1), budget) == Rejection::None);
+    assert(budget == MAX_FILE_SIZE);
+    assert(policy.check(headerWith(200, " Text/HTML ; charset=UTF-8", -1), budget) == Rejection::None && "Parameters and case are ignored");
+    assert(policy.check(headerWith(200, "application/xhtml+xml", -1), budget) == Rejection::None);
+    assert(policy.check(headerWith(200, "video/mp4", -1), budget) == Rejection::ContentType);
+    assert(policy.check(headerWith(200, "application/pdf", 1000), budget) == Rejection::ContentType);
+    assert(policy.check(headerWith(200, "", -1), budget) == Rejection::None && "A missing type falls back to the default budget");
+    assert(policy.check(headerWith(404, "image/png", -1), budget) == Rejection::None && "Non-2xx bodies are only drained");
+
+    std::cout << "Test Case 1: Content type passed.\n";
+}
+
+// Test Case 2: A declared length over the budget is refused before the body
+void testDeclaredLength() {
+    AdmissionPolicy policy;
+    size_t budget = 0;
+
+    assert(policy.check(headerWith(200, "text/html", MAX_FILE_SIZE), budget) == Rejection::None);
+    assert(policy.check(headerWith(200, "text/html", MAX_FILE_SIZE + 1), budget) == Rejection::DeclaredLength);
+    assert(policy.check(headerWith(200, "", 10LL * 1024 * 1024 * 1024), budget) == Rejection::DeclaredLength);
+
+    policy.setFallbackBudget(100);
+    assert(policy.check(headerWith(301, "text/html", 101), budget) == Rejection::DeclaredLength);
+    assert(policy.check(headerWith(301, "text/html", 100), budget) == Rejection::None && budget == 100);
+
+    long long large = 10LL * 1024 * 1024 * 1024;
+    assert(policy.check(headerWith(304, "text/html", large), budget) == Rejection::None && "A 304 has no body to refuse");
+    assert(policy.check(headerWith(204, "", large), budget) == Rejection::None);
+    assert(policy.check(headerWith(100, "", large), budget) == Rejection::None);
+
+    std::cout << "Test Case 2: Declared length passed.\n";
+}
+
+// Test Case 3: Types can be added, resized and removed
+void testConfiguration() {
+    AdmissionPolicy policy;
+    size_t budget = 0;
+
+    policy.allow("text/plain", 1024);
+    assert(policy.check(headerWith(200, "text/plain; charset=ascii", -1), budget) == Rejection::None && budget == 1024);
+    assert(policy.check(headerWith(200, "text/plain", 2048), budget) == Rejection::DeclaredLength);
+
+    policy.allow("TEXT/HTML", 4 * MAX_FILE_SIZE);
+    assert(policy.check(headerWith(200, "text/html", 2 * MAX_FILE_SIZE), budget) == Rejection::None);
+    assert(budget == 4 * MAX_FILE_SIZE);
+
+    policy.disallow("text/html");
+    assert(policy.check(headerWith(200, "text/html", -1), budget) == Rejection::ContentType);
+
+    std::cout << "Test Case 3: Configuration passed.\n";
+}
+
+int main() {
+    testContentType();
+    testDeclaredLength();
+    testConfiguration();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
@@ -0,0 +1,155 @@
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <filesystem>
+#include <set>
+#include <string>
+#include "../archive.h"
+
+// Helper function to build a response as the engine would hand it over
+static Response makeResponse(int status, const std::string& rawHeader) {
+    Response response;
+    response.rawHeader = rawHeader;
+    response.header = handle_response(rawHeader);
+    response.header.status = status;
+    return response;
+}
+
+// Helper function to write a few records into a fresh directory
+static ArchiveStats writeRecords(const ArchiveOptions& options, size_t count) {
+    ArchiveWriter writer(options);
+    assert(writer.open());
+    for (size_t i = 0; i < count; ++i) {
+        Response response = makeResponse(200, "HTTP/1.1 200 OK\r\nContent-Type: text/html\r\n\r\n");
+        std::string body = "<html><body>page " + std::to_string(i) + "</body></html>";
+        assert(writer.append("http://example.com/" + std::to_string(i), response, body));
+    }
+    writer.close();
+    return writer.stats();
+}
+
+// Test Case 1: Records read back with their URL, status, header and decoded body
+void testRoundTrip(const std::string& directory) {
+    ArchiveOptions options;
+    options.directory = directory + "/roundtrip";
+    ArchiveWriter writer(options);
+    assert(writer.open());
+
+    // Wire framing and coding do not describe the stored, decoded body
+    Response page = makeResponse(200, "HTTP/1.1 200 OK\r\nContent-Type: text/html\r\nContent-Encoding: gzip\r\n"
+                                      "Transfer-Encoding: chunked\r\nETag: \"v1\"\r\n\r\n");
+    assert(writer.append("https://example.com/", page, "<html>hello</html>", 1700000000));
+    Response missing = makeResponse(404, "HTTP/1.1 404 Not Found\r\nContent-Type: text/html\r\nContent-Length: 9\r\n\r\n");
+    assert(writer.append("https://example.com/missing", missing, "not found"));
+    writer.flush();
+
+    ArchiveReader reader;
+    assert(reader.open(options.directory));
+    assert(reader.entries().size() == 2 && "Flushed records are indexed");
+    const ArchiveEntry& first = reader.entries()[0];
+    assert(first.url == "https://example.com/" && first.status == 200 && first.fetchTime == 1700000000);
+
+    Response response;
+    assert(reader.read(first, response));
+    assert(response.body == "<html>hello</html>");
+    assert(response.finalUrl == "https://example.com/");
+    assert(response.header.status == 200 && response.header.contentType == "text/html");
+    assert(response.header.etag == "\"v1\"" && "Other headers are kept");
+    assert(response.header.contentEncoding.empty() && response.header.transferEncoding.empty());
+    assert(response.header.contentLength == 18 && "Content-Length describes the decoded body");
+
+    assert(reader.read(reader.entries()[1], response));
+    assert(response.header.status == 404 && response.body == "not found");
+
+    writer.close();
+    assert(writer.stats().records == 2 && writer.stats().blocks == 1 && "Small records share one block");
+
+    std::cout << "Test Case 1: Round trip passed.\n";
+}
+
+// Test Case 2: Any record can be read on its own, in any order
+void testRandomAccess(const std::string& directory) {
+    ArchiveOptions options;
+    options.directory = directory + "/random";
+    options.blockSize = 1; // Every record in a block of its own
+    ArchiveStats stats = writeRecords(options, 20);
+    assert(stats.blocks == 20);
+
+    ArchiveReader reader;
+    assert(reader.open(options.directory));
+    assert(reader.entries().size() == 20);
+    std::set<uint64_t> offsets;
+    for (size_t i = reader.entries().size(); i-- > 0;) {
+        const ArchiveEntry& entry = reader.entries()[i];
+        offsets.insert(entry.blockOffset);
+        Response response;
+        assert(reader.read(entry, response));
+        assert(response.body == "<html><body>page " + std::to_string(i) + "</body></html>");
+    }
+    assert(offsets.size() == 20 && "Each record has its own block");
+
+    std::cout << "Test Case 2: Random access passed.\n";
+}
+
+// Test Case 3: Files rotate by size and numbering continues across writers
+void testRotation(const std::string& directory) {
+    ArchiveOptions options;
+    options.directory = directory + "/rotate";
+    options.blockSize = 1;
+    options.maxFileSize = 200; // About two compressed records per file
+    ArchiveStats stats = writeRecords(options, 10);
+    assert(stats.files > 1 && "Files rotate once they reach the size limit");
+
+    size_t files = 0;
+    for (const auto& file : std::filesystem::directory_iterator(options.directory)) {
+        if (file.path().extension() == ".gz") ++files;
+    }
+    assert(files == stats.files);
+
+    // A second crawl into the same directory adds files instead of replacing them
+    writeRecords(options, 3);
+    ArchiveReader reader;
+    assert(reader.open(options.directory));
+    assert(reader.entries().size() == 13);
+    for (const ArchiveEntry& entry : reader.entries()) {
+        Response response;
+        assert(reader.read(entry, response) && response.header.status == 200);
+    }
+
+    std::cout << "Test Case 3: Rotation passed.\n";
+}
+
+// Test Case 4: Records that cannot be stored are dropped, never waited on
+void testDropped(const std::string& directory) {
+    ArchiveOptions options;
+    options.directory = directory + "/dropped";
+    ArchiveWriter writer(options);
+    Response response = makeResponse(200, "HTTP/1.1 200 OK\r\n\r\n");
+    assert(!writer.append("http://example.com/", response, "body") && "Nothing is queued before open()");
+
+    assert(writer.open());
+    assert(!writer.append("http://example.com/\ttab", response, "body") && "URLs must fit the index");
+    assert(writer.append("http://example.com/", response, "body"));
+    writer.close();
+    assert(!writer.append("http://example.com/", response, "body") && "Nothing is queued after close()");
+
+    ArchiveStats stats = writer.stats();
+    assert(stats.records == 1 && stats.dropped == 3);
+
+    std::cout << "Test Case 4: Dropped records passed.\n";
+}
+
+// Main function to run all test cases
+int main() {
+    char pattern[] = "/tmp/test_archive_XXXXXX";
+    std::string directory = mkdtemp(pattern);
+
+    testRoundTrip(directory);
+    testRandomAccess(directory);
+    testRotation(directory);
+    testDropped(directory);
+
+    std::filesystem::remove_all(directory);
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
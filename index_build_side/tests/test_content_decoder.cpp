@@ -0,0 +1,164 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <zlib.h>
+#include <brotli/encode.h>
+#include "../content_decoder.h"
+
+// Helper function to compress text with zlib; windowBits picks the wrapper
+// (15 + 16 = gzip, 15 = zlib, -15 = raw deflate)
+static std::string deflateText(const std::string& text, int windowBits) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY);
+
+    std::string out(deflateBound(&stream, text.size()) + 32, '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(text.data()));
+    stream.avail_in = text.size();
+    stream.next_out = reinterpret_cast<Bytef*>(&out[0]);
+    stream.avail_out = out.size();
+    deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+// Helper function to feed a compressed body in small pieces, as it would come off the wire
+static bool decodeInPieces(ContentDecoder& decoder, const std::string& wire, size_t piece, std::string& out) {
+    for (size_t i = 0; i < wire.size(); i += piece) {
+        size_t size = std::min(piece, wire.size() - i);
+        if (!decoder.feed(wire.data() + i, size, out)) return false;
+    }
+    return true;
+}
+
+// Large, repetitive page so the output spans several decode steps
+static std::string samplePage() {
+    std::string page = "<html><body>";
+    for (int i = 0; i < 5000; ++i) {
+        page += "<p>Paragraph " + std::to_string(i) + " of the sample page.</p>";
+    }
+    return page + "</body></html>";
+}
+
+// Test Case 1: Content-Encoding values are recognised case-insensitively
+void testParseContentCoding() {
+    assert(parseContentCoding("") == ContentCoding::Identity && "Missing header means identity");
+    assert(parseContentCoding(" GZIP\r") == ContentCoding::Gzip && "Whitespace and case should be ignored");
+    assert(parseContentCoding("x-gzip") == ContentCoding::Gzip && "x-gzip is an alias for gzip");
+    assert(parseContentCoding("deflate") == ContentCoding::Deflate && "deflate should be recognised");
+    assert(parseContentCoding("br") == ContentCoding::Brotli && "br should be recognised");
+    assert(parseContentCoding("zstd") == ContentCoding::Unsupported && "zstd is not supported");
+
+    ContentDecoder decoder;
+    assert(!decoder.reset(ContentCoding::Unsupported) && "Unsupported codings should be refused");
+
+    std::cout << "Test Case 1: Content-Encoding parsing passed.\n";
+}
+
+// Test Case 2: gzip body decoded from 7 byte pieces
+void testGzip() {
+    std::string page = samplePage();
+    std::string wire = deflateText(page, 15 + 16);
+
+    ContentDecoder decoder;
+    assert(decoder.reset(ContentCoding::Gzip));
+    std::string out;
+    assert(decodeInPieces(decoder, wire, 7, out) && "Valid gzip should decode");
+    assert(decoder.finished() && "Decoder should see the end of the gzip member");
+    assert(out == page && "Decoded body should match the original");
+
+    std::cout << "Test Case 2: gzip decoding passed.\n";
+}
+
+// Test Case 3: "deflate" accepts both zlib-wrapped and raw streams
+void testDeflateFlavours() {
+    std::string page = samplePage();
+
+    for (int windowBits : {15, -15}) {
+        ContentDecoder decoder;
+        assert(decoder.reset(ContentCoding::Deflate));
+        std::string out;
+        assert(decodeInPieces(decoder, deflateText(page, windowBits), 64, out) && "Valid deflate should decode");
+        assert(decoder.finished() && "Decoder should see the end of the deflate stream");
+        assert(out == page && "Decoded body should match the original");
+    }
+
+    std::cout << "Test Case 3: deflate decoding passed.\n";
+}
+
+// Test Case 4: Brotli body decoded in pieces
+void testBrotli() {
+    std::string page = samplePage();
+    size_t encodedSize = BrotliEncoderMaxCompressedSize(page.size());
+    std::string wire(encodedSize, '\0');
+    BrotliEncoderCompress(BROTLI_DEFAULT_QUALITY, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_TEXT,
+                          page.size(), reinterpret_cast<const uint8_t*>(page.data()),
+                          &encodedSize, reinterpret_cast<uint8_t*>(&wire[0]));
+    wire.resize(encodedSize);
+
+    ContentDecoder decoder;
+    assert(decoder.reset(ContentCoding::Brotli));
+    std::string out;
+    assert(decodeInPieces(decoder, wire, 13, out) && "Valid brotli should decode");
+    assert(decoder.finished() && "Decoder should see the end of the brotli stream");
+    assert(out == page && "Decoded body should match the original");
+
+    std::cout << "Test Case 4: brotli decoding passed.\n";
+}
+
+// Test Case 5: Truncated and corrupt bodies are reported
+void testCorruptInput() {
+    std::string wire = deflateText(samplePage(), 15 + 16);
+
+    ContentDecoder truncated;
+    truncated.reset(ContentCoding::Gzip);
+    std::string out;
+    assert(truncated.feed(wire.data(), wire.size() / 2, out) && "A partial stream is not an error yet");
+    assert(!truncated.finished() && "A truncated stream should not count as finished");
+
+    ContentDecoder corrupt;
+    corrupt.reset(ContentCoding::Gzip);
+    std::string garbage = "this is not gzip at all";
+    assert(!corrupt.feed(garbage.data(), garbage.size(), out) && "Garbage should fail to decode");
+
+    std::cout << "Test Case 5: Corrupt input passed.\n";
+}
+
+// Test Case 6: A compression bomb is inflated no further than the limit
+void testBomb() {
+    std::string zeros(64 * 1024 * 1024, '\0');
+    std::string gzipBomb = deflateText(zeros, 15 + 16);
+    size_t encodedSize = BrotliEncoderMaxCompressedSize(zeros.size());
+    std::string brotliBomb(encodedSize, '\0');
+    BrotliEncoderCompress(1, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_GENERIC, zeros.size(),
+                          reinterpret_cast<const uint8_t*>(zeros.data()), &encodedSize,
+                          reinterpret_cast<uint8_t*>(&brotliBomb[0]));
+    brotliBomb.resize(encodedSize);
+    assert(gzipBomb.size() < 128 * 1024 && brotliBomb.size() < 128 * 1024);
+
+    const size_t limit = 256 * 1024 + 1;
+    for (ContentCoding coding : {ContentCoding::Gzip, ContentCoding::Brotli}) {
+        const std::string& wire = coding == ContentCoding::Gzip ? gzipBomb : brotliBomb;
+        ContentDecoder decoder;
+        decoder.reset(coding);
+        std::string out;
+        assert(decoder.feed(wire.data(), wire.size(), out, limit) && "Hitting the limit is not corruption");
+        assert(out.size() == limit && "Output stops at the limit");
+        assert(out.capacity() < 2 * limit && "Nothing much past the limit was ever produced");
+        assert(!decoder.finished());
+    }
+
+    std::cout << "Test Case 6: Compression bomb passed.\n";
+}
+
+int main() {
+    testParseContentCoding();
+    testGzip();
+    testDeflateFlavours();
+    testBrotli();
+    testCorruptInput();
+    testBomb();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
@@ -1,6 +1,18 @@
 #include <iostream>
 #include <cassert>
+#include <chrono>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
 #include "../downloader.h"
+#include "../fetch_engine.h"
+#include "../resolver.h"
+#include "../tls_context.h"
+#include "../validator_store.h"
+#include "local_server.h"
 
 // Utility function to check if a string contains valid HTML structure
 bool isValidHtml(const std::string& content) {
@@ -9,8 +21,8 @@ bool isValidHtml(const std::string& content) {
 }
 
 // Test Case 1: Validate HTTP downloader returns valid HTML
-void testHttpDownloader() {
-    std::string url = "http://example.com"; // Ensure this URL is reachable
+void testHttpDownloader(const LocalServer& server) {
+    std::string url = server.url(false, "127.0.0.1", "/page/0.html");
     Response response = httpDownloader(url);
 
     assert(response.header.status == 200 && "HTTP downloader should return a 200 OK status");
@@ -21,8 +33,8 @@ void testHttpDownloader() {
 }
 
 // Test Case 2: Validate HTTPS downloader returns valid HTML
-void testHttpsDownloader() {
-    std::string url = "https://www.example.com"; // Ensure this URL is reachable
+void testHttpsDownloader(const LocalServer& server) {
+    std::string url = server.url(true, "127.0.0.1", "/page/0.html");
     Response response = httpsDownloader(url);
 
     assert(response.header.status == 200 && "HTTPS downloader should return a 200 OK status");
@@ -32,9 +44,9 @@ void testHttpsDownloader() {
     std::cout << "Test Case 2: HTTPS downloader passed.\n";
 }
 
-// Test Case 3: Handle unreachable HTTP URL
+// Test Case 3: Handle unreachable HTTP URL (nothing listens on port 1)
 void testUnreachableUrlHttp() {
-    std::string url = "http://thisdomaindoesnotexist.xyz";
+    std::string url = "http://127.0.0.1:1/";
 
     try {
         Response response = httpDownloader(url);
@@ -47,9 +59,9 @@ void testUnreachableUrlHttp() {
     std::cout << "Test Case 3: Unreachable HTTP URL passed.\n";
 }
 
-// Test Case 4: Handle unreachable HTTPS URL
+// Test Case 4: Handle unreachable HTTPS URL (nothing listens on port 1)
 void testUnreachableUrlHttps() {
-    std::string url = "https://thisdomaindoesnotexist.xyz";
+    std::string url = "https://127.0.0.1:1/";
 
     try {
         Response response = httpsDownloader(url);
@@ -62,41 +74,394 @@ void testUnreachableUrlHttps() {
     std::cout << "Test Case 4: Unreachable HTTPS URL passed.\n";
 }
 
-// Test Case 5: Handle redirect URL for HTTP
-void testRedirectUrlHTTP() {
-    std::string url = "http://httpbin.org/redirect/1"; // Replace with a URL that redirects
+// Test Case 5: A redirect over HTTP is followed to its target
+void testRedirectUrlHTTP(const LocalServer& server) {
+    std::string url = server.url(false, "127.0.0.1", "/redirect");
 
     Response response = httpDownloader(url);
 
-    assert(response.header.status >= 300 && response.header.status < 400 &&
-           "Redirect URL should return a 3xx status code");
+    assert(response.header.status == 200 && "Redirect should be followed to a 200 page");
+    assert(response.finalUrl == server.url(false, "127.0.0.1", "/") && "Final URL should be the redirect target");
     assert(!response.header.contentType.empty() && "Redirect URL response should include headers");
 
     std::cout << "Test Case 5: Redirect URL passed.\n";
 }
 
-// Test Case 6: Handle redirect URL for HTTPS
-void testRedirectUrlHTTPS() {
-    std::string url = "https://httpbin.org/redirect/1"; // Replace with a URL that redirects
+// Test Case 6: A redirect over HTTPS is followed to its target
+void testRedirectUrlHTTPS(const LocalServer& server) {
+    std::string url = server.url(true, "127.0.0.1", "/redirect");
 
     Response response = httpsDownloader(url);
 
-    assert(response.header.status >= 300 && response.header.status < 400 &&
-           "Redirect URL should return a 3xx status code");
+    assert(response.header.status == 200 && "Redirect should be followed to a 200 page");
+    assert(response.finalUrl == server.url(true, "127.0.0.1", "/") && "Final URL should be the redirect target");
     assert(!response.header.contentType.empty() && "Redirect URL response should include headers");
 
     std::cout << "Test Case 6: Redirect URL passed.\n";
 }
 
-// Main function to run all test cases
+// Test Case 7: A repeat HTTPS fetch to the same host resumes the TLS session.
+// The server closes every connection after one response, so the second
+// fetch needs a new handshake instead of reusing a pooled connection.
+void testTlsSessionResumption() {
+    LocalServerOptions options;
+    options.maxRequestsPerConnection = 1;
+    LocalServer server(SyntheticWebOptions(), options);
+    assert(server.start() && "Local server should start");
+    std::string url = server.url(true, "127.0.0.1", "/");
+
+    Response first = httpsDownloader(url);
+    assert(first.header.status == 200 && "First HTTPS fetch should succeed");
+    TlsStats before = tlsStats();
+
+    Response second = httpsDownloader(url);
+    assert(second.header.status == 200 && "Second HTTPS fetch should succeed");
+    TlsStats after = tlsStats();
+
+    assert(after.resumedHandshakes == before.resumedHandshakes + 1 &&
+           "Second HTTPS fetch should resume the cached session");
+
+    std::cout << "Test Case 7: TLS session resumption passed.\n";
+}
+
+// Test Case 8: A missing page is answered with 404
+void testNotFound(const LocalServer& server) {
+    std::string url = server.url(false, "127.0.0.1", "/missing.html");
+
+    Response response = httpDownloader(url);
+
+    assert(response.error == FetchError::None && "A 404 is still a completed fetch");
+    assert(response.header.status == 404 && "Missing page should return 404");
+
+    std::cout << "Test Case 8: Not found passed.\n";
+}
+
+// Test Case 9: The io_uring backend fetches the same pages as epoll, over
+// plain and TLS connections, through keep-alive, redirects and errors
+void testIoUringEngine(const LocalServer& server) {
+    Resolver resolver;
+    FetchEngineOptions options;
+    options.ioBackend = IoBackend::IoUring;
+    FetchEngine engine(options, &resolver);
+    if (!engine.usingIoUring()) {
+        std::cout << "Test Case 9: io_uring engine skipped (unavailable).\n";
+        return;
+    }
+
+    size_t pages = 0;
+    for (bool https : {false, true}) {
+        for (int page = 0; page < 20; ++page) {
+            std::string url = server.url(https, "127.0.0.1", "/page/" + std::to_string(page) + ".html");
+            engine.submit(url, [&](const std::string&, Response& response) {
+                assert(response.error == FetchError::None && response.header.status == 200);
+                assert(isValidHtml(response.body) && "io_uring fetch should return the whole page");
+                ++pages;
+            });
+        }
+    }
+    Response redirected;
+    engine.submit(server.url(true, "127.0.0.1", "/redirect"), [&](const std::string&, Response& response) {
+        redirected = response;
+    });
+    Response missing;
+    engine.submit(server.url(false, "127.0.0.1", "/missing.html"), [&](const std::string&, Response& response) {
+        missing = response;
+    });
+    engine.run();
+
+    assert(pages == 40 && "Every page should be fetched");
+    assert(redirected.header.status == 200 && redirected.finalUrl == server.url(true, "127.0.0.1", "/"));
+    assert(missing.error == FetchError::None && missing.header.status == 404);
+    IoRingStats stats = engine.ioRingStats();
+    assert(stats.enters < stats.submissions && "Submissions should be batched");
+
+    std::cout << "Test Case 9: io_uring engine passed.\n";
+}
+
+// Helper function to run one fetch through an engine with the given deadlines
+static Response fetchWith(const FetchEngineOptions& options, const std::string& url) {
+    FetchEngine engine(options);
+    Response result;
+    engine.submit(url, [&result](const std::string&, Response& response) {
+        result = response;
+    });
+    engine.run();
+    return result;
+}
+
+// Helper function to check a fetch ended on the expected deadline, well before the host would have finished
+static void expectTimeout(const FetchEngineOptions& options, const std::string& url, TimeoutPhase phase) {
+    auto start = std::chrono::steady_clock::now();
+    Response response = fetchWith(options, url);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    assert(response.error == FetchError::Timeout && "A stalled fetch should time out");
+    assert(response.timeout == phase && "The timeout should name the phase that overran");
+    assert(elapsed < std::chrono::seconds(3) && "The deadline should end the fetch promptly");
+}
+
+// Test Case 10: Each phase of a fetch has its own deadline
+void testTimeouts(const LocalServer& server) {
+    FetchEngineOptions options;
+    options.connectTimeoutMs = 200;
+    options.tlsTimeoutMs = 200;
+    options.firstByteTimeoutMs = 200;
+    options.readTimeoutMs = 1000;
+    options.totalTimeoutMs = 5000;
+
+    // Accepts the connection and reads the request, then says nothing
+    expectTimeout(options, server.url(false, "127.0.0.1", "/tarpit/stall"), TimeoutPhase::FirstByte);
+
+    // A plain HTTP listener never answers the ClientHello
+    expectTimeout(options, "https://127.0.0.1:" + std::to_string(server.httpPort()) + "/", TimeoutPhase::Tls);
+
+    // A listener whose accept queue is full drops the SYN
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    assert(bind(listener, reinterpret_cast<sockaddr*>(&address), length) == 0 && listen(listener, 0) == 0);
+    getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length);
+    std::vector<int> fillers;
+    for (int i = 0; i < 4; ++i) {
+        fillers.push_back(socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0));
+        connect(fillers.back(), reinterpret_cast<sockaddr*>(&address), length);
+    }
+    expectTimeout(options, "http://127.0.0.1:" + std::to_string(ntohs(address.sin_port)) + "/", TimeoutPhase::Connect);
+    for (int fd : fillers) close(fd);
+    close(listener);
+
+    // Bytes arriving slower than the read deadline
+    FetchEngineOptions slowReads = options;
+    slowReads.readTimeoutMs = TARPIT_TRICKLE_MS / 2;
+    expectTimeout(slowReads, server.url(false, "127.0.0.1", "/tarpit/trickle"), TimeoutPhase::Read);
+
+    // Bytes arriving steadily, but never finishing in time
+    FetchEngineOptions shortTotal = options;
+    shortTotal.totalTimeoutMs = 500;
+    expectTimeout(shortTotal, server.url(false, "127.0.0.1", "/tarpit/trickle"), TimeoutPhase::Total);
+
+    // The same deadlines hold under io_uring
+    FetchEngineOptions ring = options;
+    ring.ioBackend = IoBackend::IoUring;
+    expectTimeout(ring, server.url(true, "127.0.0.1", "/tarpit/stall"), TimeoutPhase::FirstByte);
+
+    // Pages that answer in time are unaffected
+    Response page = fetchWith(options, server.url(true, "127.0.0.1", "/page/1.html"));
+    assert(page.error == FetchError::None && page.timeout == TimeoutPhase::None && page.header.status == 200);
+
+    std::cout << "Test Case 10: Timeouts passed.\n";
+}
+
+// Helper function to fetch a page through a resolver override, reporting how long it took
+static Response fetchVia(const FetchEngineOptions& options, const std::string& addresses, const std::string& url,
+                         ConnectStats& stats, std::chrono::milliseconds& elapsed) {
+    Resolver resolver;
+    assert(resolver.addOverride("eyeballs.test", addresses));
+    FetchEngine engine(options, &resolver);
+    Response result;
+    auto start = std::chrono::steady_clock::now();
+    engine.submit(url, [&result](const std::string&, Response& response) {
+        result = response;
+    });
+    engine.run();
+    elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    stats = engine.connectStats();
+    return result;
+}
+
+// Test Case 11: New connections race every address of a host, so a dead
+// address costs one attempt delay (or nothing, if it fails outright)
+void testHappyEyeballs(const LocalServer& server) {
+    FetchEngineOptions options;
+    options.connectTimeoutMs = 5000;
+    options.connectAttemptDelayMs = 100;
+    std::string url = server.url(false, "eyeballs.test", "/page/1.html");
+
+    // 127.0.0.2 on the server's port: a full accept queue that drops the SYN
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<uint16_t>(server.httpPort()));
+    inet_pton(AF_INET, "127.0.0.2", &address.sin_addr);
+    assert(bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0 && listen(listener, 0) == 0);
+    std::vector<int> fillers;
+    for (int i = 0; i < 4; ++i) {
+        fillers.push_back(socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0));
+        connect(fillers.back(), reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    }
+
+    ConnectStats stats;
+    std::chrono::milliseconds elapsed;
+    Response response = fetchVia(options, "127.0.0.2,127.0.0.1", url, stats, elapsed);
+    assert(response.error == FetchError::None && response.header.status == 200);
+    assert(elapsed < std::chrono::seconds(2) && "The second address should not wait for the first to time out");
+    assert(stats.attempts == 2 && stats.fallbacks == 1);
+
+    // The same race under io_uring
+    FetchEngineOptions ring = options;
+    ring.ioBackend = IoBackend::IoUring;
+    response = fetchVia(ring, "127.0.0.2,127.0.0.1", url, stats, elapsed);
+    assert(response.error == FetchError::None && response.header.status == 200);
+    assert(elapsed < std::chrono::seconds(2) && stats.fallbacks == 1);
+
+    for (int fd : fillers) close(fd);
+    close(listener);
+
+    // Nothing listens on [::1] at this port (or IPv6 is off): the refusal
+    // brings the IPv4 address in without waiting out the attempt delay
+    FetchEngineOptions patient = options;
+    patient.connectAttemptDelayMs = 3000;
+    response = fetchVia(patient, "::1,127.0.0.1", url, stats, elapsed);
+    assert(response.error == FetchError::None && response.header.status == 200);
+    assert(elapsed < std::chrono::seconds(2) && "A refused connect should fall back at once");
+    assert(stats.fallbacks == 1 && stats.ipv6 == 0);
+
+    // Every address refused: the fetch fails once all of them have
+    response = fetchVia(patient, "::1,127.0.0.1", "http://eyeballs.test:1/", stats, elapsed);
+    assert(response.error == FetchError::Connect && elapsed < std::chrono::seconds(2));
+
+    std::cout << "Test Case 11: Happy Eyeballs passed.\n";
+}
+
+// Test Case 12: A final header split across reads after a 100 Continue
+// that arrived in the same read as its first half
+void testInterimResponse(const LocalServer& server) {
+    for (bool https : {false, true}) {
+        Response response = fetchWith(FetchEngineOptions(), server.url(https, "127.0.0.1", "/interim"));
+        assert(response.error == FetchError::None && "The split header should still parse");
+        assert(response.header.status == 200 && "The interim response is skipped");
+        assert(response.body == "<html><body>After continue</body></html>\n");
+    }
+
+    std::cout << "Test Case 12: Interim response passed.\n";
+}
+
+// Helper function for the peak resident size of this process, in KB
+static long peakResidentKB() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Test Case 13: A gzip bomb is cut off at the body budget without ever being
+// inflated much past it, on both the buffered and the streaming path
+void testCompressionBomb(const LocalServer& server) {
+    std::string url = server.url(false, "127.0.0.1", "/bomb");
+    long peakBefore = peakResidentKB();
+
+    Response response = fetchWith(FetchEngineOptions(), url);
+    assert(response.error == FetchError::Rejected && response.rejection == Rejection::BodyLimit);
+    assert(response.body.size() <= MAX_FILE_SIZE);
+
+    FetchEngine engine;
+    size_t streamed = 0;
+    Response result;
+    engine.submit(url,
+        [&result](const std::string&, Response& response) { result = response; },
+        [&streamed](const Response&, const char*, size_t size) { streamed += size; });
+    engine.run();
+    assert(result.error == FetchError::Rejected && result.rejection == Rejection::BodyLimit);
+    assert(streamed <= MAX_FILE_SIZE);
+
+    assert(peakResidentKB() - peakBefore < BOMB_SIZE / 1024 / 4 && "The bomb must not be inflated in memory");
+
+    std::cout << "Test Case 13: Compression bomb passed.\n";
+}
+
+// Test Case 14: A policy given to one fetch admits what the engine's own
+// policy refuses, for that fetch only
+void testAdmissionOverride(const LocalServer& server) {
+    std::string url = server.url(false, "127.0.0.1", "/notes.txt");
+    AdmissionPolicy plainText;
+    plainText.allow("text/plain", 64);
+
+    FetchEngine engine;
+    Response overridden;
+    Response plain;
+    engine.submit(url, [&overridden](const std::string&, Response& response) { overridden = response; },
+                  nullptr, &plainText);
+    engine.submit(url, [&plain](const std::string&, Response& response) { plain = response; });
+    engine.run();
+    assert(overridden.error == FetchError::None && overridden.body == "Plain text\n");
+    assert(plain.error == FetchError::Rejected && plain.rejection == Rejection::ContentType);
+
+    std::cout << "Test Case 14: Admission override passed.\n";
+}
+
+// Test Case 15: Servers on two ports of one host each resume their own
+// session, fetched in turn, instead of being offered the other's tickets
+void testTlsSessionPerPort() {
+    LocalServerOptions options;
+    options.maxRequestsPerConnection = 1;
+    LocalServer first(SyntheticWebOptions(), options);
+    LocalServer second(SyntheticWebOptions(), options);
+    assert(first.start() && second.start() && "Local servers should start");
+    std::string firstUrl = first.url(true, "127.0.0.1", "/");
+    std::string secondUrl = second.url(true, "127.0.0.1", "/");
+
+    assert(httpsDownloader(firstUrl).header.status == 200);
+    assert(httpsDownloader(secondUrl).header.status == 200);
+    TlsStats before = tlsStats();
+    assert(httpsDownloader(firstUrl).header.status == 200);
+    assert(httpsDownloader(secondUrl).header.status == 200);
+    TlsStats after = tlsStats();
+
+    assert(after.resumedHandshakes == before.resumedHandshakes + 2 && "Both servers should resume their own session");
+
+    std::cout << "Test Case 15: TLS sessions per port passed.\n";
+}
+
+// Test Case 16: Responses whose body is never read are not refused for the
+// length they declare: a 304 to a conditional request completes as not
+// modified, and a 301 is followed
+void testLargeDeclaredLength(const LocalServer& server) {
+    std::string unchanged = server.url(false, "127.0.0.1", "/unchanged");
+    ValidatorStore validators;
+    ResponseHeader cached;
+    cached.status = 200;
+    cached.etag = "\"v1\"";
+    validators.record(unchanged, cached);
+
+    FetchEngine engine;
+    engine.setValidatorStore(&validators);
+    Response notModified;
+    engine.submit(unchanged, [&notModified](const std::string&, Response& response) { notModified = response; });
+    engine.run();
+    assert(notModified.error == FetchError::None && notModified.notModified && "A large 304 is not refused");
+
+    Response moved = fetchWith(FetchEngineOptions(), server.url(false, "127.0.0.1", "/moved-large"));
+    assert(moved.error == FetchError::None && moved.header.status == 200 && "A large 301 is still followed");
+    assert(moved.finalUrl == server.url(false, "127.0.0.1", "/"));
+
+    std::cout << "Test Case 16: Large declared length passed.\n";
+}
+
+// Main function to run all test cases against a server on this machine
 int main() {
+    LocalServer server;
+    if (!server.start()) {
+        std::cerr << "Failed to start the local server\n";
+        return 1;
+    }
+
     try {
-        testHttpDownloader();
-        testHttpsDownloader();
+        testHttpDownloader(server);
+        testHttpsDownloader(server);
         testUnreachableUrlHttp();
         testUnreachableUrlHttps();
-        testRedirectUrlHTTP();
-        testRedirectUrlHTTPS();
+        testRedirectUrlHTTP(server);
+        testRedirectUrlHTTPS(server);
+        testTlsSessionResumption();
+        testNotFound(server);
+        testIoUringEngine(server);
+        testTimeouts(server);
+        testHappyEyeballs(server);
+        testInterimResponse(server);
+        testCompressionBomb(server);
+        testAdmissionOverride(server);
+        testTlsSessionPerPort();
+        testLargeDeclaredLength(server);
     } catch (const std::exception& e) {
         std::cerr << "Test failed: " << e.what() << '\n';
         return 1;
@@ -0,0 +1,117 @@
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <string>
+#include "../frontier.h"
+
+using std::chrono::milliseconds;
+
+// Test Case 1: A host gets its burst at once, then one URL per refill interval
+void testTokenBucket() {
+    FrontierOptions options;
+    options.requestsPerSecond = 10.0; // One token every 100 ms
+    options.burst = 2.0;
+    Frontier frontier(options);
+    for (int i = 0; i < 5; ++i) frontier.push("http://a.com/" + std::to_string(i));
+
+    Frontier::Clock::time_point start = Frontier::Clock::now();
+    std::string url;
+    assert(frontier.pop(url, start) && url == "http://a.com/0");
+    assert(frontier.pop(url, start) && url == "http://a.com/1");
+    assert(!frontier.pop(url, start) && "The burst is used up");
+
+    int wait = frontier.msUntilReady(start);
+    assert(wait > 0 && wait <= 100);
+    assert(!frontier.pop(url, start + milliseconds(50)));
+    assert(frontier.pop(url, start + milliseconds(100)) && url == "http://a.com/2");
+    assert(!frontier.pop(url, start + milliseconds(150)));
+    assert(frontier.pop(url, start + milliseconds(200)) && url == "http://a.com/3");
+    assert(frontier.size() == 1);
+
+    std::cout << "Test Case 1: Token bucket passed.\n";
+}
+
+// Test Case 2: A host that is out of tokens does not hold back the others
+void testHostsInterleave() {
+    FrontierOptions options;
+    options.requestsPerSecond = 1.0;
+    options.burst = 1.0;
+    Frontier frontier(options);
+    for (int i = 0; i < 3; ++i) frontier.push("http://busy.com/" + std::to_string(i));
+    frontier.push("http://other.com/");
+    frontier.push("https://Third.com:8443/x");
+
+    Frontier::Clock::time_point now = Frontier::Clock::now();
+    std::string url;
+    int busy = 0, others = 0;
+    while (frontier.pop(url, now)) {
+        if (url.find("busy.com") != std::string::npos) ++busy; else ++others;
+    }
+    assert(busy == 1 && others == 2 && "One URL per host is eligible right away");
+    assert(frontier.hosts() == 3 && frontier.size() == 2);
+
+    assert(frontier.pop(url, now + milliseconds(1000)) && url == "http://busy.com/1");
+    assert(frontier.msUntilReady(now + milliseconds(1000)) > 0);
+
+    std::cout << "Test Case 2: Hosts interleave passed.\n";
+}
+
+// Test Case 3: Crawl-delay spaces requests without bursts
+void testCrawlDelay() {
+    FrontierOptions options;
+    options.requestsPerSecond = 100.0;
+    options.burst = 10.0;
+    Frontier frontier(options);
+    frontier.setCrawlDelay("slow.com", 2.0);
+    for (int i = 0; i < 3; ++i) frontier.push("http://slow.com/" + std::to_string(i));
+
+    Frontier::Clock::time_point now = Frontier::Clock::now();
+    std::string url;
+    assert(frontier.pop(url, now));
+    assert(!frontier.pop(url, now + milliseconds(1000)) && "Only one request per delay");
+    assert(frontier.pop(url, now + milliseconds(2000)) && url == "http://slow.com/1");
+
+    frontier.setCrawlDelay("SLOW.com", 0);
+    assert(frontier.msUntilReady(now + milliseconds(2000)) >= 0);
+    assert(frontier.pop(url, now + milliseconds(2020)) && url == "http://slow.com/2" && "The default rate is restored");
+    assert(frontier.empty() && frontier.msUntilReady() == -1);
+
+    std::cout << "Test Case 3: Crawl delay passed.\n";
+}
+
+// Test Case 4: A host backed off after a timeout waits out the penalty while
+// the others go on, and repeated penalties add up
+void testBackOff() {
+    FrontierOptions options;
+    options.requestsPerSecond = 10.0;
+    options.burst = 4.0;
+    Frontier frontier(options);
+    for (int i = 0; i < 3; ++i) frontier.push("http://tarpit.com/" + std::to_string(i));
+    frontier.push("http://other.com/");
+    frontier.backOff("http://tarpit.com/0", 5.0);
+
+    Frontier::Clock::time_point now = Frontier::Clock::now();
+    std::string url;
+    assert(frontier.pop(url, now) && url == "http://other.com/");
+    assert(!frontier.pop(url, now) && "The burst is gone while the penalty lasts");
+    assert(frontier.msUntilReady(now) > 4900);
+    assert(!frontier.pop(url, now + milliseconds(4900)));
+    assert(frontier.pop(url, now + milliseconds(5200)) && url == "http://tarpit.com/0");
+
+    frontier.backOff("http://tarpit.com/", 5.0);
+    frontier.backOff("http://tarpit.com/", 5.0);
+    assert(!frontier.pop(url, now + milliseconds(15000)) && "Penalties add up");
+    assert(frontier.pop(url, now + milliseconds(15400)) && url == "http://tarpit.com/1");
+
+    std::cout << "Test Case 4: Back off passed.\n";
+}
+
+int main() {
+    testTokenBucket();
+    testHostsInterleave();
+    testCrawlDelay();
+    testBackOff();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include "../html_entities.h"
+#include "../parser.h"
+
+// Helper function to decode the reference at the start of text, as the whole
+// input, giving what it decodes to and how many bytes it took
+static std::string decode(const std::string& text, size_t& length) {
+    char out[MAX_REFERENCE_UTF8];
+    size_t outSize = 0;
+    length = decodeCharacterReference(text, true, out, outSize);
+    return std::string(out, outSize);
+}
+
+// Test Case 1: Named references, with and without their ';'
+void testNamed() {
+    size_t length;
+    assert(decode("&amp;", length) == "&" && length == 5);
+    assert(decode("&nbsp;x", length) == "\xc2\xa0" && length == 6);
+    assert(decode("&quot;", length) == "\"" && length == 6);
+    assert(decode("&rsquo;", length) == "\xe2\x80\x99" && length == 7);
+    assert(decode("&CounterClockwiseContourIntegral;", length) == "\xe2\x88\xb3" && length == 33);
+    assert(decode("&NotEqualTilde;", length) == "\xe2\x89\x82\xcc\xb8" && "Some names stand for two code points");
+
+    assert(decode("&copy 2026", length) == "\xc2\xa9" && length == 5 && "Legacy names work without ';'");
+    assert(decode("&notit;", length) == "\xc2\xac" && length == 4 && "The longest legacy name the run starts with");
+    assert(decode("&ampx", length) == "&" && length == 4);
+    assert(decode("&rsquo", length).empty() && length == 0 && "Only legacy names may drop the ';'");
+    assert(decode("&unknown;", length).empty() && length == 0);
+    assert(decode("&AMP;", length) == "&" && decode("&Amp;", length).empty() && "Names are case-sensitive");
+    assert(decode("& ", length).empty() && length == 0);
+
+    std::cout << "Test Case 1: Named references passed.\n";
+}
+
+// Test Case 2: Numeric references become UTF-8, with the spec's replacements
+void testNumeric() {
+    size_t length;
+    assert(decode("&#38;", length) == "&" && length == 5);
+    assert(decode("&#x2019;", length) == "\xe2\x80\x99" && length == 8);
+    assert(decode("&#X1F600;", length) == "\xf0\x9f\x98\x80");
+    assert(decode("&#8217 more", length) == "\xe2\x80\x99" && length == 6 && "The ';' may be missing");
+    assert(decode("&#150;", length) == "\xe2\x80\x93" && "0x80-0x9F are read as windows-1252");
+    assert(decode("&#x81;", length) == "\xc2\x81" && "Unassigned windows-1252 bytes are kept");
+    assert(decode("&#0;", length) == "\xef\xbf\xbd");
+    assert(decode("&#xD800;", length) == "\xef\xbf\xbd" && "Surrogates are replaced");
+    assert(decode("&#x110000;", length) == "\xef\xbf\xbd");
+    assert(decode("&#99999999999999999999;", length) == "\xef\xbf\xbd" && length == 23);
+    assert(decode("&#;", length).empty() && length == 0);
+    assert(decode("&#xg;", length).empty() && length == 0);
+
+    std::cout << "Test Case 2: Numeric references passed.\n";
+}
+
+// Test Case 3: Text that stops mid-reference asks for more unless it is final
+void testIncomplete() {
+    char out[MAX_REFERENCE_UTF8];
+    size_t outSize;
+    for (const char* text : {"&", "&am", "&amp", "&#", "&#x", "&#12", "&#x2F"}) {
+        assert(decodeCharacterReference(text, false, out, outSize) == REFERENCE_INCOMPLETE);
+        assert(decodeCharacterReference(text, true, out, outSize) != REFERENCE_INCOMPLETE);
+    }
+    assert(decodeCharacterReference("&amp;", false, out, outSize) == 5);
+    assert(decodeCharacterReference("&amp ", false, out, outSize) == 4);
+
+    std::cout << "Test Case 3: Incomplete references passed.\n";
+}
+
+// Test Case 4: Decoded references no longer leak into the words
+void testWords() {
+    std::string page = "<p>Cod&nbsp;and haddock &#38; more&hellip; it&rsquo;s &quot;fresh&quot; &copy 2026 "
+                       "&#x41;&#66;C caf&eacute; &unknown; stays</p>";
+    std::vector<std::string> words = {"cod", "and", "haddock", "more", "it", "s", "fresh", "2026",
+                                      "abc", "caf", "unknown", "stays"};
+    assert(parseHTML("https://example.com/", page).words == words);
+
+    std::cout << "Test Case 4: Words passed.\n";
+}
+
+// Main function to run all test cases
+int main() {
+    testNamed();
+    testNumeric();
+    testIncomplete();
+    testWords();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <string>
+#include <vector>
+#include "../html_scanner.h"
+#include "../parser.h"
+
+// Helper function to list the levels this CPU can run
+static std::vector<ScanLevel> runnableLevels() {
+    std::vector<ScanLevel> levels;
+    for (ScanLevel level : {ScanLevel::Scalar, ScanLevel::Sse2, ScanLevel::Avx2}) {
+        if (static_cast<int>(level) <= static_cast<int>(supportedScanLevel())) levels.push_back(level);
+    }
+    return levels;
+}
+
+// Test Case 1: Every level finds the first match at every offset and length,
+// including matches in the tail that is too short for a vector
+void testMatchPositions() {
+    std::string buffer(200, 'x');
+    for (ScanLevel level : runnableLevels()) {
+        setScanLevel(level);
+        for (size_t start = 0; start < 40; ++start) {
+            for (size_t length = 0; start + length <= buffer.size(); length += 7) {
+                assert(scanForAny(buffer.data() + start, length, '<', '>', '&') == length && "No match gives size");
+            }
+        }
+        for (size_t match = 0; match < 100; ++match) {
+            for (char needle : {'<', '>', '&'}) {
+                buffer[match] = needle;
+                for (size_t start = 0; start <= match; start += 3) {
+                    size_t found = scanForAny(buffer.data() + start, 100 - start, '<', '>', '&');
+                    assert(found == match - start);
+                }
+                buffer[match] = 'x';
+            }
+        }
+    }
+    setScanLevel(supportedScanLevel());
+
+    std::cout << "Test Case 1: Match positions passed.\n";
+}
+
+// Test Case 2: Levels agree on random text, high bytes included
+void testRandomText() {
+    std::mt19937 random(42);
+    std::string text(4096, ' ');
+    for (char& ch : text) ch = static_cast<char>(random() % 256);
+
+    std::vector<size_t> expected;
+    setScanLevel(ScanLevel::Scalar);
+    for (size_t i = 0; i < text.size(); i += 13) {
+        expected.push_back(scanForAny(text.data() + i, text.size() - i, '<', '"', '\xe9'));
+    }
+    for (ScanLevel level : runnableLevels()) {
+        setScanLevel(level);
+        size_t index = 0;
+        for (size_t i = 0; i < text.size(); i += 13) {
+            assert(scanForAny(text.data() + i, text.size() - i, '<', '"', '\xe9') == expected[index++]);
+        }
+    }
+    setScanLevel(supportedScanLevel());
+
+    std::cout << "Test Case 2: Random text passed.\n";
+}
+
+// Test Case 3: The parser gives the same words and links whichever level scans
+void testParserAgrees() {
+    std::string page = "<html><head><script>var a = 1 < 2;</script></head><body>";
+    for (int i = 0; i < 50; ++i) {
+        page += "<p class=\"para\" title='a > b'>Paragraph " + std::to_string(i) +
+                " with fish &amp; chips, &lt;tags&gt; and <a href=\"/p" + std::to_string(i) + ".html\">a link</a></p>\n";
+    }
+    page += "</body></html>";
+
+    setScanLevel(ScanLevel::Scalar);
+    ParsedData expected = parseHTML("https://example.com/", page);
+    assert(expected.links.size() == 50 && !expected.words.empty());
+    for (ScanLevel level : runnableLevels()) {
+        setScanLevel(level);
+        ParsedData parsed = parseHTML("https://example.com/", page);
+        assert(parsed.words == expected.words && parsed.links == expected.links);
+    }
+    setScanLevel(supportedScanLevel());
+
+    std::cout << "Test Case 3: Parser agrees across levels (" << scanLevelName(supportedScanLevel()) << ") passed.\n";
+}
+
+// Main function to run all test cases
+int main() {
+    testMatchPositions();
+    testRandomText();
+    testParserAgrees();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include "../http_framing.h"
+
+// Test Case 1: Content-Length body stops at the declared size
+void testContentLength() {
+    BodyFramer framer;
+    framer.reset(BodyFraming::ContentLength, 5);
+
+    std::string body;
+    const char* data = "helloHTTP/1.1 200 OK";
+    size_t used = framer.feed(data, std::strlen(data), body);
+
+    assert(framer.done() && "Framer should finish after Content-Length bytes");
+    assert(used == 5 && "Framer should leave bytes of the next response unconsumed");
+    assert(body == "hello" && "Body should contain exactly the declared bytes");
+
+    std::cout << "Test Case 1: Content-Length framing passed.\n";
+}
+
+// Test Case 2: Chunked body is de-framed even when split at every byte
+void testChunkedByteByByte() {
+    BodyFramer framer;
+    framer.reset(BodyFraming::Chunked);
+
+    std::string body;
+    std::string wire = "5;name=value\r\nhello\r\n7\r\n, world\r\n0\r\nTrailer: x\r\n\r\n";
+    for (char ch : wire) {
+        assert(!framer.done() && "Framer should not finish before the last chunk");
+        framer.feed(&ch, 1, body);
+    }
+
+    assert(framer.done() && "Framer should finish after the terminating chunk and trailers");
+    assert(body == "hello, world" && "Chunk sizes and extensions should not leak into the body");
+
+    std::cout << "Test Case 2: Chunked framing passed.\n";
+}
+
+// Test Case 3: Malformed chunk sizes are reported
+void testMalformedChunk() {
+    BodyFramer framer;
+    framer.reset(BodyFraming::Chunked);
+
+    std::string body;
+    const char* wire = "zz\r\nhello\r\n";
+    framer.feed(wire, std::strlen(wire), body);
+
+    assert(framer.failed() && "Non-hex chunk size should fail the framing");
+
+    std::cout << "Test Case 3: Malformed chunk passed.\n";
+}
+
+// Test Case 4: Payload read directly into the body bypasses the framer but keeps it in step
+void testDirectReads() {
+    BodyFramer framer;
+    framer.reset(BodyFraming::ContentLength, 10);
+    assert(framer.directBytes() == 10 && "Whole Content-Length body may be read directly");
+    framer.commitDirect(4);
+    assert(framer.directBytes() == 6 && "Direct bytes should shrink as they are committed");
+    framer.commitDirect(6);
+    assert(framer.done() && "Committing the last byte should finish the body");
+
+    framer.reset(BodyFraming::Chunked);
+    std::string body;
+    const char* size = "5\r\n";
+    framer.feed(size, std::strlen(size), body);
+    assert(framer.directBytes() == 5 && "Chunk payload may be read directly");
+    body += "hello";
+    framer.commitDirect(5);
+    assert(framer.directBytes() == 0 && "Chunk delimiters must go through feed()");
+    const char* rest = "\r\n0\r\n\r\n";
+    framer.feed(rest, std::strlen(rest), body);
+    assert(framer.done() && body == "hello" && "Framing should resume after direct reads");
+
+    std::cout << "Test Case 4: Direct reads passed.\n";
+}
+
+int main() {
+    testContentLength();
+    testChunkedByteByByte();
+    testMalformedChunk();
+    testDirectReads();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include "../http_header_parser.h"
+
+static const std::string SAMPLE_HEADER =
+    "HTTP/1.1 301 Moved Permanently\r\n"
+    "content-type: text/html; charset=utf-8\r\n"
+    "Content-Length:  1234 \r\n"
+    "LOCATION: https://example.com/next\r\n"
+    "ETag: \"abc123\"\r\n"
+    "Last-Modified: Tue, 15 Nov 1994 12:45:26 GMT\r\n"
+    "Content-Encoding: gzip\r\n"
+    "X-Empty:\r\n"
+    "\r\n";
+
+// Test Case 1: Whole header in one call, names matched case-insensitively
+void testCompleteHeader() {
+    std::string wire = SAMPLE_HEADER + "body bytes";
+    HttpHeaderParser parser;
+
+    assert(parser.parse(wire.data(), wire.size()) == HeaderParseStatus::Complete);
+    assert(parser.headerSize() == SAMPLE_HEADER.size() && "Header should end at the blank line");
+    assert(parser.status() == 301 && parser.versionMinor() == 1);
+    assert(parser.fieldCount() == 7 && "Every field should be recorded");
+    assert(parser.contentType() == "text/html; charset=utf-8");
+    assert(parser.contentLength() == 1234 && "Whitespace around values should be trimmed");
+    assert(parser.location() == "https://example.com/next");
+    assert(parser.etag() == "\"abc123\"");
+    assert(parser.lastModified() == "Tue, 15 Nov 1994 12:45:26 GMT");
+    assert(parser.contentEncoding() == "gzip");
+    assert(parser.find("x-empty").empty() && parser.transferEncoding().empty());
+
+    std::cout << "Test Case 1: Complete header passed.\n";
+}
+
+// Test Case 2: Header fed one byte at a time gives the same result
+void testByteByByte() {
+    HttpHeaderParser parser;
+    HeaderParseStatus status = HeaderParseStatus::Incomplete;
+    for (size_t size = 1; size <= SAMPLE_HEADER.size(); ++size) {
+        assert(status == HeaderParseStatus::Incomplete && "Parser should not finish early");
+        status = parser.parse(SAMPLE_HEADER.data(), size);
+    }
+
+    assert(status == HeaderParseStatus::Complete);
+    assert(parser.status() == 301 && parser.fieldCount() == 7);
+    assert(parser.location() == "https://example.com/next");
+
+    std::cout << "Test Case 2: Incremental parsing passed.\n";
+}
+
+// Test Case 3: Parsing resumes when the buffer moves between calls
+void testMovedBuffer() {
+    HttpHeaderParser parser;
+    std::string first = SAMPLE_HEADER.substr(0, 50);
+    assert(parser.parse(first.data(), first.size()) == HeaderParseStatus::Incomplete);
+
+    std::string grown = first + SAMPLE_HEADER.substr(50);
+    assert(parser.parse(grown.data(), grown.size()) == HeaderParseStatus::Complete);
+    assert(parser.contentType() == "text/html; charset=utf-8" && "Views should follow the new buffer");
+
+    std::cout << "Test Case 3: Moved buffer passed.\n";
+}
+
+// Test Case 4: Bare LF line endings, missing reason phrase and folded values
+void testLenientForms() {
+    std::string wire = "HTTP/1.0 200\nServer: a\n  b\nConnection: keep-alive\n\n";
+    HttpHeaderParser parser;
+
+    assert(parser.parse(wire.data(), wire.size()) == HeaderParseStatus::Complete);
+    assert(parser.status() == 200 && parser.versionMinor() == 0);
+    assert(parser.find("Server") == "a\n  b" && "Folded line should extend the previous value");
+    assert(parser.connection() == "keep-alive");
+    assert(parser.contentLength() == -1 && "Absent Content-Length should be -1");
+
+    std::cout << "Test Case 4: Lenient forms passed.\n";
+}
+
+// Test Case 5: Malformed headers are rejected
+void testMalformed() {
+    const char* cases[] = {
+        "HTTP/2 200 OK\r\n\r\n",
+        "HTTP/1.1 20 OK\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nBad Name: x\r\n\r\n",
+        "HTTP/1.1 200 OK\r\n: empty\r\n\r\n",
+        "HTTP/1.1 200 OK\r\n\rX",
+    };
+    for (const char* wire : cases) {
+        HttpHeaderParser parser;
+        assert(parser.parse(wire, std::string(wire).size()) == HeaderParseStatus::Error);
+    }
+
+    std::cout << "Test Case 5: Malformed headers passed.\n";
+}
+
+int main() {
+    testCompleteHeader();
+    testByteByByte();
+    testMovedBuffer();
+    testLenientForms();
+    testMalformed();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include "../redirect_map.h"
+
+// Test Case 1: Location values resolve against the redirecting URL
+void testResolveLocation() {
+    const std::string base = "http://example.com/dir/page.html?x=1";
+
+    assert(resolveLocation(base, "https://example.com/") == "https://example.com/");
+    assert(resolveLocation(base, "HTTPS://example.com/a") == "https://example.com/a" && "Scheme is case-insensitive");
+    assert(resolveLocation(base, "//cdn.example.com/a") == "http://cdn.example.com/a");
+    assert(resolveLocation(base, "/top") == "http://example.com/top");
+    assert(resolveLocation(base, "other.html") == "http://example.com/dir/other.html");
+    assert(resolveLocation(base, "../up.html#frag") == "http://example.com/up.html");
+    assert(resolveLocation(base, "./a/./b/../c?q=2") == "http://example.com/dir/a/c?q=2");
+    assert(resolveLocation(base, "?y=2") == "http://example.com/dir/page.html?y=2");
+    assert(resolveLocation("http://example.com", "a") == "http://example.com/a");
+    assert(resolveLocation(base, "mailto:someone@example.com").empty() && "Non-http targets are not followed");
+
+    std::cout << "Test Case 1: Location resolution passed.\n";
+}
+
+// Test Case 2: Learned redirects are followed through chains and stop at loops
+void testResolveChains() {
+    RedirectMap redirects;
+    redirects.learn("http://a.com/", "https://a.com/");
+    redirects.learn("https://a.com/", "https://www.a.com/");
+    assert(redirects.resolve("http://a.com/") == "https://www.a.com/" && "Chains resolve to the final target");
+    assert(redirects.resolve("http://b.com/") == "http://b.com/" && "Unknown URLs resolve to themselves");
+
+    redirects.learn("http://loop.com/1", "http://loop.com/2");
+    redirects.learn("http://loop.com/2", "http://loop.com/1");
+    std::string target = redirects.resolve("http://loop.com/1");
+    assert(target == "http://loop.com/2" && "A loop stops at the last new URL");
+
+    redirects.forget("http://a.com/");
+    assert(redirects.resolve("http://a.com/") == "http://a.com/");
+
+    std::cout << "Test Case 2: Redirect chains passed.\n";
+}
+
+// Test Case 3: The map survives a save / load round trip
+void testPersistence() {
+    const std::string path = "test_redirects.txt";
+    RedirectMap redirects;
+    redirects.learn("http://a.com/", "https://a.com/");
+    redirects.learn("http://b.com/x", "http://b.com/y");
+    assert(redirects.save(path));
+
+    RedirectMap loaded;
+    assert(loaded.load(path));
+    std::remove(path.c_str());
+
+    assert(loaded.size() == 2);
+    assert(loaded.resolve("http://a.com/") == "https://a.com/");
+    assert(loaded.resolve("http://b.com/x") == "http://b.com/y");
+
+    std::cout << "Test Case 3: Persistence passed.\n";
+}
+
+int main() {
+    testResolveLocation();
+    testResolveChains();
+    testPersistence();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
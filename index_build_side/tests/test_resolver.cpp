@@ -0,0 +1,146 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include "../resolver.h"
+
+// Helper function to wait for and run the resolver's pending callbacks
+void drain(Resolver& resolver) {
+    while (resolver.pending() > 0) {
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(resolver.notifyFd(), &readable);
+        select(resolver.notifyFd() + 1, &readable, nullptr, nullptr, nullptr);
+        resolver.dispatchCompletions();
+    }
+}
+
+// Test Case 1: Numeric hosts resolve without a lookup and are cached
+void testNumericHost() {
+    Resolver resolver;
+    bool called = false;
+    resolver.resolve("127.0.0.1", [&](const std::string&, const ResolvedHost& result) {
+        called = true;
+        assert(result.found && "Numeric host should always resolve");
+        assert(result.addresses.size() == 1 && "Numeric host should yield exactly one address");
+    });
+    drain(resolver);
+
+    ResolvedHost cached;
+    assert(called && "Callback should run from dispatchCompletions");
+    assert(resolver.lookupCached("127.0.0.1", cached) && cached.found && "Numeric host should be cached");
+    assert(resolver.stats().lookups == 0 && "Numeric host should not hit the system resolver");
+
+    std::cout << "Test Case 1: Numeric host passed.\n";
+}
+
+// Test Case 2: Concurrent lookups for one host are merged and the answer is cached
+void testLocalhostMergedAndCached() {
+    Resolver resolver;
+    int callbacks = 0;
+    for (int i = 0; i < 3; ++i) {
+        resolver.resolve("localhost", [&](const std::string&, const ResolvedHost& result) {
+            ++callbacks;
+            assert(result.found && "localhost should resolve");
+        });
+    }
+    drain(resolver);
+
+    ResolvedHost cached;
+    assert(callbacks == 3 && "Every caller should be notified");
+    assert(resolver.stats().lookups == 1 && "Concurrent lookups for one host should be merged");
+    assert(resolver.lookupCached("localhost", cached) && "Answer should be cached");
+
+    resolver.prefetch("localhost");
+    assert(resolver.pending() == 0 && "Prefetch of a cached host should be a no-op");
+
+    std::cout << "Test Case 2: Merged and cached lookup passed.\n";
+}
+
+// Test Case 3: Failed lookups are cached negatively
+void testNegativeCache() {
+    Resolver resolver;
+    resolver.resolve("thisdomaindoesnotexist.invalid", nullptr);
+    drain(resolver);
+
+    ResolvedHost cached;
+    assert(resolver.lookupCached("thisdomaindoesnotexist.invalid", cached) && "Failure should be cached");
+    assert(!cached.found && "Cached failure should report not found");
+
+    std::cout << "Test Case 3: Negative cache passed.\n";
+}
+
+// Test Case 4: Overrides answer without DNS, including "*.suffix" wildcards
+void testOverrides() {
+    Resolver resolver;
+    assert(resolver.addOverride("fixed.example", "127.0.0.2"));
+    assert(resolver.addOverride("*.synthetic.test", "127.0.0.3"));
+    assert(!resolver.addOverride("bad.example", "not-an-address"));
+
+    ResolvedHost result;
+    assert(resolver.lookupCached("Fixed.Example", result) && result.found);
+    assert(resolver.lookupCached("site7.synthetic.test", result) && result.found);
+    assert(resolver.lookupCached("a.b.synthetic.test", result) && result.found && "Wildcards cover deeper names");
+    assert(!resolver.lookupCached("synthetic.test", result) && "A wildcard does not cover the bare suffix");
+
+    bool called = false;
+    resolver.resolve("site1.synthetic.test", [&](const std::string&, const ResolvedHost& answer) {
+        called = true;
+        assert(answer.found && answer.addresses.size() == 1);
+    });
+    drain(resolver);
+    assert(called && resolver.stats().lookups == 0 && "Overrides never reach the system resolver");
+
+    std::cout << "Test Case 4: Overrides passed.\n";
+}
+
+// Test Case 5: IPv6 literals resolve, and overrides may list several addresses of either family
+void testIpv6AndAddressLists() {
+    Resolver resolver;
+    ResolvedHost result;
+    resolver.resolve("[::1]", [&](const std::string&, const ResolvedHost& answer) { result = answer; });
+    drain(resolver);
+    assert(result.found && result.addresses.size() == 1 && "A bracketed IPv6 literal should resolve");
+    assert(result.addresses[0].addr.ss_family == AF_INET6 && result.addresses[0].length == sizeof(sockaddr_in6));
+
+    assert(resolver.addOverride("dual.example", "2001:db8::1,192.0.2.1,192.0.2.2"));
+    assert(resolver.lookupCached("dual.example", result) && result.addresses.size() == 3);
+    assert(result.addresses[0].addr.ss_family == AF_INET6 && result.addresses[1].addr.ss_family == AF_INET &&
+           "Addresses keep the order they were listed in");
+    assert(!resolver.addOverride("half.example", "192.0.2.1,bogus") && "One bad address rejects the list");
+    assert(!resolver.addOverride("trailing.example", "192.0.2.1,"));
+
+    std::cout << "Test Case 5: IPv6 and address lists passed.\n";
+}
+
+// Test Case 6: Answers with a TTL of 0 are still cached briefly, so the
+// fetches waiting on a lookup find its answer
+void testZeroTtl() {
+    ResolverOptions options;
+    options.minTtlSeconds = 0;
+    options.defaultTtlSeconds = 0;
+    options.negativeTtlSeconds = 0;
+    Resolver resolver(options);
+    resolver.resolve("localhost", nullptr);
+    resolver.resolve("thisdomaindoesnotexist.invalid", nullptr);
+    drain(resolver);
+
+    ResolvedHost cached;
+    assert(resolver.lookupCached("localhost", cached) && cached.found && "A zero TTL answer should still be cached");
+    assert(resolver.lookupCached("thisdomaindoesnotexist.invalid", cached) && !cached.found);
+
+    std::cout << "Test Case 6: Zero TTL passed.\n";
+}
+
+int main() {
+    testNumericHost();
+    testLocalhostMergedAndCached();
+    testNegativeCache();
+    testOverrides();
+    testIpv6AndAddressLists();
+    testZeroTtl();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include "../robots.h"
+
+static const std::string ROBOTS_TXT =
+    "\xEF\xBB\xBF# Example robots.txt\n"
+    "User-agent: *\n"
+    "Disallow: /private/\n"
+    "Allow: /private/open.html\n"
+    "Disallow: /*.pdf$\n"
+    "Disallow: /search*q=\n"
+    "Crawl-delay: 5\n"
+    "\n"
+    "User-agent: OtherBot\n"
+    "Disallow: /\n"
+    "\n"
+    "User-agent: searchengine-crawler\n"
+    "User-agent: friend\n"
+    "Disallow: /tmp\r\n"
+    "Allow: /tmp/keep$   # exact page only\n"
+    "Crawl-delay: 1.5\n"
+    "Sitemap: https://example.com/sitemap.xml\n";
+
+// Helper function to build a fetched robots.txt response
+static Response robotsResponse(int status, const std::string& body, FetchError error = FetchError::None) {
+    Response response;
+    response.header.status = status;
+    response.body = body;
+    response.error = error;
+    return response;
+}
+
+// Test Case 1: The "*" group applies when no group names the agent
+void testWildcardGroup() {
+    RobotsRules rules = RobotsRules::parse(ROBOTS_TXT, "UnknownBot/3.0");
+
+    assert(rules.allowed("/"));
+    assert(!rules.allowed("/private/"));
+    assert(!rules.allowed("/private/data.html"));
+    assert(rules.allowed("/private/open.html") && "The longer Allow wins");
+    assert(!rules.allowed("/files/report.pdf"));
+    assert(rules.allowed("/files/report.pdf?download=1") && "$ anchors the end");
+    assert(!rules.allowed("/search?lang=en&q=test"));
+    assert(rules.allowed("/search?lang=en"));
+    assert(rules.allowed("/robots.txt"));
+    assert(rules.crawlDelay() == 5);
+
+    std::cout << "Test Case 1: Wildcard group passed.\n";
+}
+
+// Test Case 2: A group naming the agent replaces the "*" group
+void testSpecificGroup() {
+    RobotsRules rules = RobotsRules::parse(ROBOTS_TXT, "searchengine-crawler/1.0");
+
+    assert(rules.ruleCount() == 2);
+    assert(rules.allowed("/private/") && "Only the matching group applies");
+    assert(!rules.allowed("/tmp"));
+    assert(!rules.allowed("/tmp/other"));
+    assert(rules.allowed("/tmp/keep"));
+    assert(!rules.allowed("/tmp/keep/more"));
+    assert(rules.crawlDelay() == 1.5);
+
+    RobotsRules other = RobotsRules::parse(ROBOTS_TXT, "otherbot");
+    assert(!other.allowed("/anything") && !other.allowed("/"));
+
+    RobotsRules empty = RobotsRules::parse("User-agent: *\nDisallow:\n", "bot");
+    assert(empty.allowed("/x") && "An empty Disallow allows everything");
+
+    std::cout << "Test Case 2: Specific group passed.\n";
+}
+
+// Test Case 3: URLs wait for their host's robots.txt, which is fetched once
+void testCacheParking() {
+    RobotsCache cache("searchengine-crawler/1.0");
+    std::string robotsUrl;
+
+    assert(cache.check("https://Example.com/a.html", robotsUrl) == RobotsVerdict::Pending);
+    assert(robotsUrl == "https://example.com/robots.txt");
+    assert(cache.check("https://example.com/tmp/x", robotsUrl) == RobotsVerdict::Pending);
+    assert(robotsUrl.empty() && "robots.txt is requested only once");
+    assert(cache.check("http://example.com/b.html", robotsUrl) == RobotsVerdict::Pending);
+    assert(robotsUrl == "http://example.com/robots.txt" && "Each scheme has its own robots.txt");
+
+    std::vector<std::string> released = cache.store("https://example.com/robots.txt", robotsResponse(200, ROBOTS_TXT));
+    assert(released.size() == 1 && released[0] == "https://Example.com/a.html");
+
+    assert(cache.check("https://example.com/c.html", robotsUrl) == RobotsVerdict::Allowed);
+    assert(cache.check("https://example.com/tmp/y", robotsUrl) == RobotsVerdict::Disallowed);
+    assert(cache.check("https://user@EXAMPLE.com/c.html", robotsUrl) == RobotsVerdict::Allowed &&
+           "Credentials and case do not make another host");
+    assert(cache.rulesFor("https://example.com/")->crawlDelay() == 1.5);
+    assert(cache.stats().disallowed == 2 && cache.stats().parked == 3);
+
+    std::cout << "Test Case 3: Cache parking passed.\n";
+}
+
+// Test Case 4: Missing, unreachable and expired robots.txt
+void testFailuresAndExpiry() {
+    RobotsCache cache("bot");
+    std::string robotsUrl;
+    RobotsCache::Clock::time_point now = RobotsCache::Clock::now();
+
+    cache.check("http://missing.com/x", robotsUrl, now);
+    assert(cache.store(robotsUrl, robotsResponse(404, "not found"), now).size() == 1 && "A 404 allows everything");
+
+    cache.check("http://down.com/x", robotsUrl, now);
+    assert(cache.store(robotsUrl, robotsResponse(503, ""), now).empty() && "A 5xx disallows everything");
+    cache.check("http://gone.com/x", robotsUrl, now);
+    assert(cache.store(robotsUrl, robotsResponse(0, "", FetchError::Connect), now).empty());
+
+    assert(cache.check("http://down.com/y", robotsUrl, now) == RobotsVerdict::Disallowed);
+    auto later = now + std::chrono::seconds(ROBOTS_ERROR_TTL_SECONDS + 1);
+    assert(cache.check("http://down.com/y", robotsUrl, later) == RobotsVerdict::Pending && "Failures are retried");
+    assert(cache.check("http://missing.com/y", robotsUrl, later) == RobotsVerdict::Allowed);
+
+    auto expired = now + std::chrono::seconds(ROBOTS_TTL_SECONDS + 1);
+    assert(cache.check("http://missing.com/z", robotsUrl, expired) == RobotsVerdict::Pending);
+    assert(robotsUrl == "http://missing.com/robots.txt");
+
+    std::cout << "Test Case 4: Failures and expiry passed.\n";
+}
+
+int main() {
+    testWildcardGroup();
+    testSpecificGroup();
+    testCacheParking();
+    testFailuresAndExpiry();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
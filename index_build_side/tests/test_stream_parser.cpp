@@ -0,0 +1,151 @@
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <vector>
+#include "../parser.h"
+
+// Helper function to run a page through HtmlStreamParser in pieces of the given size
+static ParsedData parseInPieces(const std::string& url, const std::string& html, size_t pieceSize) {
+    ParsedData data;
+    data.url = url;
+    HtmlStreamParser parser(url,
+        [&data](std::string&& word) { data.words.push_back(std::move(word)); },
+        [&data](const std::string& link) { data.links.push_back(link); });
+    for (size_t offset = 0; offset < html.size(); offset += pieceSize) {
+        size_t size = std::min(pieceSize, html.size() - offset);
+        parser.feed(html.data() + offset, size);
+    }
+    parser.finish();
+    return data;
+}
+
+static const std::string PAGE = R"(
+    <html>
+        <head><title>Fish &amp; Chips</title></head>
+        <body>
+            <h1>Caf&eacute; &lt;menu&gt;</h1>
+            <p>Cod&nbsp;and haddock &#38; more, &unknown; entities stay.</p>
+            <a href="/menu.html">Menu</a>
+            <a href='https://other.example.com/page'>Elsewhere</a>
+            <a href="contact.html">Contact</a>
+        </body>
+    </html>
+)";
+
+// Test Case 1: Feeding a page in one piece matches parseHTML
+void testSinglePiece() {
+    ParsedData expected = parseHTML("https://www.example.com/dir/", PAGE);
+    ParsedData streamed = parseInPieces("https://www.example.com/dir/", PAGE, PAGE.size());
+
+    assert(!expected.words.empty() && expected.links.size() == 3);
+    assert(streamed.words == expected.words);
+    assert(streamed.links == expected.links);
+
+    std::cout << "Test Case 1: Single piece passed.\n";
+}
+
+// Test Case 2: Tags, entities and words split across pieces come out whole
+void testEveryPieceSize() {
+    ParsedData expected = parseHTML("https://www.example.com/dir/", PAGE);
+    for (size_t pieceSize = 1; pieceSize <= 16; ++pieceSize) {
+        ParsedData streamed = parseInPieces("https://www.example.com/dir/", PAGE, pieceSize);
+        assert(streamed.words == expected.words && "Words should not depend on how the body is split");
+        assert(streamed.links == expected.links && "Links should not depend on how the body is split");
+    }
+
+    std::cout << "Test Case 2: Every piece size passed.\n";
+}
+
+// Test Case 3: Links are reported before the page has finished arriving
+void testEarlyLinks() {
+    std::vector<std::string> links;
+    HtmlStreamParser parser("http://example.com/",
+        [](std::string&&) {},
+        [&links](const std::string& link) { links.push_back(link); });
+
+    std::string head = "<p>start</p><a href=\"/next.html\">next</a>";
+    parser.feed(head.data(), head.size());
+    assert(links.size() == 1 && links[0] == "https://example.com/next.html");
+
+    std::string tail = "<p>rest of the page</p>";
+    parser.feed(tail.data(), tail.size());
+    parser.finish();
+    assert(links.size() == 1);
+
+    std::cout << "Test Case 3: Early links passed.\n";
+}
+
+// Test Case 4: Relative links keep the page's explicit port (and with it the scheme)
+void testExplicitPort() {
+    std::string page = "<a href=\"/next.html\">next</a><a class=x HREF='up.html'>up</a>"
+                       "<a href=//cdn.example.com/lib>cdn</a><a hreflang=en>none</a>";
+    ParsedData parsed = parseHTML("http://example.com:8080/dir/", page);
+    assert(parsed.links.size() == 3);
+    assert(parsed.links[0] == "http://example.com:8080/next.html");
+    assert(parsed.links[1] == "http://example.com:8080/up.html" && "Attribute names are case-insensitive");
+    assert(parsed.links[2] == "http://cdn.example.com/lib" && "Protocol-relative links name their own host");
+
+    std::cout << "Test Case 4: Explicit port passed.\n";
+}
+
+static const std::string MARKUP_PAGE = R"(<!DOCTYPE html>
+    <html><head>
+        <style>body { font-family: sans-serif } p > a { color: red }</style>
+        <script>if (a < b && c > d) { document.write("<p>hidden</p>"); } // </scripty></script>
+        <SCRIPT type="text/javascript">var s = '</style>';</SCRIPT >
+    </head><body>
+        <!-- a comment with <tags> and -- dashes -->
+        <p title="x > y">visible</p>
+        <![CDATA[cdata text]]>
+        <?xml-stylesheet href="s.css"?>
+        <!---->after
+        <a HREF="/next.html" title='a > b'>link</a>
+        price a < b
+    </body></html>
+)";
+
+// Test Case 5: Script, style, comments and other markup never reach the word stream
+void testMarkup() {
+    ParsedData parsed = parseHTML("https://www.example.com/", MARKUP_PAGE);
+    std::vector<std::string> words = {"visible", "cdata", "text", "after", "link", "price", "a", "b"};
+    assert(parsed.words == words);
+    assert(parsed.links == std::vector<std::string>({"https://www.example.com/next.html"}) &&
+           "A quoted '>' does not end the anchor");
+
+    for (size_t pieceSize = 1; pieceSize <= 16; ++pieceSize) {
+        ParsedData streamed = parseInPieces("https://www.example.com/", MARKUP_PAGE, pieceSize);
+        assert(streamed.words == words && "Terminators split across pieces should still be found");
+        assert(streamed.links == parsed.links);
+    }
+
+    std::cout << "Test Case 5: Markup passed.\n";
+}
+
+// Test Case 6: Entities are decoded and words lowercased in the same pass,
+// across pieces; legacy names need no ';', a tag ends a reference, and
+// anything else that is not a whole entity stays plain text
+void testFusedText() {
+    std::string page = "Fish&amp;CHIPS &lt;B&gt;old&gt &a<b>mp;Mixed</b>Case &amp<i>x</i> &amp&am";
+    std::vector<std::string> words = {"fish", "chips", "b", "old", "amp", "mixedcase", "x", "am"};
+    assert(parseHTML("https://example.com/", page).words == words);
+    for (size_t pieceSize = 1; pieceSize <= page.size(); ++pieceSize) {
+        assert(parseInPieces("https://example.com/", page, pieceSize).words == words);
+    }
+    std::vector<std::string> split = {"amp"};
+    assert(parseHTML("https://example.com/", "&am<b>p;").words == split && "A reference must not span a tag");
+
+    std::cout << "Test Case 6: Fused text pass passed.\n";
+}
+
+int main() {
+    testSinglePiece();
+    testEveryPieceSize();
+    testEarlyLinks();
+    testExplicitPort();
+    testMarkup();
+    testFusedText();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
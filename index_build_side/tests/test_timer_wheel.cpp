@@ -0,0 +1,114 @@
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "../timer_wheel.h"
+
+using std::chrono::milliseconds;
+
+// Test Case 1: Timers fire once their deadline has passed, not before
+void testExpiry() {
+    TimerWheel::Clock::time_point start = TimerWheel::Clock::now();
+    TimerWheel wheel(10, 64, start);
+    wheel.schedule(start + milliseconds(25), 1);
+    wheel.schedule(start + milliseconds(40), 2);
+    wheel.schedule(start + milliseconds(40), 3);
+    assert(wheel.size() == 3);
+
+    std::vector<uint64_t> keys;
+    wheel.expire(start + milliseconds(20), keys);
+    assert(keys.empty() && "Nothing is due yet");
+    wheel.expire(start + milliseconds(30), keys);
+    assert(keys.size() == 1 && keys[0] == 1 && "Deadlines round up to the next tick");
+
+    keys.clear();
+    wheel.expire(start + milliseconds(45), keys);
+    std::sort(keys.begin(), keys.end());
+    assert(keys == std::vector<uint64_t>({2, 3}) && "Timers sharing a slot fire together");
+    assert(wheel.size() == 0);
+
+    std::cout << "Test Case 1: Expiry passed.\n";
+}
+
+// Test Case 2: Cancelled timers never fire, and stale ids are harmless
+void testCancel() {
+    TimerWheel::Clock::time_point start = TimerWheel::Clock::now();
+    TimerWheel wheel(10, 64, start);
+    TimerWheel::TimerId first = wheel.schedule(start + milliseconds(50), 1);
+    wheel.schedule(start + milliseconds(50), 2);
+    wheel.cancel(first);
+    assert(wheel.size() == 1);
+
+    // The freed entry is reused; the old id must not cancel its new owner
+    wheel.schedule(start + milliseconds(50), 3);
+    wheel.cancel(first);
+    wheel.cancel(0);
+    assert(wheel.size() == 2);
+
+    std::vector<uint64_t> keys;
+    wheel.expire(start + milliseconds(60), keys);
+    std::sort(keys.begin(), keys.end());
+    assert(keys == std::vector<uint64_t>({2, 3}));
+
+    std::cout << "Test Case 2: Cancel passed.\n";
+}
+
+// Test Case 3: Deadlines beyond one turn of the wheel wait for their own turn
+void testLaterTurns() {
+    TimerWheel::Clock::time_point start = TimerWheel::Clock::now();
+    TimerWheel wheel(10, 8, start); // One turn is 80 ms
+    wheel.schedule(start + milliseconds(30), 1);
+    wheel.schedule(start + milliseconds(110), 2); // Same slot, next turn
+
+    std::vector<uint64_t> keys;
+    wheel.expire(start + milliseconds(35), keys);
+    assert(keys == std::vector<uint64_t>({1}) && "A later turn's timer stays in its slot");
+    wheel.expire(start + milliseconds(100), keys);
+    assert(keys.size() == 1);
+    wheel.expire(start + milliseconds(115), keys);
+    assert(keys == std::vector<uint64_t>({1, 2}));
+
+    // A long pause fires everything overdue in one pass
+    wheel.schedule(start + milliseconds(200), 3);
+    wheel.schedule(start + milliseconds(900), 4);
+    keys.clear();
+    wheel.expire(start + milliseconds(5000), keys);
+    std::sort(keys.begin(), keys.end());
+    assert(keys == std::vector<uint64_t>({3, 4}));
+
+    std::cout << "Test Case 3: Later turns passed.\n";
+}
+
+// Test Case 4: The wait until the next timer bounds an event loop's sleep
+void testNextDeadline() {
+    TimerWheel::Clock::time_point start = TimerWheel::Clock::now();
+    TimerWheel wheel(10, 64, start);
+    assert(wheel.msUntilNext(start) == -1 && "No timers, no deadline");
+
+    wheel.schedule(start + milliseconds(100), 1);
+    wheel.schedule(start + milliseconds(300), 2);
+    assert(wheel.msUntilNext(start) == 100);
+    assert(wheel.msUntilNext(start + milliseconds(60)) == 40);
+    assert(wheel.msUntilNext(start + milliseconds(150)) == 0 && "An overdue timer wants no wait");
+
+    // A deadline already passed still fires, on the next tick
+    std::vector<uint64_t> keys;
+    wheel.expire(start + milliseconds(150), keys);
+    wheel.schedule(start, 3);
+    wheel.expire(start + milliseconds(160), keys);
+    assert(keys == std::vector<uint64_t>({1, 3}));
+
+    std::cout << "Test Case 4: Next deadline passed.\n";
+}
+
+// Main function to run all test cases
+int main() {
+    testExpiry();
+    testCancel();
+    testLaterTurns();
+    testNextDeadline();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include "../parser.h"
+#include "../token_arena.h"
+
+// Test Case 1: Stored tokens keep their bytes while the arena grows
+void testStore() {
+    TokenArena arena(64);
+    std::vector<std::string> expected;
+    std::vector<std::string_view> stored;
+    for (int i = 0; i < 2000; ++i) {
+        expected.push_back("token" + std::to_string(i));
+        stored.push_back(arena.store(expected.back()));
+    }
+    std::string big(100000, 'x');
+    std::string_view bigView = arena.store(big);
+    assert(bigView == big && "A token larger than a block gets its own");
+    for (size_t i = 0; i < expected.size(); ++i) {
+        assert(stored[i] == expected[i] && "Earlier tokens are never moved");
+    }
+    assert(arena.store("").empty());
+    size_t total = big.size();
+    for (const std::string& token : expected) total += token.size();
+    assert(arena.used() == total);
+
+    std::cout << "Test Case 1: Store passed.\n";
+}
+
+// Test Case 2: A reset arena reuses its blocks instead of allocating more
+void testReset() {
+    TokenArena arena(64);
+    for (int i = 0; i < 1000; ++i) arena.store("some words of a page");
+    size_t capacity = arena.capacity();
+
+    for (int round = 0; round < 10; ++round) {
+        arena.reset();
+        assert(arena.used() == 0);
+        for (int i = 0; i < 1000; ++i) {
+            assert(arena.store("some words of a page") == "some words of a page");
+        }
+        assert(arena.capacity() == capacity && "The same tokens fit in the same blocks");
+    }
+
+    std::cout << "Test Case 2: Reset passed.\n";
+}
+
+// Test Case 3: The arena-backed parseHTML gives the same tokens as the string one
+void testParsedPage() {
+    std::string html = "<html><head><title>Fish &amp; Chips</title></head><body>"
+                       "<p>An Extraordinarily-long-hyphenated word list</p>"
+                       "<a href=\"/menu.html\">Menu</a><a href='https://other.example.com/x'>Away</a>"
+                       "</body></html>";
+    ParsedData expected = parseHTML("https://example.com/", html);
+
+    TokenArena arena;
+    ParsedPage page;
+    for (int round = 0; round < 3; ++round) {
+        arena.reset();
+        parseHTML("https://example.com/", html, arena, page);
+        assert(page.url == expected.url);
+        assert(page.words.size() == expected.words.size() && page.links.size() == expected.links.size());
+        for (size_t i = 0; i < page.words.size(); ++i) assert(page.words[i] == expected.words[i]);
+        for (size_t i = 0; i < page.links.size(); ++i) assert(page.links[i] == expected.links[i]);
+    }
+    assert(page.links[0] == "https://example.com/menu.html");
+
+    std::cout << "Test Case 3: Arena-backed page passed.\n";
+}
+
+// Main function to run all test cases
+int main() {
+    testStore();
+    testReset();
+    testParsedPage();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
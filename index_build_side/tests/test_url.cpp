@@ -0,0 +1,80 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include "../url.h"
+
+// Test Case 1: Every component of a full URL is found
+void testComponents() {
+    UrlParts parts;
+    assert(parseUrl("https://user:pw@Example.com:8080/a/b?q=1&r=2#top", parts));
+    assert(parts.scheme == "https");
+    assert(parts.host == "Example.com" && "Userinfo is not part of the host");
+    assert(parts.port == "8080" && parts.portNumber == 8080);
+    assert(parts.path == "/a/b");
+    assert(parts.hasQuery && parts.query == "q=1&r=2");
+    assert(parts.fragment == "top");
+
+    assert(parseUrl("http://example.com", parts));
+    assert(parts.host == "example.com" && parts.path.empty() && !parts.hasQuery && parts.portNumber == 80);
+
+    assert(parseUrl("HTTPS://example.com?x#y?z", parts));
+    assert(parts.portNumber == 443 && "Schemes are case-insensitive");
+    assert(parts.path.empty() && parts.query == "x" && parts.fragment == "y?z");
+
+    assert(parseUrl("example.com/a", parts) && parts.scheme.empty() && parts.host == "example.com");
+
+    std::cout << "Test Case 1: Components passed.\n";
+}
+
+// Test Case 2: Ports are split from the host, IPv6 literals included, and checked
+void testPorts() {
+    UrlParts parts;
+    assert(parseUrl("http://[::1]:8443/x", parts) && parts.host == "[::1]" && parts.portNumber == 8443);
+    assert(parseUrl("https://[2001:db8::1]/", parts) && parts.host == "[2001:db8::1]" && parts.portNumber == 443);
+    assert(parseUrl("http://host:/", parts) && parts.portNumber == 80 && "An empty port is the default");
+
+    assert(!parseUrl("http://host:0/", parts));
+    assert(!parseUrl("http://host:65536/", parts));
+    assert(!parseUrl("http://host:80a/", parts));
+    assert(!parseUrl("http:///path", parts) && "A URL needs a host");
+
+    std::cout << "Test Case 2: Ports passed.\n";
+}
+
+// Helper function to build the request target of a URL
+static std::string requestTarget(const std::string& url) {
+    UrlParts parts;
+    std::string target;
+    parseUrl(url, parts);
+    appendRequestTarget(parts, target);
+    return target;
+}
+
+// Test Case 3: The request target keeps the path and query and drops the fragment
+void testRequestTarget() {
+    assert(requestTarget("http://host.example:8080/a/b?q=1#frag") == "/a/b?q=1");
+    assert(requestTarget("https://host.example?x=1") == "/?x=1");
+    assert(requestTarget("https://host.example") == "/");
+    assert(requestTarget("https://host.example//a") == "/a" && "Leading slashes collapse to one");
+
+    std::cout << "Test Case 3: Request target passed.\n";
+}
+
+// Test Case 4: Case is ignored on both sides of a comparison
+void testEqualsIgnoreCase() {
+    assert(equalsIgnoreCase("HTTPS", "https") && equalsIgnoreCase("content-type", "Content-Type"));
+    assert(!equalsIgnoreCase("http", "https") && !equalsIgnoreCase("http", "htt1"));
+
+    std::cout << "Test Case 4: Case-insensitive comparison passed.\n";
+}
+
+// Main function to run all test cases
+int main() {
+    testComponents();
+    testPorts();
+    testRequestTarget();
+    testEqualsIgnoreCase();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
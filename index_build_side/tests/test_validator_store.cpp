@@ -0,0 +1,82 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include "../validator_store.h"
+
+// Helper function to build a response header carrying validators
+static ResponseHeader headerWith(int status, const std::string& etag, const std::string& lastModified) {
+    ResponseHeader header;
+    header.status = status;
+    header.etag = etag;
+    header.lastModified = lastModified;
+    return header;
+}
+
+// Test Case 1: Validators of a 200 response are remembered per URL
+void testRecordAndLookup() {
+    ValidatorStore store;
+    store.record("http://example.com/a", headerWith(200, "\"v1\"", "Tue, 15 Nov 1994 12:45:26 GMT"));
+    store.record("http://example.com/b", headerWith(200, "", "Wed, 16 Nov 1994 08:00:00 GMT"));
+
+    Validators validators;
+    assert(store.lookup("http://example.com/a", validators));
+    assert(validators.etag == "\"v1\"" && validators.lastModified == "Tue, 15 Nov 1994 12:45:26 GMT");
+    assert(store.lookup("http://example.com/b", validators));
+    assert(validators.etag.empty() && "A missing ETag should stay empty");
+    assert(!store.lookup("http://example.com/c", validators) && "Unknown URLs have no validators");
+
+    std::cout << "Test Case 1: Record and lookup passed.\n";
+}
+
+// Test Case 2: Entries are replaced or dropped as pages change
+void testUpdates() {
+    ValidatorStore store;
+    Validators validators;
+    store.record("http://example.com/a", headerWith(200, "\"v1\"", ""));
+
+    store.record("http://example.com/a", headerWith(304, "", ""));
+    assert(store.lookup("http://example.com/a", validators) && "304 keeps the stored validators");
+
+    store.record("http://example.com/a", headerWith(200, "\"v2\"", ""));
+    assert(store.lookup("http://example.com/a", validators) && validators.etag == "\"v2\"");
+
+    store.record("http://example.com/a", headerWith(200, "", ""));
+    assert(!store.lookup("http://example.com/a", validators) && "A 200 without validators drops the entry");
+
+    store.record("http://example.com/b", headerWith(200, "\"x\"", ""));
+    store.record("http://example.com/b", headerWith(404, "", ""));
+    assert(store.size() == 0 && "Gone pages should be forgotten");
+
+    std::cout << "Test Case 2: Updates passed.\n";
+}
+
+// Test Case 3: The store survives a save / load round trip
+void testPersistence() {
+    const std::string path = "test_validators.txt";
+    ValidatorStore store;
+    store.record("http://example.com/a", headerWith(200, "W/\"weak\"", "Tue, 15 Nov 1994 12:45:26 GMT"));
+    store.record("https://example.com/b?q=1", headerWith(200, "\"b\"", ""));
+    assert(store.save(path));
+
+    ValidatorStore loaded;
+    assert(loaded.load(path));
+    std::remove(path.c_str());
+
+    Validators validators;
+    assert(loaded.size() == 2 && loaded.urls().size() == 2);
+    assert(loaded.lookup("http://example.com/a", validators) && validators.etag == "W/\"weak\"");
+    assert(validators.lastModified == "Tue, 15 Nov 1994 12:45:26 GMT");
+    assert(loaded.lookup("https://example.com/b?q=1", validators) && validators.lastModified.empty());
+
+    std::cout << "Test Case 3: Persistence passed.\n";
+}
+
+int main() {
+    testRecordAndLookup();
+    testUpdates();
+    testPersistence();
+
+    std::cout << "All test cases passed successfully.\n";
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include "timer_wheel.h"
+
+#include <algorithm>
+
+// End of a slot's list
+#define NO_TIMER 0xffffffffu
+
+TimerWheel::TimerWheel(int tickMs, size_t slots, Clock::time_point start)
+    : start_(start), tick_(std::chrono::milliseconds(std::max(tickMs, 1))), slots_(std::max<size_t>(slots, 1), NO_TIMER) {}
+
+// Whole ticks elapsed between the start of the wheel and time
+uint64_t TimerWheel::tickAt(Clock::time_point time) const {
+    if (time <= start_) return 0;
+    return static_cast<uint64_t>((time - start_) / tick_);
+}
+
+TimerWheel::TimerId TimerWheel::schedule(Clock::time_point deadline, uint64_t key) {
+    uint64_t tick = tickAt(deadline);
+    if (start_ + tick * tick_ < deadline) ++tick;
+    // A deadline already passed fires on the next tick, never on one expire() has handled
+    tick = std::max(tick, current_ + 1);
+
+    uint32_t index;
+    if (!free_.empty()) {
+        index = free_.back();
+        free_.pop_back();
+    } else {
+        index = static_cast<uint32_t>(timers_.size());
+        timers_.emplace_back();
+    }
+    Timer& timer = timers_[index];
+    timer.key = key;
+    timer.tick = tick;
+    timer.live = true;
+
+    uint32_t& head = slots_[tick % slots_.size()];
+    timer.prev = NO_TIMER;
+    timer.next = head;
+    if (head != NO_TIMER) timers_[head].prev = index;
+    head = index;
+    ++size_;
+    return (static_cast<uint64_t>(timer.generation) << 32) | index;
+}
+
+// Take a timer out of its slot and recycle its entry
+void TimerWheel::unlink(uint32_t index) {
+    Timer& timer = timers_[index];
+    if (timer.prev != NO_TIMER) {
+        timers_[timer.prev].next = timer.next;
+    } else {
+        slots_[timer.tick % slots_.size()] = timer.next;
+    }
+    if (timer.next != NO_TIMER) timers_[timer.next].prev = timer.prev;
+
+    timer.live = false;
+    ++timer.generation;
+    free_.push_back(index);
+    --size_;
+}
+
+void TimerWheel::cancel(TimerId id) {
+    uint32_t index = static_cast<uint32_t>(id & 0xffffffffu);
+    uint32_t generation = static_cast<uint32_t>(id >> 32);
+    if (index < timers_.size() && timers_[index].live && timers_[index].generation == generation) {
+        unlink(index);
+    }
+}
+
+void TimerWheel::expire(Clock::time_point now, std::vector<uint64_t>& keys) {
+    uint64_t target = tickAt(now);
+    if (target <= current_) return;
+
+    // After a long pause every slot is visited once, not once per missed turn
+    uint64_t steps = std::min<uint64_t>(target - current_, slots_.size());
+    for (uint64_t tick = current_ + 1; tick <= current_ + steps; ++tick) {
+        uint32_t index = slots_[tick % slots_.size()];
+        while (index != NO_TIMER) {
+            uint32_t next = timers_[index].next;
+            if (timers_[index].tick <= target) {
+                keys.push_back(timers_[index].key);
+                unlink(index);
+            }
+            index = next;
+        }
+    }
+    current_ = target;
+}
+
+int TimerWheel::msUntilNext(Clock::time_point now) const {
+    if (size_ == 0) return -1;
+    // The first occupied slot may only hold timers of a later turn; waking
+    // early for those costs one extra pass, never a late expiry
+    for (uint64_t tick = current_ + 1; tick <= current_ + slots_.size(); ++tick) {
+        if (slots_[tick % slots_.size()] == NO_TIMER) continue;
+        Clock::time_point due = start_ + tick * tick_;
+        if (due <= now) return 0;
+        auto wait = std::chrono::ceil<std::chrono::milliseconds>(due - now);
+        return static_cast<int>(wait.count());
+    }
+    return -1;
+}
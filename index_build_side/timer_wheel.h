@@ -0,0 +1,59 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Hashed timing wheel: timers hang in a ring of slots, one per tick, so
+// scheduling and cancelling cost O(1) however many timers are pending.
+// Deadlines further out than one turn of the wheel stay in their slot and
+// are skipped until the turn they are due in.
+//
+// Timers carry an opaque 64-bit key that expire() hands back; the wheel
+// never calls out, so the owner decides what an expiry means.
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimerId = uint64_t; // 0 never names a timer
+
+    explicit TimerWheel(int tickMs = 10, size_t slots = 1024, Clock::time_point start = Clock::now());
+
+    // Fire key at deadline, rounded up to the next tick
+    TimerId schedule(Clock::time_point deadline, uint64_t key);
+
+    // Drop a pending timer; ids of timers that fired or were cancelled are ignored
+    void cancel(TimerId id);
+
+    // Turn the wheel to now and append the keys of every timer that is due
+    void expire(Clock::time_point now, std::vector<uint64_t>& keys);
+
+    // Milliseconds until the next timer may be due: 0 if one is, -1 if none is pending
+    int msUntilNext(Clock::time_point now) const;
+
+    size_t size() const { return size_; }
+
+private:
+    struct Timer {
+        uint64_t key = 0;
+        uint64_t tick = 0;       // Tick the timer is due at
+        uint32_t generation = 1; // Bumped on reuse, so stale ids miss
+        uint32_t prev = 0;
+        uint32_t next = 0;
+        bool live = false;
+    };
+
+    uint64_t tickAt(Clock::time_point time) const;
+    void unlink(uint32_t index);
+
+    Clock::time_point start_;
+    Clock::duration tick_;
+    uint64_t current_ = 0;            // Last tick expire() has handled
+    std::vector<uint32_t> slots_;     // First timer in each slot
+    std::vector<Timer> timers_;
+    std::vector<uint32_t> free_;      // Unused entries of timers_
+    size_t size_ = 0;
+};
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,165 @@
+#include "tls_context.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <openssl/ssl.h>
+
+// Upper bound on hosts with cached sessions, and on tickets kept per host
+#define MAX_SESSION_HOSTS 4096
+#define MAX_SESSIONS_PER_HOST 4
+
+// Store of resumable sessions keyed by "host:port": servers on other ports
+// of the same host are other servers, with keys of their own. TLS 1.3
+// tickets are single use, so they are handed out once; TLS 1.2 sessions
+// stay until replaced.
+class SessionCache {
+public:
+    ~SessionCache() {
+        for (auto& entry : sessions_) {
+            for (SSL_SESSION* session : entry.second) SSL_SESSION_free(session);
+        }
+    }
+
+    void store(const std::string& key, SSL_SESSION* session) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = sessions_.find(key);
+        if (it == sessions_.end()) {
+            if (sessions_.size() >= MAX_SESSION_HOSTS) evictOldest();
+            it = sessions_.emplace(key, std::deque<SSL_SESSION*>()).first;
+            order_.push_back(key);
+        }
+
+        std::deque<SSL_SESSION*>& list = it->second;
+        list.push_back(session);
+        if (list.size() > MAX_SESSIONS_PER_HOST) {
+            SSL_SESSION_free(list.front());
+            list.pop_front();
+        }
+    }
+
+    // Returns a session reference owned by the caller, or nullptr
+    SSL_SESSION* take(const std::string& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = sessions_.find(key);
+        if (it == sessions_.end()) return nullptr;
+
+        std::deque<SSL_SESSION*>& list = it->second;
+        while (!list.empty()) {
+            SSL_SESSION* session = list.back();
+            if (!SSL_SESSION_is_resumable(session)) {
+                list.pop_back();
+                SSL_SESSION_free(session);
+                continue;
+            }
+            if (SSL_SESSION_get_protocol_version(session) >= TLS1_3_VERSION) {
+                list.pop_back();
+                return session;
+            }
+            SSL_SESSION_up_ref(session);
+            return session;
+        }
+        return nullptr;
+    }
+
+private:
+    void evictOldest() {
+        while (!order_.empty()) {
+            auto it = sessions_.find(order_.front());
+            order_.pop_front();
+            if (it == sessions_.end()) continue;
+            for (SSL_SESSION* session : it->second) SSL_SESSION_free(session);
+            sessions_.erase(it);
+            return;
+        }
+    }
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::deque<SSL_SESSION*>> sessions_;
+    std::deque<std::string> order_; // Insertion order of keys for eviction
+};
+
+static SessionCache sessionCache;
+static std::atomic<unsigned long> fullHandshakes{0};
+static std::atomic<unsigned long> resumedHandshakes{0};
+static std::atomic<unsigned long> sessionsCached{0};
+
+// Helper function to free a connection's cache key along with it
+static void freeSessionKey(void*, void* key, CRYPTO_EX_DATA*, int, long, void*) {
+    delete static_cast<std::string*>(key);
+}
+
+// Index of the per-connection slot holding its "host:port" cache key
+static int sessionKeyIndex() {
+    static int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, freeSessionKey);
+    return index;
+}
+
+// OpenSSL calls this for every new session, including TLS 1.3 tickets that
+// arrive after the handshake. Returning 1 keeps the reference we were given.
+static int onNewSession(SSL* ssl, SSL_SESSION* session) {
+    const std::string* key = static_cast<const std::string*>(SSL_get_ex_data(ssl, sessionKeyIndex()));
+    if (!key) return 0;
+    sessionCache.store(*key, session);
+    ++sessionsCached;
+    return 1;
+}
+
+static SSL_CTX* createClientContext() {
+    SSL_CTX* ctx = SSL_CTX_new(TLS_client_method());
+    if (!ctx) return nullptr;
+
+#ifdef SSL_OP_IGNORE_UNEXPECTED_EOF
+    // Many servers close without a close_notify alert
+    SSL_CTX_set_options(ctx, SSL_OP_IGNORE_UNEXPECTED_EOF);
+#endif
+    // Peers are not authenticated (see tls_context.h); said here rather than left to the default
+    SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, nullptr);
+    // Sessions live in our per-host cache instead of OpenSSL's internal one
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ctx, onNewSession);
+    return ctx;
+}
+
+ssl_ctx_st* sharedClientContext() {
+    static SSL_CTX* ctx = createClientContext();
+    return ctx;
+}
+
+ssl_st* newClientConnection(const std::string& hostname, int port) {
+    SSL_CTX* ctx = sharedClientContext();
+    if (!ctx) return nullptr;
+
+    SSL* ssl = SSL_new(ctx);
+    if (!ssl) return nullptr;
+
+    // SNI carries names only; an IPv6 literal ("[::1]") is not one
+    if (hostname.empty() || hostname.front() != '[') {
+        SSL_set_tlsext_host_name(ssl, hostname.c_str());
+    }
+    // The key goes with the connection, so a literal without SNI is cached too
+    std::string* key = new std::string(hostname + ":" + std::to_string(port));
+    SSL_set_ex_data(ssl, sessionKeyIndex(), key);
+    if (SSL_SESSION* session = sessionCache.take(*key)) {
+        SSL_set_session(ssl, session);
+        SSL_SESSION_free(session);
+    }
+    return ssl;
+}
+
+void recordHandshake(ssl_st* ssl) {
+    if (SSL_session_reused(ssl)) {
+        ++resumedHandshakes;
+    } else {
+        ++fullHandshakes;
+    }
+}
+
+TlsStats tlsStats() {
+    TlsStats stats;
+    stats.fullHandshakes = fullHandshakes;
+    stats.resumedHandshakes = resumedHandshakes;
+    stats.sessionsCached = sessionsCached;
+    return stats;
+}
@@ -0,0 +1,34 @@
+#ifndef TLS_CONTEXT_H
+#define TLS_CONTEXT_H
+
+#include <string>
+
+struct ssl_ctx_st;
+struct ssl_st;
+
+// Counters describing how client TLS handshakes completed
+struct TlsStats {
+    unsigned long fullHandshakes = 0;    // Handshakes that negotiated new keys
+    unsigned long resumedHandshakes = 0; // Handshakes that resumed a cached session
+    unsigned long sessionsCached = 0;    // Sessions / TLS 1.3 tickets received from servers
+};
+
+// Process-wide client context, created on first use and shared by every
+// download so its options and the session cache are set up once.
+// Server certificates are NOT verified: no trust store is loaded and the
+// peer's name is not checked, so a connection is encrypted but not
+// authenticated. That is enough to read public pages, not to trust them.
+ssl_ctx_st* sharedClientContext();
+
+// Create a client connection for hostname (with SNI), offering a session
+// cached for the same hostname and port so the handshake can be resumed
+// instead of run in full.
+ssl_st* newClientConnection(const std::string& hostname, int port);
+
+// Count a completed handshake as resumed or full
+void recordHandshake(ssl_st* ssl);
+
+// Snapshot of the handshake counters
+TlsStats tlsStats();
+
+#endif // TLS_CONTEXT_H
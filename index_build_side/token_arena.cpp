@@ -0,0 +1,46 @@
+#include "token_arena.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Blocks double from the first size up to this; a token longer than a
+// block gets a block of its own
+#define MAX_BLOCK_SIZE 65536
+
+TokenArena::TokenArena(size_t firstBlockSize) : firstBlockSize_(std::max<size_t>(firstBlockSize, 64)) {}
+
+std::string_view TokenArena::store(std::string_view token) {
+    if (token.empty()) return std::string_view();
+
+    // Move on to the next block (reused after a reset, or a new one) until the token fits
+    while (current_ >= blocks_.size() || blocks_[current_].size - offset_ < token.size()) {
+        if (current_ < blocks_.size()) {
+            ++current_;
+            offset_ = 0;
+            if (current_ < blocks_.size()) continue;
+        }
+        size_t size = blocks_.empty() ? firstBlockSize_ : std::min<size_t>(blocks_.back().size * 2, MAX_BLOCK_SIZE);
+        size = std::max(size, token.size());
+        blocks_.push_back(Block{std::unique_ptr<char[]>(new char[size]), size});
+        current_ = blocks_.size() - 1;
+        offset_ = 0;
+    }
+
+    char* out = blocks_[current_].data.get() + offset_;
+    std::memcpy(out, token.data(), token.size());
+    offset_ += token.size();
+    used_ += token.size();
+    return std::string_view(out, token.size());
+}
+
+void TokenArena::reset() {
+    current_ = 0;
+    offset_ = 0;
+    used_ = 0;
+}
+
+size_t TokenArena::capacity() const {
+    size_t total = 0;
+    for (const Block& block : blocks_) total += block.size;
+    return total;
+}
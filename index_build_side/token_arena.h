@@ -0,0 +1,46 @@
+#ifndef TOKEN_ARENA_H
+#define TOKEN_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Bump allocator for the words and links of a page: tokens are copied
+// back to back into large blocks and handed out as string_views, so a page
+// costs a handful of block allocations instead of one per token.
+//
+// Nothing is freed token by token. reset() drops every token at once and
+// keeps the blocks, so an arena reused for page after page stops
+// allocating once it has grown to the largest page.
+class TokenArena {
+public:
+    explicit TokenArena(size_t firstBlockSize = 4096);
+
+    TokenArena(const TokenArena&) = delete;
+    TokenArena& operator=(const TokenArena&) = delete;
+
+    // Copy a token into the arena; the view stays valid until reset()
+    std::string_view store(std::string_view token);
+
+    // Forget every token stored so far, keeping the memory for the next ones
+    void reset();
+
+    // Bytes of tokens stored since the last reset, and bytes held in blocks
+    size_t used() const { return used_; }
+    size_t capacity() const;
+
+private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size = 0;
+    };
+
+    std::vector<Block> blocks_;
+    size_t current_ = 0;  // Block being filled
+    size_t offset_ = 0;   // Bytes used in it
+    size_t used_ = 0;
+    size_t firstBlockSize_;
+};
+
+#endif // TOKEN_ARENA_H
@@ -0,0 +1,105 @@
+#include "url.h"
+
+// ASCII only, so URLs parse the same whatever the locale
+static bool isAlpha(char ch) {
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+}
+
+static char lowerAscii(char ch) {
+    return (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch;
+}
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (lowerAscii(a[i]) != lowerAscii(b[i])) return false;
+    }
+    return true;
+}
+
+// Helper function to measure a "scheme://" prefix (RFC 3986 section 3.1).
+// Returns the length of the scheme, or 0 when the URL does not start with one.
+static size_t schemeLength(std::string_view url) {
+    if (url.empty() || !isAlpha(url[0])) return 0;
+    size_t i = 1;
+    while (i < url.size()) {
+        char ch = url[i];
+        if (!isAlpha(ch) && !(ch >= '0' && ch <= '9') && ch != '+' && ch != '-' && ch != '.') break;
+        ++i;
+    }
+    return url.compare(i, 3, "://") == 0 ? i : 0;
+}
+
+bool parseUrl(std::string_view url, UrlParts& parts) {
+    parts = UrlParts();
+
+    size_t offset = schemeLength(url);
+    if (offset > 0) {
+        parts.scheme = url.substr(0, offset);
+        offset += 3;
+    }
+
+    // The authority runs to the first '/', '?' or '#'; the rest splits the same way
+    size_t end = offset;
+    while (end < url.size() && url[end] != '/' && url[end] != '?' && url[end] != '#') ++end;
+    std::string_view authority = url.substr(offset, end - offset);
+
+    size_t hash = url.find('#', end);
+    if (hash != std::string_view::npos) {
+        parts.fragment = url.substr(hash + 1);
+    } else {
+        hash = url.size();
+    }
+    size_t question = url.find('?', end);
+    if (question < hash) {
+        parts.hasQuery = true;
+        parts.query = url.substr(question + 1, hash - question - 1);
+    } else {
+        question = hash;
+    }
+    parts.path = url.substr(end, question - end);
+
+    // Drop "user:password@", then split off the port; an IPv6 literal's colons sit inside brackets
+    size_t at = authority.rfind('@');
+    if (at != std::string_view::npos) authority.remove_prefix(at + 1);
+    size_t colon = authority.rfind(':');
+    if (colon != std::string_view::npos && authority.find(']', colon) == std::string_view::npos) {
+        parts.port = authority.substr(colon + 1);
+        authority = authority.substr(0, colon);
+    }
+    parts.host = authority;
+    if (parts.host.empty()) return false;
+
+    if (parts.port.empty()) {
+        // "host:" counts as no port at all
+        if (equalsIgnoreCase(parts.scheme, "https")) {
+            parts.portNumber = 443;
+        } else if (equalsIgnoreCase(parts.scheme, "http")) {
+            parts.portNumber = 80;
+        }
+        return true;
+    }
+
+    int port = 0;
+    for (char ch : parts.port) {
+        if (ch < '0' || ch > '9') return false;
+        port = port * 10 + (ch - '0');
+        if (port > 65535) return false;
+    }
+    parts.portNumber = port;
+    return port > 0;
+}
+
+void appendRequestTarget(const UrlParts& parts, std::string& out) {
+    // A run of leading slashes is sent as one
+    size_t slashes = parts.path.find_first_not_of('/');
+    if (slashes == std::string_view::npos) {
+        out += '/';
+    } else {
+        out.append(parts.path.substr(slashes > 0 ? slashes - 1 : 0));
+    }
+    if (parts.hasQuery) {
+        out += '?';
+        out.append(parts.query);
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef URL_H
+#define URL_H
+
+#include <string>
+#include <string_view>
+
+// A URL split into its components. Every part is a view into the parsed
+// string, so parsing never allocates; that string must outlive the parts.
+//
+//   https://user@example.com:8080/a/b?q=1#top
+//   scheme   "https"          (empty for "example.com/a", which has none)
+//   host     "example.com"    (IPv6 literals keep their brackets: "[::1]")
+//   port     "8080"           (empty when absent)
+//   path     "/a/b"           (empty when absent)
+//   query    "q=1"            (without the '?')
+//   fragment "top"            (without the '#')
+struct UrlParts {
+    std::string_view scheme;
+    std::string_view host;
+    std::string_view port;
+    std::string_view path;
+    std::string_view query;
+    std::string_view fragment;
+    bool hasQuery = false;  // A '?' was present, even if the query is empty
+    int portNumber = 0;     // Explicit port, else 80 / 443 by scheme (0 for other schemes)
+};
+
+// Split a URL into its parts in one pass, without regex or allocation.
+// Returns false when it has no host or its port is not a number in 1-65535.
+bool parseUrl(std::string_view url, UrlParts& parts);
+
+// Compare two strings ignoring ASCII case (e.g. a scheme with "https", or header field names)
+bool equalsIgnoreCase(std::string_view a, std::string_view b);
+
+// Append the request target for an HTTP request line: path (or "/") and query, no fragment
+void appendRequestTarget(const UrlParts& parts, std::string& out);
+
+#endif // URL_H
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Generate html_entity_table.h, the named character reference table used by
+html_entities.cpp, from the WHATWG list Python ships as html.entities.html5
+(the same data as https://html.spec.whatwg.org/entities.json).
+
+The table is laid out as a minimal perfect hash (hash and displace): a
+name's first hash picks a bucket, and the bucket's seed either names the
+slot of its only entry directly (negative seeds) or is mixed into a second
+hash that spreads the bucket's entries over free slots. entityHash() below
+must stay in step with the one in html_entities.cpp.
+
+Usage: python3 utils/gen_html_entity_table.py > html_entity_table.h
+"""
+
+import html.entities
+
+MASK = 0xFFFFFFFF
+
+
+def entity_hash(name, seed):
+    h = (2166136261 ^ ((seed * 0x9E3779B9) & MASK)) & MASK
+    for byte in name.encode():
+        h = ((h ^ byte) * 16777619) & MASK
+    return h
+
+
+def build(names):
+    size = len(names)
+    bucket_count = size // 3
+    buckets = [[] for _ in range(bucket_count)]
+    for name in names:
+        buckets[entity_hash(name, 0) % bucket_count].append(name)
+
+    seeds = [0] * bucket_count
+    slots = [None] * size
+    order = sorted(range(bucket_count), key=lambda b: -len(buckets[b]))
+    for bucket in order:
+        entries = buckets[bucket]
+        if not entries:
+            continue
+        if len(entries) == 1:
+            slot = slots.index(None)
+            slots[slot] = entries[0]
+            seeds[bucket] = -slot - 1
+            continue
+        seed = 1
+        while True:
+            chosen = [entity_hash(name, seed) % size for name in entries]
+            if len(set(chosen)) == len(chosen) and all(slots[s] is None for s in chosen):
+                break
+            seed += 1
+        for name, slot in zip(entries, chosen):
+            slots[slot] = name
+        seeds[bucket] = seed
+    return seeds, slots
+
+
+def c_bytes(text):
+    return '"' + ''.join('\\x%02x' % byte for byte in text.encode()) + '"'
+
+
+def main():
+    table = html.entities.html5
+    names = sorted(table)
+    seeds, slots = build(names)
+
+    print("// Generated by utils/gen_html_entity_table.py from the WHATWG named")
+    print("// character reference list; do not edit by hand.")
+    print("#ifndef HTML_ENTITY_TABLE_H")
+    print("#define HTML_ENTITY_TABLE_H")
+    print()
+    print("#define ENTITY_COUNT %d" % len(slots))
+    print("#define ENTITY_BUCKET_COUNT %d" % len(seeds))
+    print()
+    print("// Per bucket: -(slot + 1) for a single entry, else the seed of its second hash")
+    print("static constexpr int32_t ENTITY_SEEDS[ENTITY_BUCKET_COUNT] = {")
+    for i in range(0, len(seeds), 16):
+        print("    " + ", ".join(str(seed) for seed in seeds[i:i + 16]) + ",")
+    print("};")
+    print()
+    print("// Names without the '&', with the ';' where the name needs one; values in UTF-8")
+    print("static constexpr NamedEntity ENTITIES[ENTITY_COUNT] = {")
+    for name in slots:
+        print('    {"%s", %s},' % (name, c_bytes(table[name])))
+    print("};")
+    print()
+    print("#endif // HTML_ENTITY_TABLE_H")
+
+
+if __name__ == "__main__":
+    main()
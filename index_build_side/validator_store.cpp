@@ -0,0 +1,112 @@
+#include "validator_store.h"
+
+// CRC-64 is one of the "esoteric" definitions CRC++ leaves out by default
+#define CRCPP_USE_CPP11
+#define CRCPP_INCLUDE_ESOTERIC_CRC_DEFINITIONS
+#include "utils/CRC.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+// Helper function to check that a value can be stored in the tab separated format
+static bool storable(const std::string& value) {
+    return value.find_first_of("\t\r\n") == std::string::npos;
+}
+
+uint64_t ValidatorStore::key(const std::string& url) {
+    static const CRC::Table<std::uint64_t, 64> table(CRC::CRC_64());
+    return CRC::Calculate(url.data(), url.size(), table);
+}
+
+bool ValidatorStore::lookup(const std::string& url, Validators& validators) const {
+    auto it = entries_.find(key(url));
+    if (it == entries_.end()) {
+        return false;
+    }
+
+    // Guard against CRC collisions: the packed entry starts with its URL
+    const std::string& packed = it->second;
+    size_t urlEnd = packed.find('\t');
+    if (packed.compare(0, urlEnd, url) != 0) {
+        return false;
+    }
+    size_t etagEnd = packed.find('\t', urlEnd + 1);
+    validators.etag = packed.substr(urlEnd + 1, etagEnd - urlEnd - 1);
+    validators.lastModified = packed.substr(etagEnd + 1);
+    return true;
+}
+
+void ValidatorStore::record(const std::string& url, const ResponseHeader& header) {
+    if (header.status == 200) {
+        if ((header.etag.empty() && header.lastModified.empty()) || !storable(url) ||
+            !storable(header.etag) || !storable(header.lastModified)) {
+            forget(url);
+            return;
+        }
+        store(url, header.etag, header.lastModified);
+    } else if (header.status == 404 || header.status == 410) {
+        forget(url);
+    }
+}
+
+void ValidatorStore::forget(const std::string& url) {
+    entries_.erase(key(url));
+}
+
+std::vector<std::string> ValidatorStore::urls() const {
+    std::vector<std::string> result;
+    result.reserve(entries_.size());
+    for (const auto& entry : entries_) {
+        result.push_back(entry.second.substr(0, entry.second.find('\t')));
+    }
+    return result;
+}
+
+void ValidatorStore::store(const std::string& url, const std::string& etag, const std::string& lastModified) {
+    std::string& packed = entries_[key(url)];
+    packed.clear();
+    packed.reserve(url.size() + etag.size() + lastModified.size() + 2);
+    packed += url;
+    packed += '\t';
+    packed += etag;
+    packed += '\t';
+    packed += lastModified;
+}
+
+bool ValidatorStore::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t urlEnd = line.find('\t');
+        size_t etagEnd = urlEnd == std::string::npos ? std::string::npos : line.find('\t', urlEnd + 1);
+        if (etagEnd == std::string::npos) {
+            std::cerr << "Skipping malformed validator line in " << path << std::endl;
+            continue;
+        }
+        store(line.substr(0, urlEnd), line.substr(urlEnd + 1, etagEnd - urlEnd - 1), line.substr(etagEnd + 1));
+    }
+    return true;
+}
+
+bool ValidatorStore::save(const std::string& path) const {
+    // Write a temporary file first so a crash never leaves a truncated store
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        for (const auto& entry : entries_) {
+            file << entry.second << '\n';
+        }
+        if (!file) {
+            return false;
+        }
+    }
+    return std::rename(temporary.c_str(), path.c_str()) == 0;
+}
@@ -0,0 +1,48 @@
+#ifndef VALIDATOR_STORE_H
+#define VALIDATOR_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "downloader.h"
+
+// Cache validators remembered from an earlier fetch of a URL
+struct Validators {
+    std::string etag;          // Sent back as If-None-Match
+    std::string lastModified;  // Sent back as If-Modified-Since
+};
+
+// Per-URL ETag / Last-Modified store for conditional re-fetches. Each URL
+// takes one map slot keyed by its CRC-64 and one packed string holding the
+// URL and its validators. The store can be saved between crawls so a
+// recrawl only downloads pages that changed.
+class ValidatorStore {
+public:
+    // Validators from an earlier fetch of url, if any
+    bool lookup(const std::string& url, Validators& validators) const;
+
+    // Update from a fresh response: 200s carrying validators are remembered,
+    // anything else replacing the page drops the stale entry
+    void record(const std::string& url, const ResponseHeader& header);
+
+    void forget(const std::string& url);
+    size_t size() const { return entries_.size(); }
+
+    // Every URL in the store, e.g. to seed a recrawl
+    std::vector<std::string> urls() const;
+
+    // One "url\tetag\tlast-modified" line per entry
+    bool load(const std::string& path);
+    bool save(const std::string& path) const;
+
+private:
+    static uint64_t key(const std::string& url);
+    void store(const std::string& url, const std::string& etag, const std::string& lastModified);
+
+    std::unordered_map<uint64_t, std::string> entries_; // URL, ETag and Last-Modified joined by tabs
+};
+
+#endif // VALIDATOR_STORE_H